@@ -88,6 +88,7 @@ const (
 	QueryAlwaysTrueCondition    = 28
 	QuerySubQueryCondition      = 29
 	QueryFieldSubQueryCondition = 30
+	QueryIndexOnly              = 31
 
 	LeftJoin    = 0
 	InnerJoin   = 1
@@ -182,4 +183,5 @@ const (
 	ErrQrUIDMissmatch       = 36
 	ErrSystem               = 37
 	ErrAssert               = 38
+	ErrQueryMemoryLimit     = 39
 )
@@ -9,9 +9,16 @@ import (
 	"time"
 	"unsafe"
 
+	"github.com/golang/snappy"
 	"github.com/restream/reindexer/v3/bindings"
 )
 
+// First byte of the compressed tuple. Raw tuple always starts with TAG_OBJECT
+const compressedTupleMarker = TAG_END
+
+// Size of the compressed tuple's header: marker and 64-bit hash of the raw tuple
+const compressedTupleHeaderSize = 9
+
 var (
 	ifaceSlice     []interface{}
 	ifaceSliceType = reflect.TypeOf(ifaceSlice)
@@ -773,6 +780,12 @@ func (dec *Decoder) DecodeCPtr(cptr uintptr, dest interface{}) (err error) {
 	defer dec.state.lock.RUnlock()
 
 	tuple := pl.getBytes(0, 0)
+	if len(tuple) > 0 && tuple[0] == compressedTupleMarker {
+		// Tuple is stored in the compressed form (see namespace's 'tuples_compression' option)
+		if tuple, err = snappy.Decode(nil, tuple[compressedTupleHeaderSize:]); err != nil {
+			return err
+		}
+	}
 	ser := &Serializer{buf: tuple}
 
 	defer func() {
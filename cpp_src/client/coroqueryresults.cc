@@ -1,7 +1,9 @@
 #include "client/coroqueryresults.h"
+#include <deque>
 #include "client/namespace.h"
 #include "core/cjson/baseencoder.h"
 #include "core/keyvalue/p_string.h"
+#include "coroutine/channel.h"
 #include "net/cproto/coroclientconnection.h"
 #include "server/rpcqrwatcher.h"
 #include "tools/logger.h"
@@ -11,21 +13,131 @@ namespace client {
 
 using namespace reindexer::net;
 
+// Fetches next results pages in background, while the current page is being iterated.
+// Each page is requested by the separate coroutine. Next request is sent right after the previous page was received, until summary size
+// of the received (but not consumed yet) pages reaches the budget.
+// Prefetcher is owned by the query results and background coroutines hold weak reference only, so the results may be destroyed
+// (or moved) at any moment. Everything except the destruction has to be done from the connection's loop thread
+class CoroQueryResults::Prefetcher : public std::enable_shared_from_this<CoroQueryResults::Prefetcher> {
+public:
+	struct Page {
+		Error status;
+		std::string data;
+	};
+
+	Prefetcher(cproto::CoroClientConnection *conn, RPCQrId id, int flags, int fetchAmount, seconds timeout, size_t budget, int offset,
+			   int qcount) noexcept
+		: conn_(conn),
+		  queryID_(id),
+		  flags_(flags),
+		  fetchAmount_(fetchAmount),
+		  requestTimeout_(timeout),
+		  budget_(budget),
+		  nextOffset_(offset),
+		  qcount_(qcount) {}
+
+	void Start() {
+		if (inProgress_ || nextOffset_ >= qcount_ || bufferedBytes_ >= budget_) return;
+		inProgress_ = conn_->SpawnBackground([self = weak_from_this(), conn = conn_, offset = nextOffset_] { fetch(self, conn, offset); });
+	}
+	Page Get() {
+		if (pages_.empty() && !inProgress_) {
+			Start();
+			if (!inProgress_) {
+				return {Error(errLogic, "Unable to fetch next results page: client is not running"), {}};
+			}
+		}
+		while (pages_.empty()) {
+			signal_.pop();
+		}
+		Page page = std::move(pages_.front());
+		pages_.pop_front();
+		bufferedBytes_ -= page.data.size();
+		if (page.status.ok()) {
+			Start();
+		}
+		return page;
+	}
+
+private:
+	static void fetch(const std::weak_ptr<Prefetcher> &self, cproto::CoroClientConnection *conn, int offset) {
+		net::cproto::CoroRPCAnswer ret;
+		{
+			auto p = self.lock();
+			if (!p) return;
+			// Copy everything required for the request: query results may be destroyed, while this coroutine is suspended
+			const RPCQrId id = p->queryID_;
+			const int flags = p->flags_, fetchAmount = p->fetchAmount_;
+			const seconds timeout = p->requestTimeout_;
+			p.reset();
+			ret = conn->Call({cproto::kCmdFetchResults, timeout, milliseconds(0), nullptr}, id.main, flags, offset, fetchAmount, id.uid);
+		}
+
+		auto p = self.lock();
+		if (!p) return;
+		Page page;
+		int count = 0;
+		try {
+			if (!ret.Status().ok()) {
+				throw ret.Status();
+			}
+			auto args = ret.GetArgs(2);
+			std::string_view rawResult = p_string(args[0]);
+			ResultSerializer ser(rawResult);
+			ResultSerializer::QueryParams queryParams;
+			ser.GetRawQueryParams(queryParams, nullptr, ResultSerializer::AggsFlag::DontClearAggregations);
+			count = queryParams.count;
+			if (count <= 0) {
+				throw Error(errLogic, "Server returned empty results page at offset %d (of %d)", offset, p->qcount_);
+			}
+			page.data.assign(rawResult.data(), rawResult.size());
+		} catch (const Error &err) {
+			page.status = err;
+		}
+		const bool ok = page.status.ok();
+		p->inProgress_ = false;
+		p->nextOffset_ += count;
+		p->bufferedBytes_ += page.data.size();
+		p->pages_.emplace_back(std::move(page));
+		if (ok) {
+			// Send the next request before switching to the consumer
+			p->Start();
+		}
+		if (p->signal_.readers() && !p->signal_.full()) {
+			p->signal_.push(true);
+		}
+	}
+
+	cproto::CoroClientConnection *conn_;
+	const RPCQrId queryID_;
+	const int flags_;
+	const int fetchAmount_;
+	const seconds requestTimeout_;
+	const size_t budget_;
+	int nextOffset_;
+	const int qcount_;
+	size_t bufferedBytes_ = 0;
+	bool inProgress_ = false;
+	std::deque<Page> pages_;
+	coroutine::channel<bool> signal_;
+};
+
 CoroQueryResults::CoroQueryResults(int fetchFlags)
-	: conn_(nullptr), fetchOffset_(0), fetchFlags_(fetchFlags), fetchAmount_(0), requestTimeout_(0) {}
+	: conn_(nullptr), fetchOffset_(0), fetchFlags_(fetchFlags), fetchAmount_(0), requestTimeout_(0), prefetchBufferSize_(0) {}
 
 CoroQueryResults::CoroQueryResults(net::cproto::CoroClientConnection *conn, NsArray &&nsArray, int fetchFlags, int fetchAmount,
-								   seconds timeout)
+								   seconds timeout, size_t prefetchBufferSize)
 	: conn_(conn),
 	  nsArray_(std::move(nsArray)),
 	  fetchOffset_(0),
 	  fetchFlags_(fetchFlags),
 	  fetchAmount_(fetchAmount),
-	  requestTimeout_(timeout) {}
+	  requestTimeout_(timeout),
+	  prefetchBufferSize_(prefetchBufferSize) {}
 
 CoroQueryResults::CoroQueryResults(net::cproto::CoroClientConnection *conn, NsArray &&nsArray, std::string_view rawResult, RPCQrId id,
-								   int fetchFlags, int fetchAmount, seconds timeout)
-	: CoroQueryResults(conn, std::move(nsArray), fetchFlags, fetchAmount, timeout) {
+								   int fetchFlags, int fetchAmount, seconds timeout, size_t prefetchBufferSize)
+	: CoroQueryResults(conn, std::move(nsArray), fetchFlags, fetchAmount, timeout, prefetchBufferSize) {
 	Bind(rawResult, id);
 }
 
@@ -66,12 +178,33 @@ void CoroQueryResults::Bind(std::string_view rawResult, RPCQrId id) {
 	} catch (const Error &err) {
 		status_ = err;
 	}
+
+	prefetcher_.reset();
+	if (status_.ok() && conn_ && prefetchBufferSize_ && fetchAmount_ > 0 && queryParams_.count < queryParams_.qcount) {
+		int flags = fetchFlags_ ? (fetchFlags_ & ~kResultsWithPayloadTypes) : kResultsCJson;
+		flags |= kResultsSupportIdleTimeout;
+		prefetcher_ = std::make_shared<Prefetcher>(conn_, queryID_, flags, fetchAmount_, requestTimeout_, prefetchBufferSize_,
+												   queryParams_.count, queryParams_.qcount);
+		prefetcher_->Start();
+	}
 }
 
 void CoroQueryResults::fetchNextResults() {
-	using std::chrono::seconds;
 	int flags = fetchFlags_ ? (fetchFlags_ & ~kResultsWithPayloadTypes) : kResultsCJson;
 	flags |= kResultsSupportIdleTimeout;
+	fetchNextResults(flags);
+}
+
+void CoroQueryResults::fetchNextResults(int flags) {
+	if (prefetcher_) {
+		auto page = prefetcher_->Get();
+		if (!page.status.ok()) {
+			throw page.status;
+		}
+		applyFetchedResults(page.data);
+		return;
+	}
+
 	auto ret = conn_->Call({cproto::kCmdFetchResults, requestTimeout_, milliseconds(0), nullptr}, queryID_.main, flags,
 						   queryParams_.count + fetchOffset_, fetchAmount_, queryID_.uid);
 	if (!ret.Status().ok()) {
@@ -79,10 +212,12 @@ void CoroQueryResults::fetchNextResults() {
 	}
 
 	auto args = ret.GetArgs(2);
+	applyFetchedResults(p_string(args[0]));
+}
 
+void CoroQueryResults::applyFetchedResults(std::string_view rawResult) {
 	fetchOffset_ += queryParams_.count;
 
-	std::string_view rawResult = p_string(args[0]);
 	ResultSerializer ser(rawResult);
 
 	ser.GetRawQueryParams(queryParams_, nullptr, ResultSerializer::AggsFlag::DontClearAggregations);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <memory>
 #include "client/item.h"
 #include "client/resultserializer.h"
 
@@ -73,11 +74,15 @@ private:
 	friend class CoroRPCClient;
 	friend class RPCClientMock;
 	using RawResBufT = h_vector<char, 0x100>;
-	CoroQueryResults(net::cproto::CoroClientConnection* conn, NsArray&& nsArray, int fetchFlags, int fetchAmount, seconds timeout);
+	class Prefetcher;
+	CoroQueryResults(net::cproto::CoroClientConnection* conn, NsArray&& nsArray, int fetchFlags, int fetchAmount, seconds timeout,
+					 size_t prefetchBufferSize = 0);
 	CoroQueryResults(net::cproto::CoroClientConnection* conn, NsArray&& nsArray, std::string_view rawResult, RPCQrId id, int fetchFlags,
-					 int fetchAmount, seconds timeout);
+					 int fetchAmount, seconds timeout, size_t prefetchBufferSize = 0);
 	void Bind(std::string_view rawResult, RPCQrId id);
 	void fetchNextResults();
+	void fetchNextResults(int flags);
+	void applyFetchedResults(std::string_view rawResult);
 
 	net::cproto::CoroClientConnection* conn_;
 
@@ -88,6 +93,8 @@ private:
 	int fetchFlags_;
 	int fetchAmount_;
 	seconds requestTimeout_;
+	size_t prefetchBufferSize_;
+	std::shared_ptr<Prefetcher> prefetcher_;
 
 	ResultSerializer::QueryParams queryParams_;
 	Error status_;
@@ -64,6 +64,9 @@ Error CoroReindexer::DeleteMeta(std::string_view nsName, const std::string& key)
 }
 Error CoroReindexer::Delete(const Query& q, CoroQueryResults& result) { return impl_->Delete(q, result, ctx_); }
 Error CoroReindexer::Select(std::string_view query, CoroQueryResults& result) { return impl_->Select(query, result, ctx_); }
+Error CoroReindexer::Select(std::string_view query, const VariantArray& params, CoroQueryResults& result) {
+	return impl_->Select(query, params, result, ctx_);
+}
 Error CoroReindexer::Select(const Query& q, CoroQueryResults& result) { return impl_->Select(q, result, ctx_); }
 Error CoroReindexer::Commit(std::string_view nsName) { return impl_->Commit(nsName); }
 Error CoroReindexer::AddIndex(std::string_view nsName, const IndexDef& idx) { return impl_->AddIndex(nsName, idx, ctx_); }
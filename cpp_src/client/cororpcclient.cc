@@ -248,7 +248,7 @@ Error CoroRPCClient::Delete(const Query& query, CoroQueryResults& result, const
 	NsArray nsArray;
 	query.WalkNested(true, true, false, [this, &nsArray](const Query& q) { nsArray.push_back(getNamespace(q.NsName())); });
 
-	result = CoroQueryResults(&conn_, std::move(nsArray), 0, config_.FetchAmount, config_.RequestTimeout);
+	result = CoroQueryResults(&conn_, std::move(nsArray), 0, config_.FetchAmount, config_.RequestTimeout, config_.PrefetchBufferSize);
 
 	auto ret = conn_.Call(mkCommand(cproto::kCmdDeleteQuery, &ctx), ser.Slice(), kResultsWithItemID);
 	try {
@@ -269,7 +269,7 @@ Error CoroRPCClient::Update(const Query& query, CoroQueryResults& result, const
 	NsArray nsArray;
 	query.WalkNested(true, true, false, [this, &nsArray](const Query& q) { nsArray.push_back(getNamespace(q.NsName())); });
 
-	result = CoroQueryResults(&conn_, std::move(nsArray), 0, config_.FetchAmount, config_.RequestTimeout);
+	result = CoroQueryResults(&conn_, std::move(nsArray), 0, config_.FetchAmount, config_.RequestTimeout, config_.PrefetchBufferSize);
 
 	auto ret =
 		conn_.Call(mkCommand(cproto::kCmdUpdateQuery, &ctx), ser.Slice(), kResultsWithItemID | kResultsWithPayloadTypes | kResultsCJson);
@@ -292,16 +292,25 @@ void vec2pack(const h_vector<int32_t, 4>& vec, WrSerializer& ser) {
 	return;
 }
 
-Error CoroRPCClient::selectImpl(std::string_view query, CoroQueryResults& result, seconds netTimeout, const InternalRdxContext& ctx) {
+void params2pack(const VariantArray& params, WrSerializer& ser) {
+	ser.PutVarUint(params.size());
+	for (const auto& p : params) ser.PutVariant(p);
+}
+
+Error CoroRPCClient::selectImpl(std::string_view query, const VariantArray* params, CoroQueryResults& result, seconds netTimeout,
+								const InternalRdxContext& ctx) {
 	int flags = result.fetchFlags_ ? (result.fetchFlags_ & ~kResultsFormatMask) | kResultsJson : kResultsJson;
 
-	WrSerializer pser;
+	WrSerializer pser, paramsSer;
 	h_vector<int32_t, 4> vers;
 	vec2pack(vers, pser);
+	if (params) params2pack(*params, paramsSer);
 
-	result = CoroQueryResults(&conn_, {}, flags, config_.FetchAmount, config_.RequestTimeout);
+	result = CoroQueryResults(&conn_, {}, flags, config_.FetchAmount, config_.RequestTimeout, config_.PrefetchBufferSize);
 
-	auto ret = conn_.Call(mkCommand(cproto::kCmdSelectSQL, netTimeout, &ctx), query, flags, config_.FetchAmount, pser.Slice());
+	auto ret = params ? conn_.Call(mkCommand(cproto::kCmdSelectSQL, netTimeout, &ctx), query, flags, config_.FetchAmount, pser.Slice(),
+								   paramsSer.Slice())
+					  : conn_.Call(mkCommand(cproto::kCmdSelectSQL, netTimeout, &ctx), query, flags, config_.FetchAmount, pser.Slice());
 	try {
 		if (ret.Status().ok()) {
 			const auto args = ret.GetArgs(2);
@@ -339,7 +348,7 @@ Error CoroRPCClient::selectImpl(const Query& query, CoroQueryResults& result, se
 	}
 	vec2pack(vers, pser);
 
-	result = CoroQueryResults(&conn_, std::move(nsArray), flags, config_.FetchAmount, config_.RequestTimeout);
+	result = CoroQueryResults(&conn_, std::move(nsArray), flags, config_.FetchAmount, config_.RequestTimeout, config_.PrefetchBufferSize);
 
 	auto ret = conn_.Call(mkCommand(cproto::kCmdSelect, netTimeout, &ctx), qser.Slice(), flags, config_.FetchAmount, pser.Slice());
 	try {
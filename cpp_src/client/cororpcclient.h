@@ -58,7 +58,10 @@ public:
 	Error Delete(const Query &query, CoroQueryResults &result, const InternalRdxContext &ctx);
 	Error Update(const Query &query, CoroQueryResults &result, const InternalRdxContext &ctx);
 	Error Select(std::string_view query, CoroQueryResults &result, const InternalRdxContext &ctx) {
-		return selectImpl(query, result, config_.RequestTimeout, ctx);
+		return selectImpl(query, nullptr, result, config_.RequestTimeout, ctx);
+	}
+	Error Select(std::string_view query, const VariantArray &params, CoroQueryResults &result, const InternalRdxContext &ctx) {
+		return selectImpl(query, &params, result, config_.RequestTimeout, ctx);
 	}
 	Error Select(const Query &query, CoroQueryResults &result, const InternalRdxContext &ctx) {
 		return selectImpl(query, result, config_.RequestTimeout, ctx);
@@ -79,7 +82,8 @@ public:
 	Error RollBackTransaction(CoroTransaction &tr, const InternalRdxContext &ctx);
 
 protected:
-	Error selectImpl(std::string_view query, CoroQueryResults &result, seconds netTimeout, const InternalRdxContext &ctx);
+	Error selectImpl(std::string_view query, const VariantArray *params, CoroQueryResults &result, seconds netTimeout,
+					 const InternalRdxContext &ctx);
 	Error selectImpl(const Query &query, CoroQueryResults &result, seconds netTimeout, const InternalRdxContext &ctx);
 	Error modifyItem(std::string_view nsName, Item &item, int mode, seconds netTimeout, const InternalRdxContext &ctx);
 	Error subscribeImpl(bool subscribe);
@@ -106,6 +110,8 @@ protected:
 };
 
 void vec2pack(const h_vector<int32_t, 4> &vec, WrSerializer &ser);
+// Packs values of the prepared query placeholders
+void params2pack(const VariantArray &params, WrSerializer &ser);
 
 }  // namespace client
 }  // namespace reindexer
@@ -58,6 +58,9 @@ Error Reindexer::DeleteMeta(std::string_view nsName, const std::string& key) {
 }
 Error Reindexer::Delete(const Query& q, QueryResults& result) { return impl_->Delete(q, result, ctx_); }
 Error Reindexer::Select(std::string_view query, QueryResults& result) { return impl_->Select(query, result, ctx_, nullptr); }
+Error Reindexer::Select(std::string_view query, const VariantArray& params, QueryResults& result) {
+	return impl_->Select(query, params, result, ctx_, nullptr);
+}
 Error Reindexer::Select(const Query& q, QueryResults& result) { return impl_->Select(q, result, ctx_, nullptr); }
 Error Reindexer::Commit(std::string_view nsName) { return impl_->Commit(nsName); }
 Error Reindexer::AddIndex(std::string_view nsName, const IndexDef& idx) { return impl_->AddIndex(nsName, idx, ctx_); }
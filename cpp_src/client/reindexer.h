@@ -131,6 +131,13 @@ public:
 	/// @param query - SQL query. Only "SELECT" semantic is supported
 	/// @param result - QueryResults with found items
 	Error Select(std::string_view query, QueryResults &result);
+	/// Execute prepared SQL Query and return results
+	/// Parsed query is cached by the server, so only the parameters binding is performed for the repeated queries
+	/// May be used with completion
+	/// @param query - SQL query with '?' placeholders in the values of the where conditions
+	/// @param params - values of the placeholders in the order of appearance
+	/// @param result - QueryResults with found items
+	Error Select(std::string_view query, const VariantArray &params, QueryResults &result);
 	/// Execute Query and return results
 	/// May be used with completion
 	/// @param query - Query object with query attributes
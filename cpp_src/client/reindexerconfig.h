@@ -11,7 +11,8 @@ using std::chrono::seconds;
 struct ReindexerConfig {
 	ReindexerConfig(int _ConnPoolSize = 4, int _WorkerThreads = 1, int _FetchAmount = 10000, int _ReconnectAttempts = 0,
 					seconds _ConnectTimeout = seconds(0), seconds _RequestTimeout = seconds(0), bool _EnableCompression = false,
-					bool _RequestDedicatedThread = false, std::string _appName = "CPP-client", unsigned _syncRxCoroCount = 10)
+					bool _RequestDedicatedThread = false, std::string _appName = "CPP-client", unsigned _syncRxCoroCount = 10,
+					size_t _PrefetchBufferSize = 0)
 		: ConnPoolSize(_ConnPoolSize),
 		  WorkerThreads(_WorkerThreads),
 		  FetchAmount(_FetchAmount),
@@ -21,7 +22,8 @@ struct ReindexerConfig {
 		  EnableCompression(_EnableCompression),
 		  RequestDedicatedThread(_RequestDedicatedThread),
 		  AppName(std::move(_appName)),
-		  rxClientCoroCount(_syncRxCoroCount) {}
+		  rxClientCoroCount(_syncRxCoroCount),
+		  PrefetchBufferSize(_PrefetchBufferSize) {}
 
 	int ConnPoolSize;
 	int WorkerThreads;
@@ -33,6 +35,9 @@ struct ReindexerConfig {
 	bool RequestDedicatedThread;
 	std::string AppName;
 	unsigned rxClientCoroCount;
+	// Max summary size (in bytes) of the query results pages, which may be fetched in background, while the previous page is being
+	// iterated. At least one page is always prefetched, if this value is not 0. 0 - disables prefetch
+	size_t PrefetchBufferSize;
 };
 
 enum ConnectOpt {
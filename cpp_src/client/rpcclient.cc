@@ -436,13 +436,14 @@ Error RPCClient::Update(const Query& query, QueryResults& result, const Internal
 	return ret.Status();
 }
 
-Error RPCClient::selectImpl(std::string_view query, QueryResults& result, cproto::ClientConnection* conn, seconds netTimeout,
-							const InternalRdxContext& ctx) {
+Error RPCClient::selectImpl(std::string_view query, const VariantArray* params, QueryResults& result, cproto::ClientConnection* conn,
+							seconds netTimeout, const InternalRdxContext& ctx) {
 	int flags = result.fetchFlags_ ? (result.fetchFlags_ & ~kResultsFormatMask) | kResultsJson : kResultsJson;
 
-	WrSerializer pser;
+	WrSerializer pser, paramsSer;
 	h_vector<int32_t, 4> vers;
 	vec2pack(vers, pser);
+	if (params) params2pack(*params, paramsSer);
 
 	if (!conn) conn = getConn();
 
@@ -462,9 +463,15 @@ Error RPCClient::selectImpl(std::string_view query, QueryResults& result, cproto
 	};
 
 	if (!ctx.cmpl()) {
-		auto ret = conn->Call(mkCommand(cproto::kCmdSelectSQL, netTimeout, &ctx), query, flags, config_.FetchAmount, pser.Slice());
+		auto ret = params ? conn->Call(mkCommand(cproto::kCmdSelectSQL, netTimeout, &ctx), query, flags, config_.FetchAmount, pser.Slice(),
+									   paramsSer.Slice())
+						  : conn->Call(mkCommand(cproto::kCmdSelectSQL, netTimeout, &ctx), query, flags, config_.FetchAmount, pser.Slice());
 		icompl(ret, conn);
 		return ret.Status();
+	} else if (params) {
+		conn->Call(icompl, mkCommand(cproto::kCmdSelectSQL, netTimeout, &ctx), query, flags, config_.FetchAmount, pser.Slice(),
+				   paramsSer.Slice());
+		return errOK;
 	} else {
 		conn->Call(icompl, mkCommand(cproto::kCmdSelectSQL, netTimeout, &ctx), query, flags, config_.FetchAmount, pser.Slice());
 		return errOK;
@@ -63,7 +63,11 @@ public:
 	Error Delete(const Query &query, QueryResults &result, const InternalRdxContext &ctx);
 	Error Update(const Query &query, QueryResults &result, const InternalRdxContext &ctx);
 	Error Select(std::string_view query, QueryResults &result, const InternalRdxContext &ctx, cproto::ClientConnection *conn = nullptr) {
-		return selectImpl(query, result, conn, config_.RequestTimeout, ctx);
+		return selectImpl(query, nullptr, result, conn, config_.RequestTimeout, ctx);
+	}
+	Error Select(std::string_view query, const VariantArray &params, QueryResults &result, const InternalRdxContext &ctx,
+				 cproto::ClientConnection *conn = nullptr) {
+		return selectImpl(query, &params, result, conn, config_.RequestTimeout, ctx);
 	}
 	Error Select(const Query &query, QueryResults &result, const InternalRdxContext &ctx, cproto::ClientConnection *conn = nullptr) {
 		return selectImpl(query, result, conn, config_.RequestTimeout, ctx);
@@ -92,8 +96,8 @@ protected:
 		std::atomic_bool running;
 	};
 
-	Error selectImpl(std::string_view query, QueryResults &result, cproto::ClientConnection *, seconds netTimeout,
-					 const InternalRdxContext &ctx);
+	Error selectImpl(std::string_view query, const VariantArray *params, QueryResults &result, cproto::ClientConnection *,
+					 seconds netTimeout, const InternalRdxContext &ctx);
 	Error selectImpl(const Query &query, QueryResults &result, cproto::ClientConnection *, seconds netTimeout,
 					 const InternalRdxContext &ctx);
 	Error modifyItem(std::string_view nsName, Item &item, int mode, seconds netTimeout, const InternalRdxContext &ctx);
@@ -129,6 +133,8 @@ protected:
 };
 
 void vec2pack(const h_vector<int32_t, 4> &vec, WrSerializer &ser);
+// Packs values of the prepared query placeholders
+void params2pack(const VariantArray &params, WrSerializer &ser);
 
 }  // namespace client
 }  // namespace reindexer
@@ -404,29 +404,13 @@ void SyncCoroReindexerImpl::coroInterpreter(reindexer::client::CoroRPCClient &rx
 				auto cd = dynamic_cast<DatabaseCommand<Error, int, SyncCoroQueryResults &> *>(v.first);
 				assertrx(cd);
 				CoroQueryResults &coroResults = std::get<1>(cd->arguments).results_;
-				auto ret = coroResults.conn_->Call(
-					{reindexer::net::cproto::kCmdFetchResults, coroResults.requestTimeout_, milliseconds(0), nullptr},
-					coroResults.queryID_.main, std::get<0>(cd->arguments), coroResults.queryParams_.count + coroResults.fetchOffset_,
-					coroResults.fetchAmount_, coroResults.queryID_.uid);
-				if (!ret.Status().ok()) {
-					cd->ret.set_value(Error(errLogic));
-					break;
-				}
-
-				auto args = ret.GetArgs(2);
-
-				coroResults.fetchOffset_ += coroResults.queryParams_.count;
-
-				std::string_view rawResult = p_string(args[0]);
-				ResultSerializer ser(rawResult);
-
-				ser.GetRawQueryParams(coroResults.queryParams_, nullptr, ResultSerializer::AggsFlag::DontClearAggregations);
-
-				coroResults.rawResult_.assign(rawResult.begin() + ser.Pos(), rawResult.end());
-
 				Error err;
-				cd->ret.set_value(err);
-
+				try {
+					coroResults.fetchNextResults(std::get<0>(cd->arguments));
+				} catch (const Error &e) {
+					err = e;
+				}
+				cd->ret.set_value(std::move(err));
 				break;
 			}
 			case DbCmdNewItemTx: {
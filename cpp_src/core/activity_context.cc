@@ -97,13 +97,18 @@ void Activity::GetJSON(WrSerializer& ser) const {
 	builder.Put("query_start", ss.str());
 	builder.Put("state", DescribeState(state));
 	if (state == WaitLock) builder.Put("lock_description", "Wait lock for " + std::string(description));
+	if (totalItems) {
+		builder.Put("processed_items", processedItems);
+		builder.Put("total_items", totalItems);
+	}
 	builder.End();
 }
 
 RdxActivityContext::RdxActivityContext(std::string_view activityTracer, std::string_view user, std::string_view query,
 									   ActivityContainer& parent, int ipConnectionId, bool clientState)
 	: data_{nextId(),		std::string(activityTracer), std::string(user),		std::string(query),
-			ipConnectionId, Activity::InProgress,		 system_clock_w::now(), ""sv},
+			ipConnectionId, Activity::InProgress,		 system_clock_w::now(), ""sv,				0,
+			0},
 	  state_(serializeState(clientState ? Activity::Sending : Activity::InProgress)),
 	  parent_(&parent)
 #ifndef NDEBUG
@@ -123,7 +128,9 @@ RdxActivityContext::RdxActivityContext(RdxActivityContext&& other)
 	  ,
 	  refCount_(0u)
 #endif
-{
+	  ,
+	  processedItems_(other.processedItems_.load(std::memory_order_relaxed)),
+	  totalItems_(other.totalItems_.load(std::memory_order_relaxed)) {
 	if (parent_) parent_->Reregister(&other, this);
 	other.parent_ = nullptr;
 }
@@ -133,6 +140,8 @@ RdxActivityContext::operator Activity() const {
 	const auto state = deserializeState(state_.load(std::memory_order_relaxed));
 	ret.state = state.first;
 	ret.description = state.second;
+	ret.processedItems = processedItems_.load(std::memory_order_relaxed);
+	ret.totalItems = totalItems_.load(std::memory_order_relaxed);
 	return ret;
 }
 
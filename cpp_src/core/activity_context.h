@@ -23,6 +23,9 @@ struct Activity {
 	enum State : unsigned { InProgress = 0, WaitLock, Sending, IndexesLookup, SelectLoop } state;
 	system_clock_w::time_point startTime;
 	std::string_view description;
+	// Progress of the long multi-step operations (chunked update/delete queries)
+	size_t processedItems = 0;
+	size_t totalItems = 0;
 	void GetJSON(WrSerializer&) const;
 	static std::string_view DescribeState(State) noexcept;
 };
@@ -111,6 +114,10 @@ public:
 	Ward BeforeSelectLoop() noexcept { return Ward(this, Activity::SelectLoop); }
 
 	bool CheckConnectionId(int connectionId) const noexcept { return data_.connectionId == connectionId; }
+	void SetProgress(size_t processed, size_t total) noexcept {
+		processedItems_.store(processed, std::memory_order_relaxed);
+		totalItems_.store(total, std::memory_order_relaxed);
+	}
 
 private:
 	static unsigned serializeState(MutexMark mark) noexcept { return Activity::WaitLock | (static_cast<unsigned>(mark) << kStateShift); }
@@ -122,6 +129,8 @@ private:
 	std::atomic<unsigned> state_ = {serializeState(Activity::InProgress)};	// kStateShift lower bits for state, other for details
 	ActivityContainer* parent_ = nullptr;
 	std::atomic<unsigned> refCount_ = {0};
+	std::atomic<size_t> processedItems_ = {0};
+	std::atomic<size_t> totalItems_ = {0};
 };
 
 }  // namespace reindexer
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <atomic>
+#include "namespace/namespacestat.h"
+#include "perfstatcounter.h"
+
+namespace reindexer {
+
+class BgTasksStatCounter {
+	using QuantityCounter = QuantityCounterST<size_t>;
+
+public:
+	void Count(size_t queueWaitUs, size_t execTimeUs) {
+		std::unique_lock<std::mutex> lck(mtx_);
+		queueWaitCounter_.Count(queueWaitUs);
+		execCounter_.Count(execTimeUs);
+	}
+	void Skip() noexcept { skippedCount_.fetch_add(1, std::memory_order_relaxed); }
+
+	BgTasksPerfStat Get() const {
+		BgTasksPerfStat stats;
+		QuantityCounter::Stats queueWaitStats;
+		QuantityCounter::Stats execStats;
+		{
+			std::unique_lock<std::mutex> lck(mtx_);
+			queueWaitStats = queueWaitCounter_.Get();
+			execStats = execCounter_.Get();
+		}
+		stats.totalCount = execStats.hitsCount;
+		stats.skippedCount = skippedCount_.load(std::memory_order_relaxed);
+		stats.minQueueWaitUs = queueWaitStats.minValue;
+		stats.maxQueueWaitUs = queueWaitStats.maxValue;
+		stats.avgQueueWaitUs = static_cast<size_t>(queueWaitStats.avg);
+		stats.minExecTimeUs = execStats.minValue;
+		stats.maxExecTimeUs = execStats.maxValue;
+		stats.avgExecTimeUs = static_cast<size_t>(execStats.avg);
+		return stats;
+	}
+
+	void Reset() {
+		std::unique_lock<std::mutex> lck(mtx_);
+		queueWaitCounter_.Reset();
+		execCounter_.Reset();
+		skippedCount_.store(0, std::memory_order_relaxed);
+	}
+
+private:
+	QuantityCounter queueWaitCounter_;
+	QuantityCounter execCounter_;
+	std::atomic<size_t> skippedCount_ = {0};
+	mutable std::mutex mtx_;
+};
+
+}  // namespace reindexer
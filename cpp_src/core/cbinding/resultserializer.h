@@ -28,6 +28,7 @@ public:
 		: WrSerializer(buf), opts_(opts) {
 		resetUnknownFlags();
 	}
+	WrResultSerializer(chunk&& ch, const ResultFetchOpts& opts) : WrSerializer(std::move(ch)), opts_(opts) { resetUnknownFlags(); }
 
 	bool PutResults(const QueryResults* results);
 	void SetOpts(const ResultFetchOpts& opts) { opts_ = opts; }
@@ -4,6 +4,7 @@
 #include "cjsonbuilder.h"
 #include "cjsontools.h"
 #include "core/keyvalue/p_string.h"
+#include "core/payload/tuplescompressor.h"
 #include "csvbuilder.h"
 #include "jsonbuilder.h"
 #include "msgpackbuilder.h"
@@ -333,6 +334,10 @@ std::string_view BaseEncoder<Builder>::getPlTuple(ConstPayload& pl) {
 		buildPayloadTuple(pl, tagsMatcher_, tmpPlTuple_);
 		return tmpPlTuple_.Slice();
 	}
+	if (TuplesCompressor::IsCompressed(tuple)) {
+		decompressedTuple_ = TuplesCompressor::Decompress(pl.Type().Compressor(), tuple);
+		return std::string_view(*decompressedTuple_);
+	}
 
 	return std::string_view(tuple);
 }
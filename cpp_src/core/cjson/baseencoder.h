@@ -44,6 +44,8 @@ public:
 	void Encode(std::string_view tuple, Builder &wrSer, IAdditionalDatasource<Builder> *);
 
 	const TagsLengths &GetTagsMeasures(ConstPayload &pl, IEncoderDatasourceWithJoins *ds = nullptr);
+	// Strings, extracted from the decompressed tuple, are valid only while the encoder exists
+	bool IsTupleDecompressed() const noexcept { return decompressedTuple_.get() != nullptr; }
 
 protected:
 	using IndexedTagsPathInternalT = IndexedTagsPathImpl<16>;
@@ -66,6 +68,7 @@ protected:
 	int fieldsoutcnt_[kMaxIndexes];
 	const FieldsSet *filter_;
 	WrSerializer tmpPlTuple_;
+	key_string decompressedTuple_;
 	TagsPath curTagsPath_;
 	IndexedTagsPathInternalT indexedTagsPath_;
 	TagsLengths tagsLengths_;
@@ -92,6 +92,35 @@ void copyCJsonValue(TagType tagType, Serializer &rdser, WrSerializer &wrser) {
 	}
 }
 
+void skipCjsonArrayValues(TagType elemType, size_t count, Serializer &rdser) {
+	switch (elemType) {
+		case TAG_VARINT:
+		case TAG_BOOL:
+			rdser.SkipVarints(count);
+			break;
+		case TAG_DOUBLE:
+			rdser.Skip(count * sizeof(double));
+			break;
+		case TAG_UUID:
+			rdser.Skip(count * 2 * sizeof(uint64_t));
+			break;
+		case TAG_NULL:
+			break;
+		case TAG_OBJECT:
+			for (size_t i = 0; i < count; ++i) {
+				skipCjsonTag(rdser.GetCTag(), rdser);
+			}
+			break;
+		case TAG_STRING:
+		case TAG_ARRAY:
+		case TAG_END:
+			for (size_t i = 0; i < count; ++i) {
+				skipCjsonTag(ctag{elemType}, rdser);
+			}
+			break;
+	}
+}
+
 void skipCjsonTag(ctag tag, Serializer &rdser, std::array<unsigned, kMaxIndexes> *fieldsArrayOffsets) {
 	switch (tag.Type()) {
 		case TAG_ARRAY: {
@@ -100,15 +129,7 @@ void skipCjsonTag(ctag tag, Serializer &rdser, std::array<unsigned, kMaxIndexes>
 			if (embeddedField) {
 				const carraytag atag = rdser.GetCArrayTag();
 				const auto count = atag.Count();
-				if (atag.Type() == TAG_OBJECT) {
-					for (size_t i = 0; i < count; ++i) {
-						skipCjsonTag(rdser.GetCTag(), rdser);
-					}
-				} else {
-					for (size_t i = 0; i < count; ++i) {
-						skipCjsonTag(ctag{atag.Type()}, rdser);
-					}
-				}
+				skipCjsonArrayValues(atag.Type(), count, rdser);
 			} else {
 				const auto len = rdser.GetVarUint();
 				if (fieldsArrayOffsets) {
@@ -139,6 +160,68 @@ void skipCjsonTag(ctag tag, Serializer &rdser, std::array<unsigned, kMaxIndexes>
 	}
 }
 
+static void putScannedValue(Variant &&value, KeyValueType expectedType, VariantArray &values) {
+	expectedType.EvaluateOneOf(
+		[&](OneOf<KeyValueType::Bool, KeyValueType::Int, KeyValueType::Int64, KeyValueType::Double, KeyValueType::String,
+				  KeyValueType::Null, KeyValueType::Tuple, KeyValueType::Uuid>) { value.convert(expectedType); },
+		[](OneOf<KeyValueType::Undefined, KeyValueType::Composite>) noexcept {});
+	values.emplace_back(std::move(value));
+}
+
+static bool scanCjsonObject(Serializer &rdser, const TagsPath &path, size_t level, KeyValueType expectedType, VariantArray &values) {
+	const int pathTag = path[level];
+	const bool isTarget = (level + 1 == path.size());
+	for (ctag tag = rdser.GetCTag(); tag != kCTagEnd; tag = rdser.GetCTag()) {
+		if (tag.Name() != pathTag) {
+			skipCjsonTag(tag, rdser);
+			continue;
+		}
+		if (tag.Field() >= 0) return false;
+		const TagType tagType = tag.Type();
+		switch (tagType) {
+			case TAG_OBJECT:
+				if (isTarget || !scanCjsonObject(rdser, path, level + 1, expectedType, values)) return false;
+				break;
+			case TAG_ARRAY: {
+				const carraytag atag = rdser.GetCArrayTag();
+				const TagType atagType = atag.Type();
+				if (atagType == TAG_OBJECT) return false;
+				if (isTarget) {
+					for (size_t i = 0, count = atag.Count(); i < count; ++i) {
+						putScannedValue(rdser.GetRawVariant(KeyValueType{atagType}), expectedType, values);
+					}
+					values.MarkArray();
+				} else {
+					skipCjsonArrayValues(atagType, atag.Count(), rdser);
+				}
+				break;
+			}
+			case TAG_VARINT:
+			case TAG_DOUBLE:
+			case TAG_STRING:
+			case TAG_BOOL:
+			case TAG_NULL:
+			case TAG_END:
+			case TAG_UUID:
+				if (isTarget) {
+					putScannedValue(rdser.GetRawVariant(KeyValueType{tagType}), expectedType, values);
+				} else {
+					rdser.SkipRawVariant(KeyValueType{tagType});
+				}
+				break;
+		}
+	}
+	return true;
+}
+
+bool scanCjsonPath(std::string_view tuple, const TagsPath &path, KeyValueType expectedType, VariantArray &values) {
+	if (path.empty()) return false;
+	Serializer rdser(tuple);
+	if (rdser.Eof()) return true;
+	if (rdser.GetCTag().Type() != TAG_OBJECT) return false;
+	return scanCjsonObject(rdser, path, 0, expectedType, values);
+}
+
 Variant cjsonValueToVariant(TagType tagType, Serializer &rdser, KeyValueType dstType) {
 	return rdser
 		.GetRawVariant(dstType.Is<KeyValueType::Int>() && tagType == TAG_VARINT ? KeyValueType{KeyValueType::Int{}} : KeyValueType{tagType})
@@ -15,6 +15,11 @@ void putCJsonValue(TagType tagType, int tagName, const VariantArray &values, WrS
 
 [[nodiscard]] TagType kvType2Tag(KeyValueType kvType) noexcept;
 void skipCjsonTag(ctag tag, Serializer &rdser, std::array<unsigned, kMaxIndexes> *fieldsArrayOffsets = nullptr);
+void skipCjsonArrayValues(TagType elemType, size_t count, Serializer &rdser);
+// Extracts values of the non-indexed field from the tuple without the encoder: subtrees outside of the path are skipped tag by tag
+// and arrays of scalars are skipped as a whole. Returns false, if the path goes through the indexed field or the array of objects or
+// points to the object. Such values have to be extracted by the encoder
+[[nodiscard]] bool scanCjsonPath(std::string_view tuple, const TagsPath &path, KeyValueType expectedType, VariantArray &values);
 [[nodiscard]] Variant cjsonValueToVariant(TagType tag, Serializer &rdser, KeyValueType dstType);
 
 [[noreturn]] void throwUnexpectedNestedArrayError(std::string_view parserName, const PayloadFieldType &f);
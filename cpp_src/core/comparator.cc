@@ -82,6 +82,42 @@ void Comparator::Bind(const PayloadType &type, int field) {
 	}
 }
 
+void Comparator::BindDictionary(const StringDictionary &dict, const VariantArray &values) {
+	if ((cond_ != CondEq && cond_ != CondSet) || isArray_ || fields_.getTagsPathsLength() > 0 || !type_.Is<KeyValueType::String>()) {
+		return;
+	}
+	dictValues_ = dict.Encode(values);
+	dictCodes_ = dict.Codes();
+	dictRowsCount_ = dict.RowsCount();
+}
+
+void Comparator::BindSparseColumn(const SparseColumnView &column) noexcept {
+	if (!column.Valid() || isArray_ || fields_.getTagsPathsLength() == 0 || !column.type.IsSame(type_)) {
+		return;
+	}
+	switch (cond_) {
+		case CondDWithin:
+		case CondLike:
+			return;
+		case CondEq:
+		case CondLt:
+		case CondLe:
+		case CondGt:
+		case CondGe:
+		case CondRange:
+		case CondSet:
+		case CondAllSet:
+		case CondAny:
+		case CondEmpty:
+			break;
+	}
+	// Numeric comparison with string values is not allowed (see isNumericComparison())
+	if (valuesType_.Is<KeyValueType::String>()) {
+		return;
+	}
+	sparseColumn_ = column;
+}
+
 bool Comparator::isNumericComparison(const VariantArray &values) const {
 	if (valuesType_.Is<KeyValueType::Undefined>() || values.empty()) return false;
 	const KeyValueType keyType{values.front().Type()};
@@ -100,6 +136,11 @@ bool Comparator::Compare(const PayloadValue &data, int rowId) {
 		// Special case: compare by composite condition. Pass pointer to PayloadValue
 		if (type_.Is<KeyValueType::Composite>()) return compare(&data);
 
+		// Dictionary encoded string column: compare codes without access to the payload's strings
+		if (dictCodes_) {
+			return compareDictCode(size_t(rowId) < dictRowsCount_ ? dictCodes_[rowId] : StringDictionary::kEmptyCode);
+		}
+
 		// Check if we have column (rawData_), then go to fastest path with column
 		if (rawData_) return compare(rawData_ + rowId * sizeof_);
 
@@ -137,6 +178,20 @@ bool Comparator::Compare(const PayloadValue &data, int rowId) {
 			if (compare(ptr)) return true;
 		}
 	} else {
+		// Materialized column of the sparse index: scalar value is read without tuple decoding
+		if (sparseColumn_.Valid()) {
+			switch (sparseColumn_.GetState(rowId)) {
+				case SparseColumnView::Empty:
+					return cond_ == CondEmpty;
+				case SparseColumnView::Value:
+					if (cond_ == CondEmpty) return false;
+					if (cond_ == CondAny) return true;
+					if (cond_ == CondAllSet) clearAllSetValues();
+					return compare(sparseColumn_.Ptr(rowId));
+				case SparseColumnView::Tuple:
+					break;
+			}
+		}
 		VariantArray rhs;
 		ConstPayload(payloadType_, data).GetByJsonPath(fields_.getTagsPath(0), rhs, type_);
 		if (isNumericComparison(rhs)) {
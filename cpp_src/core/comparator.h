@@ -2,6 +2,8 @@
 
 #include "comparatorimpl.h"
 #include "compositearraycomparator.h"
+#include "core/index/sparsecolumn.h"
+#include "core/index/string_dictionary.h"
 
 namespace reindexer {
 
@@ -15,6 +17,10 @@ public:
 	bool Compare(const PayloadValue &lhs, int rowId);
 	void ExcludeDistinct(const PayloadValue &, int rowId);
 	void Bind(const PayloadType &type, int field);
+	// Switch Eq/Set conditions to comparison of the dictionary codes column instead of strings from payload
+	void BindDictionary(const StringDictionary &dict, const VariantArray &values);
+	// Read scalar values of the sparse index from the column instead of the tuple decoding
+	void BindSparseColumn(const SparseColumnView &column) noexcept;
 	template <typename F>
 	void BindEqualPosition(F &&field, const VariantArray &val, CondType cond) {
 		cmpEqualPosition.BindField(std::forward<F>(field), val, cond);
@@ -29,8 +35,20 @@ public:
 		cmpUuid.ClearDistinct();
 	}
 	bool HasJsonPaths() const noexcept { return fields_.getTagsPathsLength(); }
+	// Values are read from the index's column (or dictionary codes) by rowId without access to the payload
+	bool ReadsColumnOnly() const noexcept {
+		return !HasJsonPaths() && !cmpEqualPosition.IsBinded() && !type_.Is<KeyValueType::Composite>() && (dictCodes_ || rawData_);
+	}
 
 private:
+	bool compareDictCode(StringDictionary::CodeT code) const noexcept {
+		if (code == StringDictionary::kEmptyCode) return false;
+		if (dictValues_.size() <= 8) {
+			return std::find(dictValues_.begin(), dictValues_.end(), code) != dictValues_.end();
+		}
+		return std::binary_search(dictValues_.begin(), dictValues_.end(), code);
+	}
+
 	bool compare(const Variant &kr) {
 		return kr.Type().EvaluateOneOf(
 			[&](KeyValueType::Null) noexcept { return cond_ == CondEmpty; },
@@ -120,6 +138,10 @@ private:
 	ComparatorImpl<Uuid> cmpUuid;
 	EqualPositionComparator cmpEqualPosition;
 	KeyValueType valuesType_{KeyValueType::Undefined{}};
+	const StringDictionary::CodeT *dictCodes_ = nullptr;
+	size_t dictRowsCount_ = 0;
+	h_vector<StringDictionary::CodeT, 4> dictValues_;
+	SparseColumnView sparseColumn_;
 };
 
 }  // namespace reindexer
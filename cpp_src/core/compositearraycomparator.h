@@ -12,7 +12,7 @@ public:
 	void BindField(int field, const VariantArray &, CondType);
 	void BindField(const FieldsPath &, const VariantArray &, CondType);
 	bool Compare(const PayloadValue &, const ComparatorVars &);
-	bool IsBinded() { return !ctx_.empty(); }
+	bool IsBinded() const noexcept { return !ctx_.empty(); }
 
 private:
 	bool compareField(size_t field, const Variant &, const ComparatorVars &);
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "core/lrucache.h"
+#include "estl/h_vector.h"
+
+namespace reindexer {
+
+/// Shape of the query entries, which may be substituted by the composite indexes: positions (relative to the beginning of the bracket),
+/// indexes and values counts of the candidate entries. Values themselves are not the part of the key, so the executions of the same
+/// prepared query share the key
+class CompositeSubstitutionKey {
+public:
+	struct Entry {
+		uint16_t position;
+		int field;
+		uint32_t valuesCount;
+	};
+
+	void Add(uint16_t position, int field, uint32_t valuesCount) { entries_.emplace_back(Entry{position, field, valuesCount}); }
+	bool Empty() const noexcept { return entries_.empty(); }
+	const h_vector<Entry, 8> &Entries() const noexcept { return entries_; }
+	size_t Size() const noexcept { return sizeof(CompositeSubstitutionKey) + (entries_.is_hdata() ? 0 : entries_.size() * sizeof(Entry)); }
+
+private:
+	h_vector<Entry, 8> entries_;
+};
+
+struct EqCompositeSubstitutionKey {
+	bool operator()(const CompositeSubstitutionKey &lhs, const CompositeSubstitutionKey &rhs) const noexcept {
+		const auto &l = lhs.Entries();
+		const auto &r = rhs.Entries();
+		if (l.size() != r.size()) return false;
+		for (size_t i = 0, s = l.size(); i < s; ++i) {
+			if (l[i].position != r[i].position || l[i].field != r[i].field || l[i].valuesCount != r[i].valuesCount) return false;
+		}
+		return true;
+	}
+};
+
+struct HashCompositeSubstitutionKey {
+	size_t operator()(const CompositeSubstitutionKey &k) const noexcept {
+		size_t hash = k.Entries().size();
+		for (const auto &e : k.Entries()) {
+			hash = (hash * 127) ^ ((size_t(e.position) << 48) | (size_t(uint32_t(e.field)) << 16) | e.valuesCount);
+		}
+		return hash;
+	}
+};
+
+/// Composite indexes substitutions chosen for the key's shape: index number and positions (relative to the beginning of the bracket)
+/// of the substituted entries
+struct CompositeSubstitutionPlan {
+	struct Substitution {
+		int idx;
+		h_vector<uint16_t, 8> entries;
+	};
+
+	size_t Size() const noexcept {
+		size_t size = substitutions.is_hdata() ? 0 : substitutions.capacity() * sizeof(Substitution);
+		for (const auto &s : substitutions) size += s.entries.is_hdata() ? 0 : s.entries.capacity() * sizeof(uint16_t);
+		return size;
+	}
+
+	h_vector<Substitution, 2> substitutions;
+	bool inited = false;
+};
+
+/// Per-namespace cache of the composite substitution plans. Plans depend on the namespace's indexes only, so the cache is cleared
+/// on the indexes and schema changes, but not on the items updates
+class CompositeSubstitutionCache
+	: public LRUCache<CompositeSubstitutionKey, CompositeSubstitutionPlan, HashCompositeSubstitutionKey, EqCompositeSubstitutionKey> {
+public:
+	constexpr static size_t kDefaultCacheSizeLimit = 1024 * 1024;
+	constexpr static uint32_t kDefaultHitCountToCache = 2;
+
+	CompositeSubstitutionCache() noexcept : LRUCache(kDefaultCacheSizeLimit, kDefaultHitCountToCache) {}
+};
+
+}  // namespace reindexer
@@ -20,6 +20,14 @@ static CacheMode str2cacheMode(std::string_view mode) {
 	throw Error(errParams, "Unknown cache mode %s", mode);
 }
 
+static TuplesCompression str2tuplesCompression(std::string_view mode) {
+	using namespace std::string_view_literals;
+	if (mode == "none"sv || mode == ""sv) return TuplesCompression::None;
+	if (mode == "snappy"sv) return TuplesCompression::Snappy;
+
+	throw Error(errParams, "Unknown tuples compression mode %s", mode);
+}
+
 Error DBConfigProvider::FromJSON(const gason::JsonNode &root) {
 	try {
 		smart_lock<shared_timed_mutex> lk(mtx_, true);
@@ -32,6 +40,8 @@ Error DBConfigProvider::FromJSON(const gason::JsonNode &root) {
 			profilingData_.perfStats = profilingNode["perfstats"].As<bool>();
 			profilingData_.memStats = profilingNode["memstats"].As<bool>();
 			profilingData_.activityStats = profilingNode["activitystats"].As<bool>();
+			profilingData_.queryMemoryLimit = profilingNode["query_memory_limit"].As<size_t>(0);
+			profilingData_.totalQueriesMemoryLimit = profilingNode["total_queries_memory_limit"].As<size_t>(0);
 			if (!profilingNode["long_queries_logging"].empty()) {
 				profilingData_.longSelectLoggingParams.store(
 					LongQueriesLoggingParams{profilingNode["long_queries_logging"]["select"]["threshold_us"].As<int32_t>(),
@@ -61,8 +71,13 @@ Error DBConfigProvider::FromJSON(const gason::JsonNode &root) {
 				data.startCopyPolicyTxSize = nsNode["start_copy_policy_tx_size"].As<int>(data.startCopyPolicyTxSize);
 				data.copyPolicyMultiplier = nsNode["copy_policy_multiplier"].As<int>(data.copyPolicyMultiplier);
 				data.txSizeToAlwaysCopy = nsNode["tx_size_to_always_copy"].As<int>(data.txSizeToAlwaysCopy);
+				data.copyPolicyForQueries = nsNode["copy_policy_for_queries"].As<bool>(data.copyPolicyForQueries);
+				data.updDelChunkSize = nsNode["upd_del_chunk_size"].As<int64_t>(data.updDelChunkSize, 0);
+				data.txIndexInsertionThreads = nsNode["tx_index_insertion_threads"].As<int>(data.txIndexInsertionThreads, 0, 64);
+				data.txItemsSpillThreshold = nsNode["tx_items_spill_threshold"].As<int64_t>(data.txItemsSpillThreshold, 0);
 				data.optimizationTimeout = nsNode["optimization_timeout_ms"].As<int>(data.optimizationTimeout);
 				data.optimizationSortWorkers = nsNode["optimization_sort_workers"].As<int>(data.optimizationSortWorkers);
+				data.ftCommitDebounce = nsNode["ft_commit_debounce_ms"].As<int>(data.ftCommitDebounce, 0);
 				int64_t walSize = nsNode["wal_size"].As<int64_t>(0);
 				if (walSize > 0) {
 					data.walSize = walSize;
@@ -72,6 +87,10 @@ Error DBConfigProvider::FromJSON(const gason::JsonNode &root) {
 				data.maxPreselectPart = nsNode["max_preselect_part"].As<double>(data.maxPreselectPart, 0.0, 1.0);
 				data.idxUpdatesCountingMode = nsNode["index_updates_counting_mode"].As<bool>(data.idxUpdatesCountingMode);
 				data.syncStorageFlushLimit = nsNode["sync_storage_flush_limit"].As<int>(data.syncStorageFlushLimit, 0);
+				data.tuplesCompression = str2tuplesCompression(nsNode["tuples_compression"].As<std::string_view>("none"));
+				data.tuplesCompressionMinSize =
+					nsNode["tuples_compression_min_size"].As<int64_t>(data.tuplesCompressionMinSize, 0);
+				data.payloadArena = nsNode["payload_arena"].As<bool>(data.payloadArena);
 
 				auto cacheConfig = nsNode["cache"];
 				if (!cacheConfig.empty()) {
@@ -90,6 +109,7 @@ Error DBConfigProvider::FromJSON(const gason::JsonNode &root) {
 						cacheConfig["query_count_cache_size"].As<size_t>(data.cacheConfig.queryCountCacheSize, 0);
 					data.cacheConfig.queryCountHitsToCache =
 						cacheConfig["query_count_hit_to_cache"].As<size_t>(data.cacheConfig.queryCountHitsToCache, 0);
+					data.cacheConfig.tuplesCacheSize = cacheConfig["tuples_cache_size"].As<size_t>(data.cacheConfig.tuplesCacheSize, 0);
 				}
 
 				namespacesData_.emplace(nsNode["namespace"].As<std::string>(), std::move(data));  // NOLINT(performance-move-const-arg)
@@ -55,6 +55,8 @@ public:
 		perfStats.store(d.perfStats, std::memory_order_relaxed);
 		memStats.store(d.memStats, std::memory_order_relaxed);
 		activityStats.store(d.activityStats, std::memory_order_relaxed);
+		queryMemoryLimit.store(d.queryMemoryLimit, std::memory_order_relaxed);
+		totalQueriesMemoryLimit.store(d.totalQueriesMemoryLimit, std::memory_order_relaxed);
 		longSelectLoggingParams.store(d.longSelectLoggingParams, std::memory_order_relaxed);
 		longUpdDelLoggingParams.store(d.longUpdDelLoggingParams, std::memory_order_relaxed);
 		longTxLoggingParams.store(d.longTxLoggingParams, std::memory_order_relaxed);
@@ -66,11 +68,16 @@ public:
 	std::atomic<bool> perfStats = {false};
 	std::atomic<bool> memStats = {false};
 	std::atomic<bool> activityStats = {false};
+	// Memory limits for the selects' intermediate and final results in bytes (0 - unlimited)
+	std::atomic<size_t> queryMemoryLimit = {0};
+	std::atomic<size_t> totalQueriesMemoryLimit = {0};
 	std::atomic<LongQueriesLoggingParams> longSelectLoggingParams;
 	std::atomic<LongQueriesLoggingParams> longUpdDelLoggingParams;
 	std::atomic<LongTxLoggingParams> longTxLoggingParams;
 };
 
+enum class TuplesCompression { None, Snappy };
+
 constexpr size_t kDefaultCacheSizeLimit = 1024 * 1024 * 128;
 constexpr uint32_t kDefaultHitCountToCache = 2;
 
@@ -94,6 +101,7 @@ struct NamespaceCacheConfigData {
 	uint32_t joinHitsToCache = kDefaultHitCountToCache;
 	uint64_t queryCountCacheSize = kDefaultCacheSizeLimit;
 	uint32_t queryCountHitsToCache = kDefaultHitCountToCache;
+	uint64_t tuplesCacheSize = kDefaultCacheSizeLimit / 16;
 };
 
 struct NamespaceConfigData {
@@ -105,14 +113,22 @@ struct NamespaceConfigData {
 	int startCopyPolicyTxSize = 10000;
 	int copyPolicyMultiplier = 5;
 	int txSizeToAlwaysCopy = 100000;
+	bool copyPolicyForQueries = false;
+	int64_t updDelChunkSize = 0;
+	int txIndexInsertionThreads = 4;
+	int64_t txItemsSpillThreshold = 0;
 	int optimizationTimeout = 800;
 	int optimizationSortWorkers = 4;
+	int ftCommitDebounce = 0;
 	int64_t walSize = 4000000;
 	int64_t minPreselectSize = 1000;
 	int64_t maxPreselectSize = 1000;
 	double maxPreselectPart = 0.1;
 	bool idxUpdatesCountingMode = false;
 	int syncStorageFlushLimit = 20000;
+	TuplesCompression tuplesCompression = TuplesCompression::None;
+	int64_t tuplesCompressionMinSize = 256;
+	bool payloadArena = false;
 	NamespaceCacheConfigData cacheConfig;
 };
 
@@ -178,6 +194,8 @@ public:
 	bool PerfStatsEnabled() const noexcept { return profilingData_.perfStats.load(std::memory_order_relaxed); }
 	bool QueriesPerfStatsEnabled() const noexcept { return profilingData_.queriesPerfStats.load(std::memory_order_relaxed); }
 	unsigned QueriesThresholdUS() const noexcept { return profilingData_.queriesThresholdUS.load(std::memory_order_relaxed); }
+	size_t QueryMemoryLimit() const noexcept { return profilingData_.queryMemoryLimit.load(std::memory_order_relaxed); }
+	size_t TotalQueriesMemoryLimit() const noexcept { return profilingData_.totalQueriesMemoryLimit.load(std::memory_order_relaxed); }
 
 private:
 	ProfilingConfigData profilingData_;
@@ -11,6 +11,7 @@ constexpr char kNamespacesNamespace[] = "#namespaces";
 constexpr char kConfigNamespace[] = "#config";
 constexpr char kActivityStatsNamespace[] = "#activitystats";
 constexpr char kClientsStatsNamespace[] = "#clientsstats";
+constexpr char kSchedulerStatsNamespace[] = "#schedulerstats";
 constexpr char kNsNameField[] = "name";
 const std::vector<std::string> kDefDBConfig = {
 	R"json({
@@ -21,6 +22,8 @@ const std::vector<std::string> kDefDBConfig = {
 			"perfstats":false,
 			"memstats":true,
 			"activitystats":false,
+			"query_memory_limit":0,
+			"total_queries_memory_limit":0,
 			"long_queries_logging":{
 				"select":{
 					"threshold_us": -1,
@@ -49,14 +52,22 @@ const std::vector<std::string> kDefDBConfig = {
 				"start_copy_policy_tx_size":10000,
 				"copy_policy_multiplier":5,
 				"tx_size_to_always_copy":100000,
+				"copy_policy_for_queries":false,
+				"upd_del_chunk_size":0,
+				"tx_index_insertion_threads":4,
+				"tx_items_spill_threshold":0,
 				"optimization_timeout_ms":800,
 				"optimization_sort_workers":4,
+				"ft_commit_debounce_ms":0,
 				"wal_size":4000000,
 				"min_preselect_size":1000,
 				"max_preselect_size":1000,
 				"max_preselect_part":0.1,
 				"index_updates_counting_mode":false,
 				"sync_storage_flush_limit":20000,
+				"tuples_compression":"none",
+				"tuples_compression_min_size":256,
+				"payload_arena":false,
 				"cache":{
 					"index_idset_cache_size":134217728,
 					"index_idset_hits_to_cache":2,
@@ -65,7 +76,8 @@ const std::vector<std::string> kDefDBConfig = {
 					"joins_preselect_cache_size":268435456,
 					"joins_preselect_hit_to_cache":2,
 					"query_count_cache_size":134217728,
-					"query_count_hit_to_cache":2
+					"query_count_hit_to_cache":2,
+					"tuples_cache_size":8388608
 				}
 			}
 		]
@@ -146,6 +158,10 @@ const std::vector<NamespaceDef> kSystemNsDefs = {
 		.AddIndex("join_cache.items_count", "-", "int64", IndexOpts().Dense())
 		.AddIndex("join_cache.empty_count", "-", "int64", IndexOpts().Dense())
 		.AddIndex("join_cache.hit_count_limit", "-", "int64", IndexOpts().Dense()),
+	NamespaceDef(kSchedulerStatsNamespace, StorageOpts())
+		.AddIndex(kNsNameField, "hash", "string", IndexOpts().PK())
+		.AddIndex("threads_count", "-", "int64", IndexOpts().Dense())
+		.AddIndex("busy_threads", "-", "int64", IndexOpts().Dense()),
 	NamespaceDef(kClientsStatsNamespace, StorageOpts())
 		.AddIndex("connection_id", "hash", "int", IndexOpts().PK())
 		.AddIndex("ip", "-", "string", IndexOpts().Dense())
@@ -3,6 +3,7 @@
 #include <thread>
 #include "core/ft/numtotext.h"
 #include "core/ft/typos.h"
+#include "core/taskscheduler.h"
 
 #include "tools/clock.h"
 #include "tools/logger.h"
@@ -68,7 +69,6 @@ void DataProcessor<IdCont>::Process(bool multithread) {
 			exwr.SetException(std::current_exception());
 		}
 	};
-	std::thread sufBuildThread(sufBuildFun);
 	// Step 5: Normalize and sort idrelsets. It runs in parallel with next step
 	size_t idsetcnt = 0;
 
@@ -102,11 +102,9 @@ void DataProcessor<IdCont>::Process(bool multithread) {
 		}
 	};
 
-	std::thread idrelsetCommitThread(idrelsetCommitFun);
-
-	// Wait for suf array build. It is neccessary for typos
-	sufBuildThread.join();
-	idrelsetCommitThread.join();
+	// Run steps 4 and 5 and wait for suf array build. It is neccessary for typos
+	TaskScheduler::Instance().ParallelFor(TaskScheduler::Priority::FtRebuild, 2,
+										  [&sufBuildFun, &idrelsetCommitFun](size_t i) { i ? idrelsetCommitFun() : sufBuildFun(); });
 	exwr.RethrowException();
 
 	// Step 6: Build typos hash map
@@ -172,7 +170,6 @@ size_t DataProcessor<IdCont>::buildWordsMap(words_map &words_um, bool multithrea
 	size_t szCnt = 0;
 	struct context {
 		words_map words_um;
-		std::thread thread;
 	};
 	std::unique_ptr<context[]> ctxs(new context[maxIndexWorkers]);
 
@@ -229,16 +226,12 @@ size_t DataProcessor<IdCont>::buildWordsMap(words_map &words_um, bool multithrea
 		}
 	};
 
-	for (uint32_t t = 1; t < maxIndexWorkers; ++t) {
-		ctxs[t].thread = std::thread(worker, t);
-	}
+	TaskScheduler::Instance().ParallelFor(TaskScheduler::Priority::FtRebuild, maxIndexWorkers, worker);
 	// If there was only 1 build thread. Just return it's build results
-	worker(0);
 	words_um = std::move(ctxs[0].words_um);
 	// Merge results into single map
 	for (uint32_t i = 1; i < maxIndexWorkers; ++i) {
 		auto &ctx = ctxs[i];
-		ctx.thread.join();
 		if (exwr.HasException()) {
 			continue;
 		}
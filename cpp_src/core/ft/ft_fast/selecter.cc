@@ -1,6 +1,7 @@
 #include "selecter.h"
 #include "core/ft/bm25.h"
 #include "core/ft/typos.h"
+#include "core/querymemorytracker.h"
 #include "core/rdxcontext.h"
 #include "estl/defines.h"
 #include "sort/pdqsort.hpp"
@@ -1286,11 +1287,17 @@ MergeData Selecter<IdCont>::mergeResults(std::vector<TextSearchResults>&& rawRes
 		idoffsets.resize(vdocs.size());
 		merged_rd.reserve(maxMergedSize);
 	}
+	QueryMemoryTracker::Scope memoryScope(rdxCtx.MemoryTracker(), &merged);
+	const auto updateMemoryUsage = [&] {
+		memoryScope.Update(merged.capacity() * sizeof(MergeInfo) + merged.vectorAreas.capacity() * sizeof(AreaHolder) +
+						   merged_rd.capacity() * sizeof(MergedIdRel) + idoffsets.capacity() * sizeof(MergedOffsetT));
+	};
 	std::vector<std::vector<bool>> exists(synonymsBounds.size() + 1);
 	size_t curExists = 0;
 	auto nextSynonymsBound = synonymsBounds.cbegin();
 	bool hasBeenAnd = false;
 	for (index_t i = 0, lastGroupStart = 0; i < rawResults.size(); ++i) {
+		updateMemoryUsage();
 		if (rawResults[i].term.opts.groupNum != -1) {
 			size_t k = i;
 			OpType op = rawResults[i].term.opts.op;
@@ -1349,6 +1356,7 @@ MergeData Selecter<IdCont>::mergeResults(std::vector<TextSearchResults>&& rawRes
 			}
 		}
 	}
+	updateMemoryUsage();
 	if rx_unlikely (holder_.cfg_->logLevel >= LogInfo) {
 		logPrintf(LogInfo, "Complex merge (%d patterns): out %d vids", rawResults.size(), merged.size());
 	}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include "core/index/index.h"
+
+namespace reindexer {
+
+/// Copy of the fulltext index, which is built without the namespace's lock (see Index::BeginBackgroundBuild()).
+/// Source index cancels the build on any modification, so the built copy always contains the same data as the source index
+class FtBackgroundBuild {
+public:
+	explicit FtBackgroundBuild(std::unique_ptr<Index> &&copy) noexcept : copy_{std::move(copy)} {}
+
+	/// Copy may be accessed by the builder only until Finish()
+	Index &Copy() const noexcept { return *copy_; }
+	bool IsCancelled() const noexcept { return cancelled_.load(std::memory_order_acquire); }
+	void Cancel() noexcept { cancelled_.store(true, std::memory_order_release); }
+	/// Has to be called by the builder in any case (even if the copy was not built)
+	void Finish() {
+		std::lock_guard lck(mtx_);
+		done_ = true;
+		cv_.notify_all();
+	}
+	/// Waits for the builder. Returns the built copy or nullptr, if the build has failed or was cancelled
+	std::unique_ptr<Index> Wait() {
+		std::unique_lock lck(mtx_);
+		cv_.wait(lck, [this] { return done_; });
+		if (IsCancelled() || !copy_ || !copy_->IsBuilt()) return nullptr;
+		return std::move(copy_);
+	}
+
+private:
+	std::unique_ptr<Index> copy_;
+	std::atomic<bool> cancelled_{false};
+	bool done_ = false;
+	std::mutex mtx_;
+	std::condition_variable cv_;
+};
+
+}  // namespace reindexer
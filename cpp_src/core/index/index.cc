@@ -29,6 +29,25 @@ Index::Index(const Index& obj)
 
 std::unique_ptr<Index> Index::New(const IndexDef& idef, PayloadType&& payloadType, FieldsSet&& fields,
 								  const NamespaceCacheConfigData& cacheCfg) {
+	if (idef.opts_.IsDictionary()) {
+		const auto type = idef.Type();
+		if ((type != IndexStrHash && type != IndexStrBTree && type != IndexStrStore) || idef.opts_.IsArray() || idef.opts_.IsSparse()) {
+			throw Error(errParams, "Dictionary encoding is supported only for non-array and non-sparse string indexes. Index: '%s'",
+						idef.name_);
+		}
+	}
+	if (idef.opts_.IsColumn()) {
+		const auto type = idef.Type();
+		const bool storeType = type == IndexIntStore || type == IndexInt64Store || type == IndexDoubleStore || type == IndexBool;
+		const bool numericType = storeType || type == IndexIntHash || type == IndexInt64Hash || type == IndexIntBTree ||
+								 type == IndexInt64BTree || type == IndexDoubleBTree;
+		if (!numericType || idef.opts_.IsArray() || idef.opts_.IsDense() || (idef.opts_.IsSparse() && !storeType)) {
+			throw Error(errParams,
+						"Column option is supported only for non-array and non-dense numeric or bool indexes (sparse index must have "
+						"'-' type). Index: '%s'",
+						idef.name_);
+		}
+	}
 	switch (idef.Type()) {
 		case IndexStrBTree:
 		case IndexIntBTree:
@@ -64,6 +83,12 @@ std::unique_ptr<Index> Index::New(const IndexDef& idef, PayloadType&& payloadTyp
 	throw Error(errParams, "Ivalid index type %d for index '%s'", idef.Type(), idef.name_);
 }
 
+void Index::BulkUpsert(BulkUpsertKeys& keys, bool& clearCache) {
+	for (const auto& [key, id] : keys) {
+		Upsert(key, id, clearCache);
+	}
+}
+
 template <typename S>
 void Index::dump(S& os, std::string_view step, std::string_view offset) const {
 	std::string newOffset{offset};
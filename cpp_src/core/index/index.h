@@ -2,6 +2,7 @@
 
 #include <bitset>
 #include <limits>
+#include <optional>
 #include <vector>
 #include "core/idset.h"
 #include "core/index/keyentry.h"
@@ -13,13 +14,16 @@
 #include "core/perfstatcounter.h"
 #include "core/selectkeyresult.h"
 #include "ft_preselect.h"
+#include "indexcolumn.h"
 #include "indexiterator.h"
+#include "sparsecolumn.h"
 
 namespace reindexer {
 
 class RdxContext;
 class StringsHolder;
 class SelectFunction;
+class FtBackgroundBuild;
 
 class Index {
 public:
@@ -44,6 +48,8 @@ public:
 	};
 	using KeyEntry = reindexer::KeyEntry<IdSet>;
 	using KeyEntryPlain = reindexer::KeyEntry<IdSetPlain>;
+	// Keys of the several items for the bulk insertion: pairs of the key and the item's rowId
+	using BulkUpsertKeys = std::vector<std::pair<Variant, IdType>>;
 
 	Index(const IndexDef& idef, PayloadType&& payloadType, FieldsSet&& fields);
 	Index(const Index&);
@@ -51,6 +57,10 @@ public:
 	virtual ~Index() = default;
 	virtual Variant Upsert(const Variant& key, IdType id, bool& clearCache) = 0;
 	virtual void Upsert(VariantArray& result, const VariantArray& keys, IdType id, bool& clearCache) = 0;
+	// Same as Upsert(key, id) for each pair, but allows index to reorder insertions. Keys refs are not returned, so this method
+	// may be used only for the values, which are not stored in the payload (sparse and composite indexes) or for the indexes, which
+	// refs are equal to the keys (see IsPayloadBulkUpsertable()). Keys may be reordered
+	virtual void BulkUpsert(BulkUpsertKeys& keys, bool& clearCache);
 	virtual void Delete(const Variant& key, IdType id, StringsHolder&, bool& clearCache) = 0;
 	virtual void Delete(const VariantArray& keys, IdType id, StringsHolder&, bool& clearCache) = 0;
 
@@ -65,17 +75,33 @@ public:
 	// NOLINTEND(*-unnecessary-value-param)
 	virtual void Commit() = 0;
 	virtual void CommitFulltext() {}
+	// Rebuilds the fulltext index under the index's lock, if it was modified after the last build
+	virtual void BuildFulltext(const RdxContext&) {}
 	virtual void MakeSortOrders(UpdateSortedContext&) {}
 
 	virtual void UpdateSortedIds(const UpdateSortedContext& ctx) = 0;
 	virtual size_t Size() const noexcept { return 0; }
 	virtual std::unique_ptr<Index> Clone() const = 0;
+	// Starts the background build of the fulltext index: the index's copy is built without the namespace's lock. Queries to the index
+	// wait for the copy instead of building the index themselves. Returns nullptr, if the index does not support the background build
+	virtual std::shared_ptr<FtBackgroundBuild> BeginBackgroundBuild() { return nullptr; }
+	// Moves the data of the built copy into the index. Returns the replaced data, which may be destroyed without the namespace's lock
+	virtual std::unique_ptr<Index> EndBackgroundBuild(const std::shared_ptr<FtBackgroundBuild>&) { return nullptr; }
 	virtual bool IsOrdered() const noexcept { return false; }
+	// Refs of the numeric ordered index are equal to its keys, so payload values may be set directly and the index may be filled via
+	// BulkUpsert
+	bool IsPayloadBulkUpsertable() const noexcept { return IsOrdered() && !opts_.IsSparse() && keyType_.IsNumeric(); }
 	virtual bool IsFulltext() const noexcept { return false; }
 	virtual bool IsUuid() const noexcept { return false; }
+	// Dense column with the values of the sparse index. Exists only for the indexes with 'column' option
+	virtual SparseColumnView SparseColumn() const noexcept { return {}; }
+	// Dense column with the values of the non-sparse scalar index. Exists only for the indexes with 'column' option
+	virtual IndexColumnView Column() const noexcept { return {}; }
 	virtual IndexMemStat GetMemStat(const RdxContext&) = 0;
 	virtual int64_t GetTTLValue() const noexcept { return 0; }
 	virtual IndexIterator::Ptr CreateIterator() const { return nullptr; }
+	// Distance from the point to the farthest of the 'count' nearest items. Available for the geometry indexes only
+	virtual std::optional<double> NearestItemsDistance(Point, size_t /*count*/) const { return std::nullopt; }
 	virtual bool RequireWarmupOnNsCopy() const noexcept { return false; }
 
 	virtual bool IsDestroyPartSupported() const noexcept { return false; }
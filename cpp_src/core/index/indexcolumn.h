@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "core/type_consts.h"
+
+namespace reindexer {
+
+// Read-only view of the dense column with the values of the non-sparse scalar index ('is_column' option).
+// Values are stored by rowId in the same binary form as in the payload's field, so they can be read without access to the payload.
+struct IndexColumnView {
+	bool Valid() const noexcept { return elemSize; }
+	bool Contains(IdType rowId) const noexcept { return size_t(rowId) < rowsCount; }
+	const void *Ptr(IdType rowId) const noexcept { return data + size_t(rowId) * elemSize; }
+
+	const uint8_t *data = nullptr;
+	size_t rowsCount = 0;
+	size_t elemSize = 0;
+};
+
+}  // namespace reindexer
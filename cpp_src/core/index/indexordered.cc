@@ -2,14 +2,42 @@
 #include "indexordered.h"
 #include "core/nsselecter/btreeindexiterator.h"
 #include "core/rdxcontext.h"
+#include "core/taskscheduler.h"
 #include "tools/errors.h"
 #include "tools/logger.h"
 
 namespace reindexer {
 
+constexpr size_t kMinBulkSortChunk = 64 * 1024;
+
+// Sorts chunks in parallel on the task scheduler and then merges them pairwise
+template <typename It, typename Compare>
+static void parallelSort(It begin, It end, const Compare &comp) {
+	const size_t size = end - begin;
+	const size_t chunks = std::min(TaskScheduler::Instance().ThreadsCount() + 1, size / kMinBulkSortChunk);
+	if (chunks <= 1) {
+		boost::sort::pdqsort(begin, end, comp);
+		return;
+	}
+	const auto bound = [&](size_t chunk) { return begin + std::min(size, chunk * ((size + chunks - 1) / chunks)); };
+	TaskScheduler::Instance().ParallelFor(TaskScheduler::Priority::Foreground, chunks,
+										  [&](size_t i) { boost::sort::pdqsort(bound(i), bound(i + 1), comp); });
+	for (size_t width = 1; width < chunks; width *= 2) {
+		const size_t merges = (chunks + 2 * width - 1) / (2 * width);
+		TaskScheduler::Instance().ParallelFor(TaskScheduler::Priority::Foreground, merges, [&](size_t i) {
+			const size_t first = 2 * width * i;
+			if (first + width < chunks) {
+				std::inplace_merge(bound(first), bound(first + width), bound(std::min(first + 2 * width, chunks)), comp);
+			}
+		});
+	}
+}
+
 template <typename T>
 Variant IndexOrdered<T>::Upsert(const Variant &key, IdType id, bool &clearCache) {
+	this->updateColumn(key, id);
 	if (key.Type().Is<KeyValueType::Null>()) {
+		this->resetDictionary(id);
 		if (this->empty_ids_.Unsorted().Add(id, IdSet::Auto, this->sortedIdxCount_)) {
 			this->cache_.reset();
 			clearCache = true;
@@ -37,10 +65,72 @@ Variant IndexOrdered<T>::Upsert(const Variant &key, IdType id, bool &clearCache)
 	if (this->KeyType().template Is<KeyValueType::String>() && this->opts_.GetCollateMode() != CollateNone) {
 		return IndexStore<StoreIndexKeyType<T>>::Upsert(key, id, clearCache);
 	}
+	this->updateDictionary(keyIt->first, id);
 
 	return Variant(keyIt->first);
 }
 
+template <typename T>
+void IndexOrdered<T>::BulkUpsert(Index::BulkUpsertKeys &keys, bool &clearCache) {
+	if (this->KeyType().template Is<KeyValueType::String>() && this->opts_.GetCollateMode() != CollateNone) {
+		// Collated strings are also stored in the IndexStore's map
+		Index::BulkUpsert(keys, clearCache);
+		return;
+	}
+	bool changed = false;
+	size_t notNullCount = 0;
+	for (auto &key : keys) {
+		this->updateColumn(key.first, key.second);
+		if (key.first.Type().template Is<KeyValueType::Null>()) {
+			this->resetDictionary(key.second);
+			changed |= this->empty_ids_.Unsorted().Add(key.second, IdSet::Auto, this->sortedIdxCount_);
+		} else {
+			if (&keys[notNullCount] != &key) keys[notNullCount] = std::move(key);
+			++notNullCount;
+		}
+	}
+	keys.erase(keys.begin() + notNullCount, keys.end());
+
+	// Sorted keys are inserted into the btree one after another and each key is looked up once for all of its ids
+	const auto keyComp = this->idx_map.key_comp();
+	parallelSort(keys.begin(), keys.end(), [&keyComp](const std::pair<Variant, IdType> &lhs, const std::pair<Variant, IdType> &rhs) {
+		const auto lhsRef = static_cast<ref_type>(lhs.first);
+		const auto rhsRef = static_cast<ref_type>(rhs.first);
+		if (keyComp(lhsRef, rhsRef)) return true;
+		if (keyComp(rhsRef, lhsRef)) return false;
+		return lhs.second < rhs.second;
+	});
+
+	const bool wasEmpty = this->idx_map.empty();
+	const auto editMode = this->opts_.IsPK() ? IdSet::Ordered : IdSet::Auto;
+	for (size_t i = 0, size = keys.size(); i < size;) {
+		const auto ref = static_cast<ref_type>(keys[i].first);
+		typename T::iterator keyIt;
+		if (wasEmpty) {
+			keyIt = this->idx_map.insert(this->idx_map.end(), {static_cast<key_type>(keys[i].first), typename T::mapped_type()});
+		} else {
+			keyIt = this->idx_map.lower_bound(ref);
+			if (keyIt == this->idx_map.end() || keyComp(ref, keyIt->first)) {
+				keyIt = this->idx_map.insert(keyIt, {static_cast<key_type>(keys[i].first), typename T::mapped_type()});
+			} else {
+				this->delMemStat(keyIt);
+			}
+		}
+		auto &ids = keyIt->second.Unsorted();
+		do {
+			changed |= ids.Add(keys[i].second, editMode, this->sortedIdxCount_);
+			this->updateDictionary(keyIt->first, keys[i].second);
+		} while (++i < size && !keyComp(ref, static_cast<ref_type>(keys[i].first)));
+		this->tracker_.markUpdated(this->idx_map, keyIt);
+		this->addMemStat(keyIt);
+	}
+	if (changed) {
+		this->isBuilt_ = false;
+		this->cache_.reset();
+		clearCache = true;
+	}
+}
+
 template <typename T>
 SelectKeyResults IndexOrdered<T>::SelectKey(const VariantArray &keys, CondType condition, SortType sortId, Index::SelectOpts opts,
 											const BaseFunctionCtx::Ptr &ctx, const RdxContext &rdxCtx) {
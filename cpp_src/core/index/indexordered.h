@@ -16,6 +16,7 @@ public:
 	SelectKeyResults SelectKey(const VariantArray &keys, CondType condition, SortType stype, Index::SelectOpts opts,
 							   const BaseFunctionCtx::Ptr &ctx, const RdxContext &) override;
 	Variant Upsert(const Variant &key, IdType id, bool &clearCache) override;
+	void BulkUpsert(Index::BulkUpsertKeys &keys, bool &clearCache) override;
 	void MakeSortOrders(UpdateSortedContext &ctx) override;
 	IndexIterator::Ptr CreateIterator() const override;
 	std::unique_ptr<Index> Clone() const override { return std::make_unique<IndexOrdered<T>>(*this); }
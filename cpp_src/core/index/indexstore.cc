@@ -15,6 +15,7 @@ IndexStore<Point>::IndexStore(const IndexDef &idef, PayloadType &&payloadType, F
 
 template <>
 void IndexStore<key_string>::Delete(const Variant &key, IdType id, StringsHolder &strHolder, bool & /*clearCache*/) {
+	resetDictionary(id);
 	if (key.Type().Is<KeyValueType::Null>()) return;
 	auto keyIt = str_map.find(std::string_view(key));
 	// assertf(keyIt != str_map.end(), "Delete unexists key from index '%s' id=%d", name_, id);
@@ -23,17 +24,17 @@ void IndexStore<key_string>::Delete(const Variant &key, IdType id, StringsHolder
 	if (!keyIt->second) {
 		const auto strSize = sizeof(*keyIt->first.get()) + keyIt->first->heap_size();
 		memStat_.dataSize -= sizeof(unordered_str_map<int>::value_type) + strSize;
+		updateTuplesStat(*keyIt->first, false);
 		strHolder.Add(std::move(keyIt->first), strSize);
 		str_map.template erase<no_deep_clean>(keyIt);
 	}
-
-	(void)id;
 }
 template <typename T>
 void IndexStore<T>::Delete(const Variant & /*key*/, IdType /* id */, StringsHolder &, bool & /*clearCache*/) {}
 
 template <typename T>
 void IndexStore<T>::Delete(const VariantArray &keys, IdType id, StringsHolder &strHolder, bool &clearCache) {
+	if (isSparseColumn()) setColumnState(id, SparseColumnView::Empty);
 	if (keys.empty()) {
 		Delete(Variant{}, id, strHolder, clearCache);
 	} else {
@@ -47,16 +48,25 @@ void IndexStore<Point>::Delete(const VariantArray & /*keys*/, IdType /*id*/, Str
 }
 
 template <>
-Variant IndexStore<key_string>::Upsert(const Variant &key, IdType /*id*/, bool & /*clearCache*/) {
-	if (key.Type().Is<KeyValueType::Null>()) return Variant();
+Variant IndexStore<key_string>::Upsert(const Variant &key, IdType id, bool & /*clearCache*/) {
+	if (key.Type().Is<KeyValueType::Null>()) {
+		resetDictionary(id);
+		return Variant();
+	}
 
-	auto keyIt = str_map.find(std::string_view(key));
+	// Tuple is stored in the compressed form, if it's enabled for the namespace. Already compressed tuples (e.g. on rollback) are stored as is
+	thread_local std::string compressedTuple;
+	TuplesCompressor *compressor = isTuplesIndex() && payloadType_.get() ? payloadType_->Compressor() : nullptr;
+	const bool compressed = compressor && compressor->Compress(std::string_view(key), compressedTuple);
+	auto keyIt = str_map.find(compressed ? std::string_view(compressedTuple) : std::string_view(key));
 	if (keyIt == str_map.end()) {
-		keyIt = str_map.emplace(static_cast<key_string>(key), 0).first;
+		keyIt = str_map.emplace(compressed ? make_key_string(std::string_view(compressedTuple)) : static_cast<key_string>(key), 0).first;
 		// sizeof(key_string) + heap of string
 		memStat_.dataSize += sizeof(unordered_str_map<int>::value_type) + sizeof(*keyIt->first.get()) + keyIt->first->heap_size();
+		updateTuplesStat(*keyIt->first, true);
 	}
 	++(keyIt->second);
+	updateDictionary(keyIt->first, id);
 
 	return Variant(keyIt->first);
 }
@@ -68,6 +78,19 @@ Variant IndexStore<PayloadValue>::Upsert(const Variant &key, IdType /*id*/, bool
 
 template <typename T>
 Variant IndexStore<T>::Upsert(const Variant &key, IdType id, bool & /*clearCache*/) {
+	if constexpr (std::is_arithmetic_v<T>) {
+		if (isSparseColumn()) {
+			key.Type().EvaluateOneOf(
+				[&](OneOf<KeyValueType::Int, KeyValueType::Int64, KeyValueType::Double, KeyValueType::Bool>) {
+					setColumnState(id, SparseColumnView::Value);
+					idx_data[id] = key.As<T>();
+				},
+				[&](KeyValueType::Null) { setColumnState(id, SparseColumnView::Empty); },
+				[&](OneOf<KeyValueType::String, KeyValueType::Uuid, KeyValueType::Composite, KeyValueType::Tuple,
+						  KeyValueType::Undefined>) { setColumnState(id, SparseColumnView::Tuple); });
+			return Variant(key);
+		}
+	}
 	if (!opts_.IsArray() && !opts_.IsDense() && !opts_.IsSparse() && !key.Type().Is<KeyValueType::Null>()) {
 		idx_data.resize(std::max(id + 1, IdType(idx_data.size())));
 		idx_data[id] = static_cast<T>(key);
@@ -82,6 +105,10 @@ void IndexStore<T>::Upsert(VariantArray &result, const VariantArray &keys, IdTyp
 	} else {
 		result.reserve(keys.size());
 		for (const auto &key : keys) result.emplace_back(Upsert(key, id, clearCache));
+		// Arrays and explicit nulls are not materialized in the column
+		if (isSparseColumn() && (keys.size() > 1 || keys[0].Type().Is<KeyValueType::Null>())) {
+			setColumnState(id, SparseColumnView::Tuple);
+		}
 	}
 }
 
@@ -108,6 +135,12 @@ SelectKeyResults IndexStore<T>::SelectKey(const VariantArray &keys, CondType con
 
 	res.comparators_.emplace_back(condition, KeyType(), keys, opts_.IsArray(), bool(sopts.distinct), payloadType_, Fields(),
 								  idx_data.size() ? idx_data.data() : nullptr, opts_.collateOpts_);
+	if (dict_ && !sopts.distinct) {
+		res.comparators_.back().BindDictionary(*dict_, keys);
+	}
+	if (isSparseColumn() && !sopts.distinct) {
+		res.comparators_.back().BindSparseColumn(SparseColumn());
+	}
 	return SelectKeyResults(std::move(res));
 }
 
@@ -116,7 +149,8 @@ IndexMemStat IndexStore<T>::GetMemStat(const RdxContext &) {
 	IndexMemStat ret = memStat_;
 	ret.name = name_;
 	ret.uniqKeysCount = str_map.size();
-	ret.columnSize = idx_data.capacity() * sizeof(T);
+	ret.columnSize = idx_data.capacity() * sizeof(T) + columnStates_.capacity();
+	if (dict_) ret.dictionarySize = dict_->HeapSize();
 	return ret;
 }
 
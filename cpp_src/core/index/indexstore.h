@@ -1,7 +1,10 @@
 #pragma once
 
+#include <optional>
 #include "core/index/index.h"
+#include "core/index/string_dictionary.h"
 #include "core/index/string_map.h"
+#include "core/payload/tuplescompressor.h"
 
 namespace reindexer {
 
@@ -12,6 +15,9 @@ public:
 		: Index(idef, std::move(payloadType), std::move(fields)) {
 		static T a;
 		keyType_ = selectKeyType_ = Variant(a).Type();
+		if constexpr (std::is_same_v<T, key_string>) {
+			if (opts_.IsDictionary()) dict_.emplace(opts_.collateOpts_);
+		}
 	}
 
 	Variant Upsert(const Variant &key, IdType id, bool &clearCache) override;
@@ -29,6 +35,22 @@ public:
 	virtual void AddDestroyTask(tsl::detail_sparse_hash::ThreadTaskQueue &) override;
 	virtual bool IsDestroyPartSupported() const noexcept override { return true; }
 	virtual bool IsUuid() const noexcept override final { return std::is_same_v<T, Uuid>; }
+	SparseColumnView SparseColumn() const noexcept override {
+		if constexpr (std::is_arithmetic_v<T>) {
+			if (isSparseColumn()) {
+				return {reinterpret_cast<const uint8_t *>(idx_data.data()), columnStates_.data(), columnStates_.size(), sizeof(T), keyType_};
+			}
+		}
+		return {};
+	}
+	IndexColumnView Column() const noexcept override {
+		if constexpr (std::is_arithmetic_v<T>) {
+			if (opts_.IsColumn() && !opts_.IsSparse()) {
+				return {reinterpret_cast<const uint8_t *>(idx_data.data()), idx_data.size(), sizeof(T)};
+			}
+		}
+		return {};
+	}
 	virtual void ReconfigureCache(const NamespaceCacheConfigData &) override {}
 
 	template <typename, typename = void>
@@ -37,8 +59,56 @@ public:
 	struct HasAddTask<H, std::void_t<decltype(std::declval<H>().add_destroy_task(nullptr))>> : public std::true_type {};
 
 protected:
+	// Dictionary refers the string, which is stored in the index's map (and in the payloads), so it has to be the map's key
+	template <typename K>
+	void updateDictionary(const K &storedKey, IdType id) {
+		if constexpr (std::is_same_v<K, key_string>) {
+			if (dict_) dict_->Set(id, storedKey);
+		}
+	}
+	void resetDictionary(IdType id) noexcept {
+		if (dict_) dict_->Reset(id);
+	}
+	// Tuples of the namespace are stored in the store index of the payload's field 0
+	bool isTuplesIndex() const noexcept { return Fields().contains(0); }
+	void updateTuplesStat(std::string_view str, bool inserted) {
+		if (!isTuplesIndex() || !TuplesCompressor::IsCompressed(str)) return;
+		const size_t uncompressedSize = TuplesCompressor::UncompressedSize(str);
+		if (inserted) {
+			++memStat_.compressedTuplesCount;
+			memStat_.compressedTuplesSize += str.size();
+			memStat_.uncompressedTuplesSize += uncompressedSize;
+		} else {
+			--memStat_.compressedTuplesCount;
+			memStat_.compressedTuplesSize -= str.size();
+			memStat_.uncompressedTuplesSize -= uncompressedSize;
+		}
+	}
+	bool isSparseColumn() const noexcept { return opts_.IsColumn() && opts_.IsSparse(); }
+	// Hash and tree indexes with 'column' option additionally keep their scalar values in idx_data
+	void updateColumn(const Variant &key, IdType id) {
+		if constexpr (std::is_arithmetic_v<T>) {
+			if (opts_.IsColumn() && !key.Type().Is<KeyValueType::Null>()) {
+				if (size_t(id) >= idx_data.size()) idx_data.resize(id + 1);
+				idx_data[id] = static_cast<T>(key);
+			}
+		}
+	}
+	void setColumnState(IdType id, SparseColumnView::State state) {
+		if (size_t(id) >= columnStates_.size()) {
+			if (state == SparseColumnView::Empty) return;
+			columnStates_.resize(id + 1, SparseColumnView::Empty);
+			idx_data.resize(id + 1);
+		}
+		columnStates_[id] = state;
+	}
+
 	unordered_str_map<int> str_map;
 	h_vector<T> idx_data;
+	// Codes of the string values. Exists only for the string indexes with 'dictionary' option
+	std::optional<StringDictionary> dict_;
+	// States of the rows in idx_data (SparseColumnView::State). Exists only for the sparse indexes with 'column' option
+	std::vector<uint8_t> columnStates_;
 
 	IndexMemStat memStat_;
 
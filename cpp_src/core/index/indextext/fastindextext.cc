@@ -42,6 +42,7 @@ void FastIndexText<T>::initHolder(FtFastConfig &cfg) {
 
 template <typename T>
 Variant FastIndexText<T>::Upsert(const Variant &key, IdType id, bool &clearCache) {
+	this->cancelBackgroundBuild();
 	if rx_unlikely (key.Type().Is<KeyValueType::Null>()) {
 		if (this->empty_ids_.Unsorted().Add(id, IdSet::Auto, 0)) {
 			this->isBuilt_ = false;
@@ -73,6 +74,7 @@ Variant FastIndexText<T>::Upsert(const Variant &key, IdType id, bool &clearCache
 
 template <typename T>
 void FastIndexText<T>::Delete(const Variant &key, IdType id, StringsHolder &strHolder, bool &clearCache) {
+	this->cancelBackgroundBuild();
 	int delcnt = 0;
 	if rx_unlikely (key.Type().Is<KeyValueType::Null>()) {
 		delcnt = this->empty_ids_.Unsorted().Erase(id);
@@ -16,11 +16,7 @@ public:
 	using key_type = typename IndexUnordered<T>::key_type;
 	using ref_type = typename IndexUnordered<T>::ref_type;
 
-	FastIndexText(const FastIndexText& other) : Base(other) {
-		initConfig(other.getConfig());
-		for (auto& idx : this->idx_map) idx.second.SetVDocID(FtKeyEntryData::ndoc);
-		this->CommitFulltext();
-	}
+	FastIndexText(const FastIndexText& other) : FastIndexText(other, true) {}
 
 	FastIndexText(const IndexDef& idef, PayloadType&& payloadType, FieldsSet&& fields, const NamespaceCacheConfigData& cacheCfg)
 		: Base(idef, std::move(payloadType), std::move(fields), cacheCfg) {
@@ -42,7 +38,29 @@ public:
 	bool EnablePreselectBeforeFt() const override final { return getConfig()->enablePreselectBeforeFt; }
 
 private:
+	FastIndexText(const FastIndexText& other, bool commit) : Base(other) {
+		initConfig(other.getConfig());
+		for (auto& idx : this->idx_map) idx.second.SetVDocID(FtKeyEntryData::ndoc);
+		if (commit) this->CommitFulltext();
+	}
+
 	void commitFulltextImpl() override final;
+	std::unique_ptr<Index> cloneUnbuilt() const override final { return std::unique_ptr<Index>{new FastIndexText<T>(*this, false)}; }
+	void swapBuilt(IndexText<T>& other) override final {
+		auto& built = static_cast<FastIndexText&>(other);
+		// Copy contains the same keys. Vdocs of the built holder refer to the copy's key entries, so those entries are moved into
+		// the index's map
+		for (auto it = built.idx_map.begin(), end = built.idx_map.end(); it != end; ++it) {
+			auto found = this->idx_map.find(it->first);
+			assertrx(found != this->idx_map.end());
+			std::swap(found.value(), it.value());
+		}
+		this->tracker_.clear();
+		// Holder refers to the config of its index
+		std::swap(this->cfg_, built.cfg_);
+		std::swap(this->cache_ft_, built.cache_ft_);
+		std::swap(holder_, built.holder_);
+	}
 	FtFastConfig* getConfig() const noexcept { return dynamic_cast<FtFastConfig*>(this->cfg_.get()); }
 	void initConfig(const FtFastConfig* = nullptr);
 	void initHolder(FtFastConfig&);
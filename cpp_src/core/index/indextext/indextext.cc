@@ -45,6 +45,7 @@ void IndexText<T>::initSearchers() {
 
 template <typename T>
 void IndexText<T>::SetOpts(const IndexOpts &opts) {
+	cancelBackgroundBuild();
 	std::string oldCfg = this->opts_.config;
 
 	this->opts_ = opts;
@@ -84,17 +85,52 @@ FtCtx::Ptr IndexText<T>::prepareFtCtx(const BaseFunctionCtx::Ptr &ctx) {
 
 template <typename T>
 void IndexText<T>::build(const RdxContext &rdxCtx) {
+	// Replaced data is destroyed after the lock's release
+	std::unique_ptr<Index> replaced;
 	smart_lock<Mutex> lck(mtx_, rdxCtx);
 	if (!this->isBuilt_) {
 		// non atomic upgrade mutex to unique
 		lck.unlock();
 		lck = smart_lock<Mutex>(mtx_, rdxCtx, true);
+		if (!this->isBuilt_ && backgroundBuild_) {
+			// Copy with the same data is already building, so waiting for it is cheaper, than the own build
+			replaced = adoptBackgroundBuild();
+		}
 		if (!this->isBuilt_) {
 			CommitFulltext();
 		}
 	}
 }
 
+template <typename T>
+std::shared_ptr<FtBackgroundBuild> IndexText<T>::BeginBackgroundBuild() {
+	std::lock_guard lck(mtx_);
+	if (this->isBuilt_ || backgroundBuild_) return nullptr;
+	auto copy = cloneUnbuilt();
+	if (!copy) return nullptr;
+	backgroundBuild_ = std::make_shared<FtBackgroundBuild>(std::move(copy));
+	return backgroundBuild_;
+}
+
+template <typename T>
+std::unique_ptr<Index> IndexText<T>::EndBackgroundBuild(const std::shared_ptr<FtBackgroundBuild> &build) {
+	std::lock_guard lck(mtx_);
+	// Index may be modified or built by a query in the meantime
+	if (this->isBuilt_ || !build || backgroundBuild_ != build) return nullptr;
+	return adoptBackgroundBuild();
+}
+
+template <typename T>
+std::unique_ptr<Index> IndexText<T>::adoptBackgroundBuild() {
+	const auto build = std::move(backgroundBuild_);
+	auto copy = build->Wait();
+	if (copy) {
+		swapBuilt(static_cast<IndexText &>(*copy));
+		this->isBuilt_ = true;
+	}
+	return copy;
+}
+
 // Generic implemetation for string index
 template <typename T>
 SelectKeyResults IndexText<T>::SelectKey(const VariantArray &keys, CondType condition, SortType, Index::SelectOpts opts,
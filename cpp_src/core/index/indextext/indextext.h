@@ -6,6 +6,7 @@
 #include "core/ft/ft_fast/dataholder.h"
 #include "core/ft/ftdsl.h"
 #include "core/ft/ftsetcashe.h"
+#include "core/index/ftbackgroundbuild.h"
 #include "core/index/indexunordered.h"
 #include "core/selectfunc/ctx/ftctx.h"
 #include "estl/shared_mutex.h"
@@ -45,6 +46,7 @@ public:
 		commitFulltextImpl();
 		this->isBuilt_ = true;
 	}
+	void BuildFulltext(const RdxContext& rdxCtx) override final { build(rdxCtx); }
 	void SetSortedIdxCount(int) override final {}
 	bool RequireWarmupOnNsCopy() const noexcept override final { return cfg_ && cfg_->enableWarmupOnNsCopy; }
 	void DestroyCache() override {
@@ -59,11 +61,25 @@ public:
 	void MarkBuilt() noexcept override { assertrx(0); }
 	bool IsFulltext() const noexcept override final { return true; }
 	void ReconfigureCache(const NamespaceCacheConfigData& cacheCfg) override final;
+	std::shared_ptr<FtBackgroundBuild> BeginBackgroundBuild() override final;
+	std::unique_ptr<Index> EndBackgroundBuild(const std::shared_ptr<FtBackgroundBuild>&) override final;
 
 protected:
 	using Mutex = MarkedMutex<shared_timed_mutex, MutexMark::IndexText>;
 
 	virtual void commitFulltextImpl() = 0;
+	// Copy of the index data without the fulltext structures. Returns nullptr, if the index does not support the background build
+	virtual std::unique_ptr<Index> cloneUnbuilt() const { return nullptr; }
+	// Swaps the index data and the fulltext structures with the built copy
+	virtual void swapBuilt(IndexText&) {}
+	// Has to be called by the index modifications
+	void cancelBackgroundBuild() noexcept {
+		if (backgroundBuild_) {
+			backgroundBuild_->Cancel();
+			backgroundBuild_.reset();
+		}
+	}
+	std::unique_ptr<Index> adoptBackgroundBuild();
 	FtCtx::Ptr prepareFtCtx(const BaseFunctionCtx::Ptr&);
 	SelectKeyResults doSelectKey(const VariantArray& keys, const std::optional<IdSetCacheKey>&, FtMergeStatuses&&,
 								 FtUseExternStatuses useExternSt, bool inTransaction, FtCtx::Ptr, const RdxContext&);
@@ -79,7 +95,8 @@ protected:
 
 	RHashMap<std::string, int> ftFields_;
 	std::unique_ptr<BaseFTConfig> cfg_;
-	Mutex mtx_;
+	mutable Mutex mtx_;
+	std::shared_ptr<FtBackgroundBuild> backgroundBuild_;
 };
 
 }  // namespace reindexer
@@ -172,8 +172,10 @@ void IndexUnordered<T>::delMemStat(typename T::iterator it) {
 
 template <typename T>
 Variant IndexUnordered<T>::Upsert(const Variant &key, IdType id, bool &clearCache) {
+	this->updateColumn(key, id);
 	// reset cache
 	if (key.Type().Is<KeyValueType::Null>()) {	// TODO maybe error or default value if the index is not sparse
+		this->resetDictionary(id);
 		if (this->empty_ids_.Unsorted().Add(id, IdSet::Auto, this->sortedIdxCount_)) {
 			cache_.reset();
 			clearCache = true;
@@ -202,12 +204,14 @@ Variant IndexUnordered<T>::Upsert(const Variant &key, IdType id, bool &clearCach
 	if (this->KeyType().template Is<KeyValueType::String>() && this->opts_.GetCollateMode() != CollateNone) {
 		return Base::Upsert(key, id, clearCache);
 	}
+	this->updateDictionary(keyIt->first, id);
 
 	return Variant(keyIt->first);
 }
 
 template <typename T>
 void IndexUnordered<T>::Delete(const Variant &key, IdType id, StringsHolder &strHolder, bool &clearCache) {
+	this->resetDictionary(id);
 	int delcnt = 0;
 	if (key.Type().Is<KeyValueType::Null>()) {
 		delcnt = this->empty_ids_.Unsorted().Erase(id);
@@ -268,9 +272,13 @@ bool IndexUnordered<T>::tryIdsetCache(const VariantArray &keys, CondType conditi
 	auto cached = cache_->Get(ckey);
 	if (cached.valid) {
 		if (!cached.val.ids) {
+			// Build time is the cost of the entry for the cache's eviction policy
+			const auto start = steady_clock_w::now();
 			scanWin = selector(res, idsCount);
 			if (!scanWin) {
-				cache_->Put(ckey, res.MergeIdsets(res.deferedExplicitSort, idsCount));
+				IdSetCacheVal val{res.MergeIdsets(res.deferedExplicitSort, idsCount)};
+				const auto cost = std::chrono::duration_cast<std::chrono::nanoseconds>(steady_clock_w::now() - start).count();
+				cache_->Put(ckey, std::move(val), cost);
 			}
 		} else {
 			res.emplace_back(std::move(cached.val.ids));
@@ -120,6 +120,20 @@ void IndexRTree<KeyEntryT, Splitter, MaxEntries, MinEntries>::Delete(const Varia
 	}
 }
 
+template <typename KeyEntryT, template <typename, typename, typename, typename, size_t, size_t> class Splitter, size_t MaxEntries,
+		  size_t MinEntries>
+std::optional<double> IndexRTree<KeyEntryT, Splitter, MaxEntries, MinEntries>::NearestItemsDistance(Point point, size_t count) const {
+	size_t idsCount = 0;
+	double distance = 0.0;
+	this->idx_map.VisitNearest(point, [&](const typename Map::value_type &v, double d) {
+		distance = d;
+		idsCount += v.second.Unsorted().size();
+		return idsCount >= count;
+	});
+	if (idsCount < count) return std::nullopt;
+	return distance;
+}
+
 std::unique_ptr<Index> IndexRTree_New(const IndexDef &idef, PayloadType &&payloadType, FieldsSet &&fields,
 									  const NamespaceCacheConfigData &cacheCfg) {
 	switch (idef.opts_.RTreeType()) {
@@ -20,6 +20,7 @@ public:
 	void Upsert(VariantArray &result, const VariantArray &keys, IdType id, bool &clearCache) override;
 	using IndexUnordered<Map>::Delete;
 	void Delete(const VariantArray &keys, IdType id, StringsHolder &, bool &clearCache) override;
+	std::optional<double> NearestItemsDistance(Point, size_t count) const override;
 
 	std::unique_ptr<Index> Clone() const override { return std::make_unique<IndexRTree>(*this); }
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <queue>
 #include "core/keyvalue/geometry.h"
 #include "estl/h_vector.h"
 
@@ -566,10 +567,45 @@ public:
 		return cend();
 	}
 	void DWithin(Point p, double distance, RectangleTree::Visitor& visitor) const { root_.DWithin(p, distance, visitor); }
+	// Best-first search: visits values in ascending order of their distances from the point, until the visitor returns true
+	template <typename V>
+	void VisitNearest(Point p, V&& visitor) const {
+		struct Candidate {
+			double squaredDistance;
+			const NodeBase* node;
+			const T* value;
+			bool operator>(const Candidate& other) const noexcept { return squaredDistance > other.squaredDistance; }
+		};
+		std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> queue;
+		for (const auto& n : root_.data_) {
+			if (!n->Empty()) queue.push(Candidate{squaredDistance(n->BoundRect(), p), n.get(), nullptr});
+		}
+		while (!queue.empty()) {
+			const Candidate c = queue.top();
+			queue.pop();
+			if (c.value) {
+				if (visitor(*c.value, std::sqrt(c.squaredDistance))) return;
+			} else if (c.node->IsLeaf()) {
+				for (const auto& v : static_cast<const Leaf*>(c.node)->data_) {
+					queue.push(Candidate{squaredDistance(boundRect(Traits::GetPoint(v)), p), nullptr, &v});
+				}
+			} else {
+				for (const auto& n : static_cast<const Node*>(c.node)->data_) {
+					queue.push(Candidate{squaredDistance(n->BoundRect(), p), n.get(), nullptr});
+				}
+			}
+		}
+	}
 
 	bool Check() const noexcept { return root_.Check(nullptr); }
 
 private:
+	static double squaredDistance(const reindexer::Rectangle& r, Point p) noexcept {
+		const double dx = std::max({r.Left() - p.X(), 0.0, p.X() - r.Right()});
+		const double dy = std::max({r.Bottom() - p.Y(), 0.0, p.Y() - r.Top()});
+		return dx * dx + dy * dy;
+	}
+
 	Node root_;
 };
 
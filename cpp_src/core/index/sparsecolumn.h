@@ -0,0 +1,51 @@
+#pragma once
+
+#include "core/keyvalue/variant.h"
+#include "core/type_consts.h"
+#include "estl/one_of.h"
+
+namespace reindexer {
+
+// Read-only view of the dense column with the values of the sparse index ('is_column' option).
+// Sparse index values are stored in the item's tuple only, so the column allows to get them by rowId without CJSON decoding.
+struct SparseColumnView {
+	enum State : uint8_t {
+		// Field does not exist in the item
+		Empty = 0,
+		// Single scalar value is stored in the column
+		Value = 1,
+		// Field exists, but it is not a single scalar value (array, null, etc). Value has to be read from the tuple
+		Tuple = 2,
+	};
+
+	bool Valid() const noexcept { return !type.Is<KeyValueType::Undefined>(); }
+	State GetState(IdType rowId) const noexcept { return size_t(rowId) < rowsCount ? State(states[rowId]) : Empty; }
+	const void *Ptr(IdType rowId) const noexcept { return data + size_t(rowId) * elemSize; }
+	double AsDouble(IdType rowId) const noexcept {
+		const void *ptr = Ptr(rowId);
+		return type.EvaluateOneOf([ptr](KeyValueType::Int) noexcept { return double(*static_cast<const int *>(ptr)); },
+								  [ptr](KeyValueType::Int64) noexcept { return double(*static_cast<const int64_t *>(ptr)); },
+								  [ptr](KeyValueType::Double) noexcept { return *static_cast<const double *>(ptr); },
+								  [ptr](KeyValueType::Bool) noexcept { return double(*static_cast<const bool *>(ptr)); },
+								  [](OneOf<KeyValueType::String, KeyValueType::Uuid, KeyValueType::Composite, KeyValueType::Null,
+										   KeyValueType::Tuple, KeyValueType::Undefined>) noexcept { return 0.0; });
+	}
+	// Both rows must have the 'Value' state
+	int Compare(IdType lhs, IdType rhs) const noexcept {
+		if (type.Is<KeyValueType::Int64>()) {
+			// int64 values may lose precision after conversion to double
+			const int64_t l = *static_cast<const int64_t *>(Ptr(lhs)), r = *static_cast<const int64_t *>(Ptr(rhs));
+			return l == r ? 0 : (l < r ? -1 : 1);
+		}
+		const double l = AsDouble(lhs), r = AsDouble(rhs);
+		return l == r ? 0 : (l < r ? -1 : 1);
+	}
+
+	const uint8_t *data = nullptr;
+	const uint8_t *states = nullptr;
+	size_t rowsCount = 0;
+	size_t elemSize = 0;
+	KeyValueType type = KeyValueType::Undefined{};
+};
+
+}  // namespace reindexer
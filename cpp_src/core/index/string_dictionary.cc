@@ -0,0 +1,138 @@
+#include "string_dictionary.h"
+#include <algorithm>
+#include <limits>
+#include "core/keyvalue/variant.h"
+#include "estl/defines.h"
+#include "tools/customhash.h"
+#include "tools/errors.h"
+#include "tools/stringstools.h"
+
+namespace reindexer {
+
+constexpr size_t kMinDictionarySlots = 16;
+constexpr size_t kMinDeadEntriesToCompact = 1024;
+
+size_t StringDictionary::hash(std::string_view str) const noexcept { return collateHash(str, collateOpts_.mode); }
+
+// Returns the slot of the value. If the value does not exist, returns the slot to insert it: the first tombstone or the empty slot
+size_t StringDictionary::findSlot(std::string_view str, size_t h) const noexcept {
+	const size_t mask = slots_.size() - 1;
+	size_t tombstone = slots_.size();
+	for (size_t pos = h & mask;; pos = (pos + 1) & mask) {
+		const CodeT code = slots_[pos];
+		if (code == kEmptyCode) {
+			return tombstone < slots_.size() ? tombstone : pos;
+		}
+		if (!entries_[code - 1].refs) {
+			if (tombstone == slots_.size()) tombstone = pos;
+		} else if (collateCompare(Get(code), str, collateOpts_) == 0) {
+			return pos;
+		}
+	}
+}
+
+StringDictionary::CodeT StringDictionary::Find(std::string_view str) const noexcept {
+	if (slots_.empty()) return kEmptyCode;
+	const CodeT code = slots_[findSlot(str, hash(str))];
+	return (code != kEmptyCode && entries_[code - 1].refs) ? code : kEmptyCode;
+}
+
+h_vector<StringDictionary::CodeT, 4> StringDictionary::Encode(const VariantArray &keys) const {
+	h_vector<CodeT, 4> codes;
+	codes.reserve(keys.size());
+	for (Variant key : keys) {
+		key.convert(KeyValueType::String{});
+		const CodeT code = Find(std::string_view(key));
+		if (code != kEmptyCode) codes.emplace_back(code);
+	}
+	std::sort(codes.begin(), codes.end());
+	codes.erase(std::unique(codes.begin(), codes.end()), codes.end());
+	return codes;
+}
+
+void StringDictionary::Set(IdType rowId, const key_string &str) {
+	if (size_t(rowId) >= rowCodes_.size()) {
+		rowCodes_.resize(rowId + 1, kEmptyCode);
+	}
+	const CodeT oldCode = rowCodes_[rowId];
+	if (oldCode != kEmptyCode && collateCompare(Get(oldCode), std::string_view(*str), collateOpts_) == 0) return;
+	rowCodes_[rowId] = add(str);
+	if (oldCode != kEmptyCode) release(oldCode);
+	if (deadCount_ > kMinDeadEntriesToCompact && 2 * deadCount_ > entries_.size()) {
+		compact();
+	}
+}
+
+void StringDictionary::Reset(IdType rowId) noexcept {
+	if (size_t(rowId) >= rowCodes_.size()) return;
+	const CodeT oldCode = rowCodes_[rowId];
+	rowCodes_[rowId] = kEmptyCode;
+	if (oldCode != kEmptyCode) release(oldCode);
+}
+
+StringDictionary::CodeT StringDictionary::add(const key_string &str) {
+	if (2 * (entries_.size() + 1) > slots_.size()) {
+		rehash(std::max(kMinDictionarySlots, 2 * slots_.size()));
+	}
+	const size_t pos = findSlot(std::string_view(*str), hash(std::string_view(*str)));
+	CodeT code = slots_[pos];
+	if (code != kEmptyCode) {
+		auto &e = entries_[code - 1];
+		if (!e.refs) {
+			// Code of the tombstone is reused for the new value
+			e.str = str;
+			--deadCount_;
+		}
+		++e.refs;
+		return code;
+	}
+	if rx_unlikely (entries_.size() >= std::numeric_limits<CodeT>::max() - 1) {
+		throw Error(errLogic, "String dictionary overflow: too many unique values");
+	}
+	entries_.emplace_back(Entry{str, 1});
+	code = CodeT(entries_.size());
+	slots_[pos] = code;
+	return code;
+}
+
+void StringDictionary::release(CodeT code) noexcept {
+	auto &e = entries_[code - 1];
+	assertrx(e.refs);
+	if (--e.refs == 0) {
+		e.str = key_string();
+		++deadCount_;
+	}
+}
+
+// Tombstones are not moved to the new table: their codes are left for the compaction
+void StringDictionary::rehash(size_t slotsCount) {
+	slots_.assign(slotsCount, kEmptyCode);
+	const size_t mask = slotsCount - 1;
+	for (CodeT code = 1; code <= CodeT(entries_.size()); ++code) {
+		if (!entries_[code - 1].refs) continue;
+		size_t pos = hash(Get(code)) & mask;
+		while (slots_[pos] != kEmptyCode) pos = (pos + 1) & mask;
+		slots_[pos] = code;
+	}
+}
+
+// Drop unreferenced entries and renumber codes. Codes of the rows are remapped accordingly
+void StringDictionary::compact() {
+	std::vector<CodeT> remap(entries_.size() + 1, kEmptyCode);
+	std::vector<Entry> entries;
+	entries.reserve(entries_.size() - deadCount_);
+	for (CodeT code = 1; code <= CodeT(entries_.size()); ++code) {
+		auto &e = entries_[code - 1];
+		if (!e.refs) continue;
+		entries.emplace_back(std::move(e));
+		remap[code] = CodeT(entries.size());
+	}
+	for (auto &code : rowCodes_) code = remap[code];
+	entries_ = std::move(entries);
+	deadCount_ = 0;
+	size_t slotsCount = kMinDictionarySlots;
+	while (slotsCount < 2 * (entries_.size() + 1)) slotsCount *= 2;
+	rehash(slotsCount);
+}
+
+}  // namespace reindexer
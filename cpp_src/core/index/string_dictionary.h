@@ -0,0 +1,66 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+#include "core/indexopts.h"
+#include "core/keyvalue/key_string.h"
+#include "core/type_consts.h"
+#include "estl/h_vector.h"
+
+namespace reindexer {
+
+class VariantArray;
+
+// Dictionary encoding for the string index column.
+// Each distinct (in terms of index collation) string value gets 32-bit code. Dictionary does not copy the strings: it refers the same
+// key_string, which is stored in the index and in the payloads.
+// Rows are referenced by the dense column of codes, so Eq/Set conditions may be checked without touching payload and string heap.
+// Payloads and the index's map keep their key_string references, so the dictionary does not reduce memory usage: it costs
+// the codes column, the entries and the hash table on top of the index (reported as IndexMemStat::dictionarySize).
+// Codes are assigned in insertion order and are not order preserving, so ordered conditions keep comparing strings.
+class StringDictionary {
+public:
+	using CodeT = uint32_t;
+	// Code of the row without value (or of the value, which does not exist in dictionary)
+	constexpr static CodeT kEmptyCode = 0;
+
+	explicit StringDictionary(const CollateOpts &collateOpts) : collateOpts_(collateOpts) {}
+
+	void Set(IdType rowId, const key_string &str);
+	void Reset(IdType rowId) noexcept;
+	CodeT Find(std::string_view str) const noexcept;
+	// Encode values for the Eq/Set conditions. Result is sorted and does not contain empty codes
+	h_vector<CodeT, 4> Encode(const VariantArray &keys) const;
+	std::string_view Get(CodeT code) const noexcept {
+		return std::string_view(*entries_[code - 1].str);
+	}
+	const CodeT *Codes() const noexcept { return rowCodes_.data(); }
+	size_t RowsCount() const noexcept { return rowCodes_.size(); }
+	size_t UniqCount() const noexcept { return entries_.size() - deadCount_; }
+	size_t HeapSize() const noexcept {
+		return entries_.capacity() * sizeof(Entry) + slots_.capacity() * sizeof(CodeT) + rowCodes_.capacity() * sizeof(CodeT);
+	}
+
+private:
+	// Entry without rows releases its string and stays in the hash table as a tombstone until its code is reused or compacted
+	struct Entry {
+		key_string str;
+		uint32_t refs;
+	};
+
+	CodeT add(const key_string &str);
+	void release(CodeT code) noexcept;
+	size_t findSlot(std::string_view str, size_t hash) const noexcept;
+	void rehash(size_t slotsCount);
+	void compact();
+	size_t hash(std::string_view str) const noexcept;
+
+	CollateOpts collateOpts_;
+	std::vector<Entry> entries_;
+	// Open addressing hash table of codes. kEmptyCode marks the empty slot
+	std::vector<CodeT> slots_;
+	std::vector<CodeT> rowCodes_;
+	size_t deadCount_ = 0;
+};
+
+}  // namespace reindexer
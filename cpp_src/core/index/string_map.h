@@ -16,6 +16,7 @@ struct less_key_string {
 	bool operator()(const key_string& lhs, const key_string& rhs) const { return collateCompare(*lhs, *rhs, collateOpts_) < 0; }
 	bool operator()(std::string_view lhs, const key_string& rhs) const { return collateCompare(lhs, *rhs, collateOpts_) < 0; }
 	bool operator()(const key_string& lhs, std::string_view rhs) const { return collateCompare(*lhs, rhs, collateOpts_) < 0; }
+	bool operator()(std::string_view lhs, std::string_view rhs) const { return collateCompare(lhs, rhs, collateOpts_) < 0; }
 	CollateOpts collateOpts_;
 };
 
@@ -188,6 +188,8 @@ void IndexDef::FromJSON(const gason::JsonNode &root) {
 	opts_.Array(root["is_array"].As<bool>());
 	opts_.Dense(root["is_dense"].As<bool>());
 	opts_.Sparse(root["is_sparse"].As<bool>());
+	opts_.Dictionary(root["is_dictionary"].As<bool>());
+	opts_.Column(root["is_column"].As<bool>());
 	if (fieldType_ == "uuid" && opts_.IsSparse()) {
 		throw Error(errParams, "UUID index cannot be sparse");
 	}
@@ -234,6 +236,12 @@ void IndexDef::GetJSON(WrSerializer &ser, int formatFlags) const {
 		.Put("is_array", opts_.IsArray())
 		.Put("is_dense", opts_.IsDense())
 		.Put("is_sparse", opts_.IsSparse());
+	if (opts_.IsDictionary()) {
+		builder.Put("is_dictionary", true);
+	}
+	if (opts_.IsColumn()) {
+		builder.Put("is_column", true);
+	}
 	if (indexType_ == "rtree" || fieldType_ == "point") {
 		switch (opts_.RTreeType()) {
 			case IndexOpts::Linear:
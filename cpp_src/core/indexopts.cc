@@ -33,6 +33,8 @@ bool IndexOpts::IsPK() const noexcept { return options & kIndexOptPK; }
 bool IndexOpts::IsArray() const noexcept { return options & kIndexOptArray; }
 bool IndexOpts::IsDense() const noexcept { return options & kIndexOptDense; }
 bool IndexOpts::IsSparse() const noexcept { return options & kIndexOptSparse; }
+bool IndexOpts::IsDictionary() const noexcept { return options & kIndexOptDictionary; }
+bool IndexOpts::IsColumn() const noexcept { return options & kIndexOptColumn; }
 bool IndexOpts::hasConfig() const noexcept { return !config.empty(); }
 CollateMode IndexOpts::GetCollateMode() const noexcept { return static_cast<CollateMode>(collateOpts_.mode); }
 
@@ -56,6 +58,16 @@ IndexOpts& IndexOpts::Sparse(bool value) & noexcept {
 	return *this;
 }
 
+IndexOpts& IndexOpts::Dictionary(bool value) & noexcept {
+	options = value ? options | kIndexOptDictionary : options & ~(kIndexOptDictionary);
+	return *this;
+}
+
+IndexOpts& IndexOpts::Column(bool value) & noexcept {
+	options = value ? options | kIndexOptColumn : options & ~(kIndexOptColumn);
+	return *this;
+}
+
 IndexOpts& IndexOpts::RTreeType(RTreeIndexType value) & noexcept {
 	rtreeType_ = value;
 	return *this;
@@ -89,6 +101,16 @@ void IndexOpts::Dump(T& os) const {
 		os << "Sparse";
 		needComma = true;
 	}
+	if (IsDictionary()) {
+		if (needComma) os << ", ";
+		os << "Dictionary";
+		needComma = true;
+	}
+	if (IsColumn()) {
+		if (needComma) os << ", ";
+		os << "Column";
+		needComma = true;
+	}
 	if (needComma) os << ", ";
 	os << RTreeType();
 	if (hasConfig()) {
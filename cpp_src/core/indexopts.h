@@ -27,6 +27,8 @@ struct IndexOpts {
 	bool IsArray() const noexcept;
 	bool IsDense() const noexcept;
 	bool IsSparse() const noexcept;
+	bool IsDictionary() const noexcept;
+	bool IsColumn() const noexcept;
 	RTreeIndexType RTreeType() const noexcept { return rtreeType_; }
 	bool hasConfig() const noexcept;
 
@@ -38,6 +40,10 @@ struct IndexOpts {
 	[[nodiscard]] IndexOpts&& Dense(bool value = true) && noexcept { return std::move(Dense(value)); }
 	IndexOpts& Sparse(bool value = true) & noexcept;
 	[[nodiscard]] IndexOpts&& Sparse(bool value = true) && noexcept { return std::move(Sparse(value)); }
+	IndexOpts& Dictionary(bool value = true) & noexcept;
+	[[nodiscard]] IndexOpts&& Dictionary(bool value = true) && noexcept { return std::move(Dictionary(value)); }
+	IndexOpts& Column(bool value = true) & noexcept;
+	[[nodiscard]] IndexOpts&& Column(bool value = true) && noexcept { return std::move(Column(value)); }
 	IndexOpts& RTreeType(RTreeIndexType) & noexcept;
 	[[nodiscard]] IndexOpts&& RTreeType(RTreeIndexType type) && noexcept { return std::move(RTreeType(type)); }
 	IndexOpts& SetCollateMode(CollateMode mode) & noexcept;
@@ -10,6 +10,7 @@
 #include "core/cjson/protobufdecoder.h"
 #include "core/keyvalue/p_string.h"
 #include "core/namespace/namespace.h"
+#include "core/payload/tuplescompressor.h"
 #include "tools/logger.h"
 
 namespace reindexer {
@@ -46,9 +47,13 @@ void ItemImpl::ModifyField(const IndexedTagsPath &tagsPath, const VariantArray &
 	WrSerializer generatedCjson;
 	const auto cjsonV = pl.Get(0, 0);
 	std::string_view cjson(cjsonV);
+	key_string decompressedCjson;
 	if (cjson.empty()) {
 		buildPayloadTuple(pl, &tagsMatcher_, generatedCjson);
 		cjson = generatedCjson.Slice();
+	} else if (TuplesCompressor::IsCompressed(cjson)) {
+		decompressedCjson = TuplesCompressor::Decompress(payloadType_.Compressor(), p_string(cjsonV));
+		cjson = *decompressedCjson;
 	}
 
 	CJsonModifier cjsonModifier(tagsMatcher_, payloadType_);
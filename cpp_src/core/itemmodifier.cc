@@ -184,6 +184,9 @@ ItemModifier::FieldData::FieldData(const UpdateEntry &entry, NamespaceImpl &ns)
 			}
 		}
 	}
+	if (entry_.IsExpression() && !entry_.Values().empty()) {
+		compiledExpression_ = CompiledExpression::Compile(static_cast<std::string_view>(entry_.Values().front()), ns.payloadType_);
+	}
 }
 
 void ItemModifier::FieldData::updateTagsPath(TagsMatcher &tm, const IndexExpressionEvaluator &ev) {
@@ -246,7 +249,13 @@ ItemModifier::ItemModifier(const std::vector<UpdateEntry> &updateEntries, Namesp
 			// values must be assigned a value in if else below
 			if (field.details().IsExpression()) {
 				assertrx(field.details().Values().size() > 0);
-				values = ev.Evaluate(static_cast<std::string_view>(field.details().Values().front()), pv, field.name());
+				std::optional<double> value;
+				if (field.compiledExpression()) value = field.compiledExpression()->Evaluate(pv, ns_.tagsMatcher_);
+				if (value) {
+					values = VariantArray{Variant{*value}};
+				} else {
+					values = ev.Evaluate(static_cast<std::string_view>(field.details().Values().front()), pv, field.name());
+				}
 				field.updateTagsPath(ns_.tagsMatcher_,
 									 [&ev, &pv, &field](std::string_view expression) { return ev.Evaluate(expression, pv, field.name()); });
 			} else {
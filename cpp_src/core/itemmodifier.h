@@ -3,6 +3,7 @@
 #include <optional>
 #include "core/keyvalue/p_string.h"
 #include "core/payload/payloadiface.h"
+#include "core/query/expressionevaluator.h"
 #include "core/query/query.h"
 
 namespace reindexer {
@@ -34,6 +35,7 @@ private:
 		int index() const noexcept { return fieldIndex_; }
 		bool isIndex() const noexcept { return isIndex_; }
 		const std::string &name() const noexcept { return entry_.Column(); }
+		std::optional<CompiledExpression> &compiledExpression() noexcept { return compiledExpression_; }
 
 	private:
 		const UpdateEntry &entry_;
@@ -42,6 +44,7 @@ private:
 		int fieldIndex_{IndexValueType::SetByJsonPath};
 		int arrayIndex_;
 		bool isIndex_;
+		std::optional<CompiledExpression> compiledExpression_;
 	};
 	struct CJsonCache {
 		CJsonCache() = default;
@@ -1,8 +1,11 @@
 
+#include <limits>
+#include "core/compositesubstitutioncache.h"
 #include "core/ft/ftsetcashe.h"
 #include "core/idset.h"
 #include "core/idsetcache.h"
 #include "core/keyvalue/variant.h"
+#include "core/query/preparedquery.h"
 #include "core/querycache.h"
 #include "joincache.h"
 #include "tools/logger.h"
@@ -10,6 +13,7 @@
 namespace reindexer {
 
 constexpr uint32_t kMaxHitCountToCache = 1024;
+constexpr size_t kEvictionSampleSize = 8;
 
 template <typename K, typename V, typename hash, typename equal>
 typename LRUCache<K, V, hash, equal>::Iterator LRUCache<K, V, hash, equal>::Get(const K &key) {
@@ -21,18 +25,30 @@ typename LRUCache<K, V, hash, equal>::Iterator LRUCache<K, V, hash, equal>::Get(
 	if (emplaced) {
 		totalCacheSize_ += kElemSizeOverhead + sizeof(Entry) + key.Size();
 		it->second.lruPos = lru_.insert(lru_.end(), &it->first);
+		it->second.priority = inflation_;
 		if rx_unlikely (!eraseLRU()) {
+			++missesCount_;
 			return Iterator();
 		}
-	} else if (std::next(it->second.lruPos) != lru_.end()) {
-		lru_.splice(lru_.end(), lru_, it->second.lruPos, std::next(it->second.lruPos));
-		it->second.lruPos = std::prev(lru_.end());
+	} else {
+		if (std::next(it->second.lruPos) != lru_.end()) {
+			lru_.splice(lru_.end(), lru_, it->second.lruPos, std::next(it->second.lruPos));
+			it->second.lruPos = std::prev(lru_.end());
+		}
+		it->second.priority = priority(it->second.cost, entrySize(it->first, it->second.val));
 	}
 
 	if (++it->second.hitCount < int(hitCountToCache_)) {
+		++missesCount_;
 		return Iterator();
 	}
 	++getCount_;
+	if (it->second.stored) {
+		++hitsCount_;
+		hitBytes_ += it->second.val.Size();
+	} else {
+		++missesCount_;
+	}
 
 	// logPrintf(LogInfo, "Cache::Get (cond=%d,sortId=%d,keys=%d), total in cache items=%d,size=%d", key.cond, key.sort,
 	// 		  (int)key.keys.size(), items_.size(), totalCacheSize_);
@@ -40,15 +56,29 @@ typename LRUCache<K, V, hash, equal>::Iterator LRUCache<K, V, hash, equal>::Get(
 }
 
 template <typename K, typename V, typename hash, typename equal>
-void LRUCache<K, V, hash, equal>::Put(const K &key, V &&v) {
+void LRUCache<K, V, hash, equal>::Put(const K &key, V &&v, uint64_t cost) {
 	if rx_unlikely (cacheSizeLimit_ == 0) return;
 
 	std::lock_guard lk(lock_);
 	auto it = items_.find(key);
 	if (it == items_.end()) return;
 
+	const size_t newSize = entrySize(it->first, v);
+	const double newPriority = priority(cost, newSize);
+	if (cost && totalCacheSize_ + v.Size() - it->second.val.Size() > cacheSizeLimit_) {
+		// Do not evict more valuable entries for the cheap one
+		auto victimIt = findVictim();
+		if (*victimIt != &it->first && items_.find(**victimIt)->second.priority > newPriority) {
+			++rejectedCount_;
+			return;
+		}
+	}
+
 	totalCacheSize_ += v.Size() - it->second.val.Size();
 	it->second.val = std::move(v);
+	it->second.stored = true;
+	it->second.cost = cost;
+	it->second.priority = newPriority;
 
 	// logPrintf(LogInfo, "IdSetCache::Put () add %d,left %d,fwdCnt=%d,sz=%d", endIt - begIt, left, it->second.fwdCount,
 	// 		  it->second.ids->size());
@@ -67,9 +97,25 @@ void LRUCache<K, V, hash, equal>::Put(const K &key, V &&v) {
 }
 
 template <typename K, typename V, typename hash, typename equal>
-RX_ALWAYS_INLINE bool LRUCache<K, V, hash, equal>::eraseLRU() {
-	typename LRUList::iterator it = lru_.begin();
+typename LRUCache<K, V, hash, equal>::LRUList::iterator LRUCache<K, V, hash, equal>::findVictim() {
+	// The most recently used entry is never sampled to avoid eviction of the entry, which is currently in use
+	auto victim = lru_.begin();
+	if (lru_.size() < 3) return victim;
+	double minPriority = std::numeric_limits<double>::max();
+	auto it = lru_.begin();
+	const auto last = std::prev(lru_.end());
+	for (size_t i = 0; i < kEvictionSampleSize && it != last; ++i, ++it) {
+		const double p = items_.find(**it)->second.priority;
+		if (p < minPriority) {
+			minPriority = p;
+			victim = it;
+		}
+	}
+	return victim;
+}
 
+template <typename K, typename V, typename hash, typename equal>
+RX_ALWAYS_INLINE bool LRUCache<K, V, hash, equal>::eraseLRU() {
 	while (totalCacheSize_ > cacheSizeLimit_) {
 		// just to save us if totalCacheSize_ >0 and lru is empty
 		// someone can make bad key or val with wrong size
@@ -79,10 +125,11 @@ RX_ALWAYS_INLINE bool LRUCache<K, V, hash, equal>::eraseLRU() {
 			logPrintf(LogError, "IdSetCache::eraseLRU () Cache restarted because wrong cache size totalCacheSize_=%d", totalCacheSize_);
 			return false;
 		}
+		const auto it = findVictim();
 		auto mIt = items_.find(**it);
 		assertrx_throw(mIt != items_.end());
 
-		const size_t oldSize = sizeof(Entry) + kElemSizeOverhead + mIt->first.Size() + mIt->second.val.Size();
+		const size_t oldSize = entrySize(mIt->first, mIt->second.val);
 
 		if rx_unlikely (oldSize > totalCacheSize_) {
 			clearAll();
@@ -91,8 +138,13 @@ RX_ALWAYS_INLINE bool LRUCache<K, V, hash, equal>::eraseLRU() {
 			return false;
 		}
 		totalCacheSize_ = totalCacheSize_ - oldSize;
+		inflation_ = std::max(inflation_, mIt->second.priority);
+		if (mIt->second.stored) {
+			++evictedCount_;
+			evictedBytes_ += mIt->second.val.Size();
+		}
 		items_.erase(mIt);
-		it = lru_.erase(it);
+		lru_.erase(it);
 		++eraseCount_;
 	}
 
@@ -103,6 +155,7 @@ template <typename K, typename V, typename hash, typename equal>
 bool LRUCache<K, V, hash, equal>::clearAll() {
 	const bool res = !items_.empty();
 	totalCacheSize_ = 0;
+	inflation_ = 0.0;
 	std::unordered_map<K, Entry, hash, equal>().swap(items_);
 	LRUList().swap(lru_);
 	getCount_ = 0;
@@ -123,6 +176,12 @@ LRUCacheMemStat LRUCache<K, V, hash, equal>::GetMemStat() {
 	// }
 
 	ret.hitCountLimit = hitCountToCache_;
+	ret.hitsCount = hitsCount_;
+	ret.missesCount = missesCount_;
+	ret.hitBytes = hitBytes_;
+	ret.evictedCount = evictedCount_;
+	ret.evictedBytes = evictedBytes_;
+	ret.rejectedCount = rejectedCount_;
 
 	return ret;
 }
@@ -130,5 +189,7 @@ template class LRUCache<IdSetCacheKey, IdSetCacheVal, hash_idset_cache_key, equa
 template class LRUCache<IdSetCacheKey, FtIdSetCacheVal, hash_idset_cache_key, equal_idset_cache_key>;
 template class LRUCache<QueryCacheKey, QueryCountCacheVal, HashQueryCacheKey, EqQueryCacheKey>;
 template class LRUCache<JoinCacheKey, JoinCacheVal, hash_join_cache_key, equal_join_cache_key>;
+template class LRUCache<CompositeSubstitutionKey, CompositeSubstitutionPlan, HashCompositeSubstitutionKey, EqCompositeSubstitutionKey>;
+template class LRUCache<PreparedQueryCacheKey, PreparedQueryCacheVal, HashPreparedQueryCacheKey, EqPreparedQueryCacheKey>;
 
 }  // namespace reindexer
@@ -11,6 +11,8 @@ namespace reindexer {
 
 constexpr size_t kElemSizeOverhead = 256;
 
+// Eviction uses GreedyDual-Size policy: each entry has priority 'L + cost / size', where 'L' is the priority of the last evicted entry.
+// The victim is the entry with the lowest priority among the least recently used ones. Entries without cost degrade policy to plain LRU
 template <typename K, typename V, typename hash, typename equal>
 class LRUCache {
 public:
@@ -34,8 +36,9 @@ public:
 	};
 	// Get cached val. Create new entry in cache if unexists
 	Iterator Get(const K &k);
-	// Put cached val
-	void Put(const K &k, V &&v);
+	// Put cached val. 'cost' is the time of the value building in nanoseconds. Expensive and small values are preferred for caching:
+	// value is not admitted, if its priority is lower, than priorities of the entries, which have to be evicted for it
+	void Put(const K &k, V &&v, uint64_t cost = 0);
 
 	LRUCacheMemStat GetMemStat();
 
@@ -84,7 +87,7 @@ public:
 			}
 			auto mIt = items_.find(**it);
 			assertrx(mIt != items_.end());
-			const size_t oldSize = sizeof(Entry) + kElemSizeOverhead + mIt->first.Size() + mIt->second.val.Size();
+			const size_t oldSize = entrySize(mIt->first, mIt->second.val);
 			if rx_unlikely (oldSize > totalCacheSize_) {
 				clearAll();
 				return;
@@ -102,14 +105,20 @@ protected:
 		V val;
 		typename LRUList::iterator lruPos;
 		int hitCount = 0;
+		bool stored = false;
+		uint64_t cost = 0;
+		double priority = 0.0;
 		template <typename T>
 		void Dump(T &os) const {
-			os << "{val: " << val << ", hitCount: " << hitCount << '}';
+			os << "{val: " << val << ", hitCount: " << hitCount << ", cost: " << cost << '}';
 		}
 	};
 
 	bool eraseLRU();
 	bool clearAll();
+	typename LRUList::iterator findVictim();
+	static size_t entrySize(const K &k, const V &v) noexcept { return sizeof(Entry) + kElemSizeOverhead + k.Size() + v.Size(); }
+	double priority(uint64_t cost, size_t size) const noexcept { return inflation_ + double(cost) / double(size); }
 
 	std::unordered_map<K, Entry, hash, equal> items_;
 	LRUList lru_;
@@ -117,8 +126,11 @@ protected:
 	size_t totalCacheSize_;
 	const size_t cacheSizeLimit_;
 	uint32_t hitCountToCache_;
+	// Priority of the last evicted entry
+	double inflation_ = 0.0;
 
 	uint64_t getCount_ = 0, putCount_ = 0, eraseCount_ = 0;
+	uint64_t hitsCount_ = 0, missesCount_ = 0, hitBytes_ = 0, evictedCount_ = 0, evictedBytes_ = 0, rejectedCount_ = 0;
 };
 
 }  // namespace reindexer
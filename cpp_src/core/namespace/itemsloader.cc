@@ -1,5 +1,4 @@
 #include "itemsloader.h"
-#include "core/index/index.h"
 #include "tools/logger.h"
 
 namespace reindexer {
@@ -115,7 +114,7 @@ void ItemsLoader::reading() {
 			}
 			item.impl.Value().SetLSN(int64_t(l));
 			// Prealloc payload here, because reading|parsing thread is faster then index insertion thread
-			item.preallocPl = PayloadValue(item.impl.GetConstPayload().RealSize());
+			item.preallocPl = PayloadValue(item.impl.GetConstPayload().RealSize(), nullptr, 0, ns_.payloadArena_.get());
 
 			lck.lock();
 			const bool wasEmpty = items_.HasNoWrittenItems();
@@ -214,7 +213,7 @@ void ItemsLoader::clearIndexCache() {
 }
 
 template <typename MutexT>
-void ItemsLoader::doInsertField(NamespaceImpl::IndexesStorage &indexes, unsigned field, IdType id, Payload &pl, Payload &plNew,
+bool ItemsLoader::doInsertField(NamespaceImpl::IndexesStorage &indexes, unsigned field, IdType id, Payload &pl, Payload &plNew,
 								VariantArray &krefs, VariantArray &skrefs, MutexT &mtx) {
 	Index &index = *indexes[field];
 	const bool isIndexSparse = index.Opts().IsSparse();
@@ -251,9 +250,11 @@ void ItemsLoader::doInsertField(NamespaceImpl::IndexesStorage &indexes, unsigned
 			pl.SetSingleElement(field, krefs[0]);
 		}
 	}
+	return needClearCache && index.IsOrdered();
 }
 
-IndexInserters::IndexInserters(NamespaceImpl::IndexesStorage &indexes, PayloadType pt) : indexes_(indexes), pt_(std::move(pt)) {
+IndexInserters::IndexInserters(NamespaceImpl::IndexesStorage &indexes, PayloadType pt)
+	: indexes_(indexes), pt_(std::move(pt)), needClearCache_(indexes_.totalSize(), 0) {
 	for (int i = 1; i < indexes_.firstCompositePos(); ++i) {
 		if (indexes_[i]->Opts().IsArray()) {
 			hasArrayIndexes_ = true;
@@ -296,11 +297,26 @@ void IndexInserters::AwaitIndexesBuild() {
 }
 
 void IndexInserters::BuildSimpleIndexesAsync(unsigned startId, span<ItemsLoader::ItemData> newItems, span<PayloadValue> nsItems) {
+	assertrx(newItems.size() == nsItems.size());
+	idsBuf_.resize(newItems.size());
+	newItemsBuf_.resize(newItems.size());
+	nsItemsBuf_.resize(newItems.size());
+	for (unsigned i = 0; i < newItems.size(); ++i) {
+		idsBuf_[i] = startId + i;
+		newItemsBuf_[i] = &newItems[i].impl;
+		nsItemsBuf_[i] = &nsItems[i];
+	}
+	BuildSimpleIndexesAsync(idsBuf_, newItemsBuf_, nsItemsBuf_, IndexValueType::NotSet);
+}
+
+void IndexInserters::BuildSimpleIndexesAsync(span<IdType> ids, span<ItemImpl *> newItems, span<PayloadValue *> nsItems,
+											 int excludedField) {
 	{
 		std::lock_guard lck(mtx_);
+		shared_.ids = ids;
 		shared_.newItems = newItems;
 		shared_.nsItems = nsItems;
-		shared_.startId = startId;
+		shared_.excludedField = excludedField;
 		assertrx(shared_.threadsWithNewData.empty());
 		for (unsigned tid = 0; tid < threads_.size(); ++tid) {
 			shared_.threadsWithNewData.emplace_back(tid + kTIDOffset);
@@ -324,8 +340,52 @@ void IndexInserters::BuildCompositeIndexesAsync() {
 	cv_.notify_all();
 }
 
+void IndexInserters::InsertField(unsigned field, IdType id, ItemImpl &newItem, PayloadValue &nsItem) {
+	assertrx(field < unsigned(indexes_.firstCompositePos()));
+	Payload pl(pt_, nsItem);
+	Payload plNew = newItem.GetPayload();
+	dummy_mutex dummyMtx;
+	if (ItemsLoader::doInsertField(indexes_, field, id, pl, plNew, krefs_, skrefs_, dummyMtx)) {
+		needClearCache_[field] = 1;
+	}
+}
+
+template <typename GetMutexT>
+bool IndexInserters::bulkInsertField(unsigned field, VariantArray &skrefs, Index::BulkUpsertKeys &keys, const GetMutexT &getMutex) {
+	Index &index = *indexes_[field];
+	const bool isArray = pt_.Field(field).IsArray();
+	keys.clear();
+	for (unsigned i = 0; i < shared_.newItems.size(); ++i) {
+		const auto id = shared_.ids[i];
+		Payload pl(pt_, *shared_.nsItems[i]);
+		shared_.newItems[i]->GetPayload().Get(field, skrefs);
+		// Refs of the numeric keys are equal to the keys themselves, so payload may be set before the index insertion
+		// Array values may reallocate payload, so must be synchronized via mutex
+		if (isArray) {
+			std::lock_guard lck(getMutex(id));
+			pl.Set(field, skrefs);
+		} else {
+			if (skrefs.size() != 1) {
+				throw Error(errLogic, "Array value for scalar field");
+			}
+			shared_lock lck(getMutex(id));
+			pl.SetSingleElement(field, skrefs[0]);
+		}
+		if (skrefs.empty()) {
+			keys.emplace_back(Variant{}, id);
+		}
+		for (auto &key : skrefs) {
+			keys.emplace_back(std::move(key), id);
+		}
+	}
+	bool needClearCache{false};
+	index.BulkUpsert(keys, needClearCache);
+	return needClearCache;
+}
+
 void IndexInserters::insertionLoop(unsigned threadId) noexcept {
 	VariantArray krefs, skrefs;
+	Index::BulkUpsertKeys compositeKeys, bulkKeys;
 	const unsigned firstCompositeIndex = indexes_.firstCompositePos();
 	const unsigned totalIndexes = indexes_.totalSize();
 
@@ -342,41 +402,63 @@ void IndexInserters::insertionLoop(unsigned threadId) noexcept {
 			shared_.threadsWithNewData.erase(std::find(shared_.threadsWithNewData.begin(), shared_.threadsWithNewData.end(), threadId));
 			lck.unlock();
 
-			const unsigned startId = shared_.startId;
 			const unsigned threadsCnt = threads_.size();
+			const int excludedField = shared_.excludedField;
 			assertrx(shared_.newItems.size() == shared_.nsItems.size());
+			assertrx(shared_.newItems.size() == shared_.ids.size());
 			if (shared_.composite) {
-				for (unsigned i = 0; i < shared_.newItems.size(); ++i) {
-					const auto id = startId + i;
-					auto &plData = shared_.nsItems[i];
-					for (unsigned field = firstCompositeIndex + threadId - kTIDOffset; field < totalIndexes; field += threadsCnt) {
-						bool needClearCache{false};
-						indexes_[field]->Upsert(Variant{plData}, id, needClearCache);
+				// Composite keys are not stored in the payload, so the whole batch is inserted at once
+				for (unsigned field = firstCompositeIndex + threadId - kTIDOffset; field < totalIndexes; field += threadsCnt) {
+					compositeKeys.clear();
+					for (unsigned i = 0; i < shared_.newItems.size(); ++i) {
+						compositeKeys.emplace_back(Variant{*shared_.nsItems[i]}, shared_.ids[i]);
 					}
+					bool needClearCache{false};
+					indexes_[field]->BulkUpsert(compositeKeys, needClearCache);
+					if (needClearCache && indexes_[field]->IsOrdered()) needClearCache_[field] = 1;
 				}
 			} else {
+				// Numeric ordered indexes are handled field by field, so their keys are inserted into the btree in the sorted order
+				for (unsigned field = threadId; field < firstCompositeIndex; field += threadsCnt) {
+					if (int(field) == excludedField || !indexes_[field]->IsPayloadBulkUpsertable()) continue;
+					bool needClearCache;
+					if (hasArrayIndexes_) {
+						const auto getMutex = [this](IdType id) -> auto & { return plArrayMtxs_[id % plArrayMtxs_.size()]; };
+						needClearCache = bulkInsertField(field, skrefs, bulkKeys, getMutex);
+					} else {
+						dummy_mutex dummyMtx;
+						needClearCache = bulkInsertField(field, skrefs, bulkKeys, [&dummyMtx](IdType) -> auto & { return dummyMtx; });
+					}
+					if (needClearCache) needClearCache_[field] = 1;
+				}
 				if (hasArrayIndexes_) {
 					for (unsigned i = 0; i < shared_.newItems.size(); ++i) {
-						const auto id = startId + i;
-						auto &item = shared_.newItems[i].impl;
-						auto &plData = shared_.nsItems[i];
+						const auto id = shared_.ids[i];
+						auto &item = *shared_.newItems[i];
+						auto &plData = *shared_.nsItems[i];
 						Payload pl(pt_, plData);
 						Payload plNew = item.GetPayload();
 						for (unsigned field = threadId; field < firstCompositeIndex; field += threadsCnt) {
-							ItemsLoader::doInsertField(indexes_, field, id, pl, plNew, krefs, skrefs,
-													   plArrayMtxs_[id % plArrayMtxs_.size()]);
+							if (int(field) == excludedField || indexes_[field]->IsPayloadBulkUpsertable()) continue;
+							if (ItemsLoader::doInsertField(indexes_, field, id, pl, plNew, krefs, skrefs,
+														   plArrayMtxs_[id % plArrayMtxs_.size()])) {
+								needClearCache_[field] = 1;
+							}
 						}
 					}
 				} else {
 					dummy_mutex dummyMtx;
 					for (unsigned i = 0; i < shared_.newItems.size(); ++i) {
-						const auto id = startId + i;
-						auto &item = shared_.newItems[i].impl;
-						auto &plData = shared_.nsItems[i];
+						const auto id = shared_.ids[i];
+						auto &item = *shared_.newItems[i];
+						auto &plData = *shared_.nsItems[i];
 						Payload pl(pt_, plData);
 						Payload plNew = item.GetPayload();
 						for (unsigned field = threadId; field < firstCompositeIndex; field += threadsCnt) {
-							ItemsLoader::doInsertField(indexes_, field, id, pl, plNew, krefs, skrefs, dummyMtx);
+							if (int(field) == excludedField || indexes_[field]->IsPayloadBulkUpsertable()) continue;
+							if (ItemsLoader::doInsertField(indexes_, field, id, pl, plNew, krefs, skrefs, dummyMtx)) {
+								needClearCache_[field] = 1;
+							}
 						}
 					}
 				}
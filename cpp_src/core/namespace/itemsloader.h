@@ -1,6 +1,7 @@
 #pragma once
 
 #include <condition_variable>
+#include "core/index/index.h"
 #include "core/itemimpl.h"
 #include "namespaceimpl.h"
 
@@ -93,8 +94,9 @@ private:
 	void reading();
 	void insertion();
 	void clearIndexCache();
+	// Returns true, if index cache has to be cleared
 	template <typename MutexT>
-	static void doInsertField(NamespaceImpl::IndexesStorage& indexes, unsigned field, IdType id, Payload& pl, Payload& plNew,
+	static bool doInsertField(NamespaceImpl::IndexesStorage& indexes, unsigned field, IdType id, Payload& pl, Payload& plNew,
 							  VariantArray& krefs, VariantArray& skrefs, MutexT& mtx);
 
 	friend class IndexInserters;
@@ -118,19 +120,31 @@ public:
 	void Stop();
 	void AwaitIndexesBuild();
 	void BuildSimpleIndexesAsync(unsigned startId, span<ItemsLoader::ItemData> newItems, span<PayloadValue> nsItems);
+	// Inserts new items with the specified ids into all the simple indexes, except index 0 and excludedField
+	void BuildSimpleIndexesAsync(span<IdType> ids, span<ItemImpl*> newItems, span<PayloadValue*> nsItems, int excludedField);
 	void BuildCompositeIndexesAsync();
+	// Synchronously inserts new item into the single simple index. Must not be called, while asynchronous build is in progress
+	void InsertField(unsigned field, IdType id, ItemImpl& newItem, PayloadValue& nsItem);
+	// Returns true, if some of the insertions into the index require cache clearing. Flags are accumulated until ResetClearCacheFlags()
+	bool NeedClearCache(unsigned field) const noexcept { return needClearCache_[field]; }
+	void ResetClearCacheFlags() noexcept { std::fill(needClearCache_.begin(), needClearCache_.end(), 0); }
 
 private:
 	struct SharedData {
-		span<ItemsLoader::ItemData> newItems;
-		span<PayloadValue> nsItems;
-		unsigned startId = 0;
+		span<IdType> ids;
+		span<ItemImpl*> newItems;
+		span<PayloadValue*> nsItems;
+		int excludedField = IndexValueType::NotSet;
 		h_vector<unsigned, 8> threadsWithNewData;
 		bool terminate = false;
 		bool composite = false;
 	};
 
 	void insertionLoop(unsigned threadId) noexcept;
+	// Sets payload values of the numeric ordered index for the whole batch and inserts its keys via single BulkUpsert call.
+	// Returns true, if index cache has to be cleared
+	template <typename GetMutexT>
+	bool bulkInsertField(unsigned field, VariantArray& skrefs, Index::BulkUpsertKeys& keys, const GetMutexT& getMutex);
 	void onItemsHandled() noexcept {
 		if ((readyThreads_.fetch_add(1, std::memory_order_acq_rel) + 1) == threads_.size()) {
 			std::lock_guard lck(mtx_);
@@ -156,6 +170,12 @@ private:
 	bool hasArrayIndexes_ = false;
 	constexpr static unsigned kTIDOffset = 1;  // Thread ID offset to handle fields [1,n] based on TID
 	std::array<shared_timed_mutex, 10> plArrayMtxs_;
+	// Each index is handled by the single thread, so flags may be set without synchronization
+	std::vector<uint8_t> needClearCache_;
+	std::vector<IdType> idsBuf_;
+	std::vector<ItemImpl*> newItemsBuf_;
+	std::vector<PayloadValue*> nsItemsBuf_;
+	VariantArray krefs_, skrefs_;
 };
 
 }  // namespace reindexer
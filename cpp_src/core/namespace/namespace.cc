@@ -76,6 +76,152 @@ void Namespace::CommitTransaction(Transaction& tx, QueryResults& result, const R
 	nsFuncWrapper<&NamespaceImpl::CommitTransaction>(tx, result, NsContext(ctx), statCalculator);
 }
 
+template <void (NamespaceImpl::*fn)(const Query&, QueryResults&, const NsContext&), QueryType queryType>
+bool Namespace::modifyInCopy(const Query& query, QueryResults& result, const RdxContext& ctx) {
+	if (!copyPolicyForQueries_.load(std::memory_order_relaxed) || isSystemNamespaceNameFast(query.NsName())) {
+		return false;
+	}
+	auto nsl = atomicLoadMainNs();
+	// Cheap upper estimation: the query can not modify more items, than the namespace has
+	size_t maxItemsCount = nsl->GetItemsCount();
+	if (query.HasLimit()) maxItemsCount = std::min<size_t>(maxItemsCount, query.Limit());
+	if (!needNamespaceCopy(nsl, maxItemsCount)) {
+		return false;
+	}
+	const bool enablePerfCounters = nsl->enablePerfCounters_.load(std::memory_order_relaxed);
+	auto params = longUpdDelLoggingParams_.load(std::memory_order_relaxed);
+	QueryStatCalculator statCalculator(long_actions::MakeLogger<queryType>(query, std::move(params)), params.thresholdUs >= 0);
+
+	// Items are selected under the read lock only, so the other copying writers are not blocked during the selection
+	QueryResults selected;
+	auto selectedNs = nsl;
+	int64_t selectedVersion = 0;
+	auto preselect = [&] {
+		selected.AddNamespace(nsl, true);
+		nsl->selectForModification(query, selected, queryType, NsContext(ctx));
+		selectedNs = nsl;
+		selectedVersion = nsl->wal_.LSNCounter();
+	};
+	{
+		auto rlck = statCalculator.CreateLock(*nsl, &NamespaceImpl::rLock, ctx);
+		preselect();
+	}
+	if (!needNamespaceCopy(nsl, selected.Count())) {
+		return false;
+	}
+	PerfStatCalculatorMT calc(nsl->updatePerfCounter_, enablePerfCounters);
+
+	auto lck = statCalculator.template CreateLock<contexted_unique_lock>(clonerMtx_, ctx);
+	nsl = ns_;
+	{
+		CounterGuardAIR32 cg(nsl->cancelCommitCnt_);
+		auto rlck = statCalculator.CreateLock(*nsl, &NamespaceImpl::rLock, ctx);
+		if (nsl != selectedNs || nsl->wal_.LSNCounter() != selectedVersion) {
+			// Namespace was modified after the selection
+			selected = QueryResults();
+			preselect();
+			if (!needNamespaceCopy(nsl, selected.Count())) {
+				calc.enable_ = false;
+				return false;
+			}
+		}
+		nsl->checkApplySlaveUpdate(ctx.fromReplication_);
+		PerfStatCalculatorMT nsCopyCalc(copyStatsCounter_, enablePerfCounters);
+		calc.LockHit();
+		logPrintf(LogTrace, "Namespace::modifyInCopy creating copy for (%s)", nsl->name_);
+		hasCopy_.store(true, std::memory_order_release);
+		NamespaceImpl::Ptr nsCopy;
+		try {
+			auto storageLock = statCalculator.CreateLock(nsl->storage_, &AsyncStorage::FullLock);
+
+			cg.Reset();
+			nsCopy.reset(new NamespaceImpl(*nsl, storageLock));
+			nsCopyCalc.HitManualy();
+			NsContext nsCtx(ctx);
+			nsCtx.CopiedNsRequest();
+			result.AddNamespace(nsCopy, true);
+			nsCopy->addPreselected(query, result, selected);
+			selected = QueryResults();
+			(*nsCopy.*fn)(query, result, nsCtx);
+			if (nsCopy->lastUpdateTime_.load(std::memory_order_relaxed)) {
+				nsCopy->lastUpdateTime_.fetch_sub(nsCopy->config_.optimizationTimeout * 2, std::memory_order_relaxed);
+				nsCopy->optimizeIndexes(nsCtx);
+				nsCopy->warmupFtIndexes();
+			}
+			try {
+				nsCopy->storage_.InheritUpdatesFrom(nsl->storage_, storageLock);
+			} catch (Error& e) {
+				// This exception should never be seen - there are no good ways to recover from it
+				assertf(false, "Error during storage moving in namespace (%s) copying: %s", nsl->name_, e.what());
+			}
+
+			calc.SetCounter(nsCopy->updatePerfCounter_);
+			nsl->markReadOnly();
+			atomicStoreMainNs(nsCopy.get());
+			hasCopy_.store(false, std::memory_order_release);
+		} catch (...) {
+			calc.enable_ = false;
+			if (nsCopy && result.IsNamespaceAdded(nsCopy.get())) {
+				result.RemoveNamespace(nsCopy.get());
+			}
+			hasCopy_.store(false, std::memory_order_release);
+			throw;
+		}
+	}
+	bgDeleter_.Add(std::move(nsl));
+	nsl = ns_;
+	lck.unlock();
+	statCalculator.LogFlushDuration(nsl->storage_, &AsyncStorage::TryForceFlush);
+	return true;
+}
+template bool Namespace::modifyInCopy<&NamespaceImpl::updateSelected, QueryType::QueryUpdate>(const Query&, QueryResults&,
+																						 const RdxContext&);
+template bool Namespace::modifyInCopy<&NamespaceImpl::deleteSelected, QueryType::QueryDelete>(const Query&, QueryResults&,
+																						 const RdxContext&);
+
+template <void (NamespaceImpl::*fn)(const Query&, QueryResults&, const NsContext&), QueryType queryType>
+bool Namespace::modifyInChunks(const Query& query, QueryResults& result, const RdxContext& ctx) {
+	const auto chunkSize = static_cast<size_t>(updDelChunkSize_.load(std::memory_order_relaxed));
+	if (!chunkSize || ctx.fromReplication_ || query.HasLimit() || query.HasOffset() || !query.GetSubQueries().empty() ||
+		isSystemNamespaceNameFast(query.NsName()) || atomicLoadMainNs()->GetItemsCount() <= chunkSize) {
+		return false;
+	}
+	const auto& entries = query.Entries();
+	for (size_t i = 0; i < entries.Size(); i = entries.Next(i)) {
+		// PK condition can not be just appended to the query with top-level OR
+		if (entries.GetOperation(i) == OpOr) return false;
+	}
+
+	std::string pkIndexName;
+	VariantArray pks;
+	if (!nsFuncWrapper<&NamespaceImpl::selectQueryPKs>(query, pkIndexName, pks, ctx) || pks.size() <= chunkSize) {
+		return false;
+	}
+	auto activity = ctx.Activity();
+	for (size_t processed = 0; processed < pks.size();) {
+		ThrowOnCancel(ctx);
+		const size_t count = std::min(chunkSize, pks.size() - processed);
+		VariantArray chunkPks;
+		chunkPks.reserve(count);
+		for (size_t i = processed; i < processed + count; ++i) {
+			chunkPks.emplace_back(pks[i]);
+		}
+		// Items, which were modified or deleted after the preselect, are filtered out by the original conditions
+		Query chunkQuery = query;
+		chunkQuery.Where(pkIndexName, CondSet, std::move(chunkPks));
+		QueryResults chunkResult;
+		nsFuncWrapper<fn, queryType>(chunkQuery, chunkResult, ctx);
+		result.AppendChunk(std::move(chunkResult));
+		processed += count;
+		if (activity) {
+			activity->SetProgress(processed, pks.size());
+		}
+	}
+	return true;
+}
+template bool Namespace::modifyInChunks<&NamespaceImpl::doUpdate, QueryType::QueryUpdate>(const Query&, QueryResults&, const RdxContext&);
+template bool Namespace::modifyInChunks<&NamespaceImpl::doDelete, QueryType::QueryDelete>(const Query&, QueryResults&, const RdxContext&);
+
 NamespacePerfStat Namespace::GetPerfStat(const RdxContext& ctx) {
 	NamespacePerfStat stats = nsFuncWrapper<&NamespaceImpl::GetPerfStat>(ctx);
 	stats.transactions = txStatsCounter_.Get();
@@ -89,11 +235,58 @@ NamespacePerfStat Namespace::GetPerfStat(const RdxContext& ctx) {
 	stats.transactions.minCommitTimeUs = commitStats.minTimeUs;
 	stats.transactions.maxCommitTimeUs = commitStats.maxTimeUs;
 	stats.transactions.avgCommitTimeUs = commitStats.totalTimeUs / (commitStats.totalHitCount ? commitStats.totalHitCount : 1);
+	stats.backgroundTasks = bgTasksStatsCounter_.Get();
 	return stats;
 }
 
-bool Namespace::needNamespaceCopy(const NamespaceImpl::Ptr& ns, const Transaction& tx) const noexcept {
-	auto stepsCount = tx.GetSteps().size();
+void Namespace::ScheduleBackgroundRoutines(TaskScheduler::Group& group, const std::atomic<bool>& dbDestroyed) {
+	scheduleBackgroundRoutine<&NamespaceImpl::OptimizationRoutine>(TaskScheduler::Priority::IndexOptimization, optimizationScheduled_,
+																   group, dbDestroyed);
+	scheduleBackgroundRoutine<&NamespaceImpl::FtCommitRoutine>(TaskScheduler::Priority::FtRebuild, ftCommitScheduled_, group,
+																dbDestroyed);
+	scheduleBackgroundRoutine<&NamespaceImpl::GCRoutine>(TaskScheduler::Priority::GC, gcScheduled_, group, dbDestroyed);
+}
+
+template <void (NamespaceImpl::*fn)(RdxActivityContext*)>
+void Namespace::scheduleBackgroundRoutine(TaskScheduler::Priority priority, std::atomic<bool>& scheduled, TaskScheduler::Group& group,
+										  const std::atomic<bool>& dbDestroyed) {
+	if (hasCopy_.load(std::memory_order_acquire)) {
+		return;
+	}
+	const bool enablePerfCounters = atomicLoadMainNs()->enablePerfCounters_.load(std::memory_order_relaxed);
+	if (scheduled.exchange(true, std::memory_order_acq_rel)) {
+		if (enablePerfCounters) bgTasksStatsCounter_.Skip();
+		return;
+	}
+	const auto queuedAt = system_clock_w::now();
+	auto task = [self = shared_from_this(), &scheduled, &dbDestroyed, enablePerfCounters, queuedAt] {
+		const auto startedAt = system_clock_w::now();
+		try {
+			if (!dbDestroyed.load(std::memory_order_relaxed) && !self->hasCopy_.load(std::memory_order_acquire)) {
+				self->nsFuncWrapper<fn>(nullptr);
+			}
+		} catch (Error& err) {
+			logPrintf(LogWarning, "backgroundRoutine() failed: %s", err.what());
+		} catch (...) {
+			logPrintf(LogWarning, "backgroundRoutine() failed with unknown error");
+		}
+		if (enablePerfCounters) {
+			using std::chrono::duration_cast;
+			using std::chrono::microseconds;
+			self->bgTasksStatsCounter_.Count(duration_cast<microseconds>(startedAt - queuedAt).count(),
+											 duration_cast<microseconds>(system_clock_w::now() - startedAt).count());
+		}
+		scheduled.store(false, std::memory_order_release);
+	};
+	try {
+		TaskScheduler::Instance().Schedule(priority, std::move(task), &group);
+	} catch (...) {
+		scheduled.store(false, std::memory_order_release);
+		throw;
+	}
+}
+
+bool Namespace::needNamespaceCopy(const NamespaceImpl::Ptr& ns, size_t stepsCount) const noexcept {
 	auto startCopyPolicyTxSize = static_cast<uint32_t>(startCopyPolicyTxSize_.load(std::memory_order_relaxed));
 	auto copyPolicyMultiplier = static_cast<uint32_t>(copyPolicyMultiplier_.load(std::memory_order_relaxed));
 	auto txSizeToAlwaysCopy = static_cast<uint32_t>(txSizeToAlwaysCopy_.load(std::memory_order_relaxed));
@@ -3,12 +3,14 @@
 #include <thread>
 #include <type_traits>
 #include "bgnamespacedeleter.h"
+#include "core/bgtasksstats.h"
 #include "core/querystat.h"
+#include "core/taskscheduler.h"
 #include "core/txstats.h"
 
 namespace reindexer {
 
-class Namespace {
+class Namespace : public std::enable_shared_from_this<Namespace> {
 	template <auto fn, typename... Args>
 	auto nsFuncWrapper(Args &&...args) const {
 		while (true) {
@@ -117,7 +119,10 @@ public:
 		nsFuncWrapper<&NamespaceImpl::modifyItem, ItemModifyMode::ModeUpdate>(item, qr, ctx);
 	}
 	void Update(const Query &query, QueryResults &result, const RdxContext &ctx) {
-		nsFuncWrapper<&NamespaceImpl::doUpdate, QueryType::QueryUpdate>(query, result, ctx);
+		if (!modifyInCopy<&NamespaceImpl::updateSelected, QueryType::QueryUpdate>(query, result, ctx) &&
+			!modifyInChunks<&NamespaceImpl::doUpdate, QueryType::QueryUpdate>(query, result, ctx)) {
+			nsFuncWrapper<&NamespaceImpl::doUpdate, QueryType::QueryUpdate>(query, result, ctx);
+		}
 	}
 	void Upsert(Item &item, const RdxContext &ctx) { nsFuncWrapper<&NamespaceImpl::Upsert>(item, ctx); }
 	void Upsert(Item &item, QueryResults &qr, const RdxContext &ctx) {
@@ -128,7 +133,10 @@ public:
 		nsFuncWrapper<&NamespaceImpl::modifyItem, ItemModifyMode::ModeDelete>(item, qr, ctx);
 	}
 	void Delete(const Query &query, QueryResults &result, const RdxContext &ctx) {
-		nsFuncWrapper<&NamespaceImpl::doDelete, QueryType::QueryDelete>(query, result, ctx);
+		if (!modifyInCopy<&NamespaceImpl::deleteSelected, QueryType::QueryDelete>(query, result, ctx) &&
+			!modifyInChunks<&NamespaceImpl::doDelete, QueryType::QueryDelete>(query, result, ctx)) {
+			nsFuncWrapper<&NamespaceImpl::doDelete, QueryType::QueryDelete>(query, result, ctx);
+		}
 	}
 	void Truncate(const RdxContext &ctx) { nsFuncWrapper<&NamespaceImpl::Truncate>(ctx); }
 	template <typename JoinPreResultCtx>
@@ -142,6 +150,7 @@ public:
 		txStatsCounter_.Reset();
 		commitStatsCounter_.Reset();
 		copyStatsCounter_.Reset();
+		bgTasksStatsCounter_.Reset();
 		nsFuncWrapper<&NamespaceImpl::ResetPerfStat>(ctx);
 	}
 	std::vector<std::string> EnumMeta(const RdxContext &ctx) { return nsFuncWrapper<&NamespaceImpl::EnumMeta>(ctx); }
@@ -151,6 +160,8 @@ public:
 		}
 		nsFuncWrapper<&NamespaceImpl::BackgroundRoutine>(ctx);
 	}
+	// Schedules optimization and GC routines into the shared task scheduler. Each routine has at most one scheduled task at a time
+	void ScheduleBackgroundRoutines(TaskScheduler::Group &group, const std::atomic<bool> &dbDestroyed);
 	void StorageFlushingRoutine() {
 		if (hasCopy_.load(std::memory_order_acquire)) {
 			return;
@@ -206,6 +217,8 @@ public:
 		startCopyPolicyTxSize_.store(configData.startCopyPolicyTxSize, std::memory_order_relaxed);
 		copyPolicyMultiplier_.store(configData.copyPolicyMultiplier, std::memory_order_relaxed);
 		txSizeToAlwaysCopy_.store(configData.txSizeToAlwaysCopy, std::memory_order_relaxed);
+		copyPolicyForQueries_.store(configData.copyPolicyForQueries, std::memory_order_relaxed);
+		updDelChunkSize_.store(configData.updDelChunkSize, std::memory_order_relaxed);
 		longTxLoggingParams_.store(configProvider.GetTxLoggingParams(), std::memory_order_relaxed);
 		longUpdDelLoggingParams_.store(configProvider.GetUpdDelLoggingParams(), std::memory_order_relaxed);
 		nsFuncWrapper<&NamespaceImpl::OnConfigUpdated>(configProvider, ctx);
@@ -236,7 +249,21 @@ protected:
 	}
 
 private:
-	bool needNamespaceCopy(const NamespaceImpl::Ptr &ns, const Transaction &tx) const noexcept;
+	bool needNamespaceCopy(const NamespaceImpl::Ptr &ns, const Transaction &tx) const noexcept {
+		return needNamespaceCopy(ns, tx.GetSteps().size());
+	}
+	bool needNamespaceCopy(const NamespaceImpl::Ptr &ns, size_t modificationsCount) const noexcept;
+	// Applies large UPDATE/DELETE query to the namespace copy (the same way as large transactions), so the selects are not blocked
+	// by the namespace write lock during the query execution. Returns false, if the query has to be applied to the main namespace
+	template <void (NamespaceImpl::*fn)(const Query &, QueryResults &, const NsContext &), QueryType queryType>
+	bool modifyInCopy(const Query &query, QueryResults &result, const RdxContext &ctx);
+	// Executes large UPDATE/DELETE query in chunks, releasing the namespace lock between them. Each chunk is the original query,
+	// restricted by the set of PKs, so the conditions are re-validated for each chunk. Returns false, if the query can not be chunked
+	template <void (NamespaceImpl::*fn)(const Query &, QueryResults &, const NsContext &), QueryType queryType>
+	bool modifyInChunks(const Query &query, QueryResults &result, const RdxContext &ctx);
+	template <void (NamespaceImpl::*fn)(RdxActivityContext *)>
+	void scheduleBackgroundRoutine(TaskScheduler::Priority priority, std::atomic<bool> &scheduled, TaskScheduler::Group &group,
+								   const std::atomic<bool> &dbDestroyed);
 	void doRename(const Namespace::Ptr &dst, const std::string &newName, const std::string &storagePath, const RdxContext &ctx);
 	NamespaceImpl::Ptr atomicLoadMainNs() const {
 		std::lock_guard<spinlock> lck(nsPtrSpinlock_);
@@ -256,12 +283,18 @@ private:
 	std::atomic<int> startCopyPolicyTxSize_;
 	std::atomic<int> copyPolicyMultiplier_;
 	std::atomic<int> txSizeToAlwaysCopy_;
+	std::atomic<bool> copyPolicyForQueries_ = {false};
+	std::atomic<int64_t> updDelChunkSize_ = {0};
 	TxStatCounter txStatsCounter_;
 	PerfStatCounterMT commitStatsCounter_;
 	PerfStatCounterMT copyStatsCounter_;
 	std::atomic<LongTxLoggingParams> longTxLoggingParams_;
 	std::atomic<LongQueriesLoggingParams> longUpdDelLoggingParams_;
 	BackgroundNamespaceDeleter &bgDeleter_;
+	std::atomic<bool> optimizationScheduled_ = {false};
+	std::atomic<bool> ftCommitScheduled_ = {false};
+	std::atomic<bool> gcScheduled_ = {false};
+	BgTasksStatCounter bgTasksStatsCounter_;
 };
 
 }  // namespace reindexer
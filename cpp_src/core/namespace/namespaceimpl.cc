@@ -5,15 +5,18 @@
 #include "core/cjson/cjsondecoder.h"
 #include "core/cjson/jsonbuilder.h"
 #include "core/cjson/uuid_recoders.h"
+#include "core/index/ftbackgroundbuild.h"
 #include "core/index/index.h"
 #include "core/index/ttlindex.h"
 #include "core/itemimpl.h"
 #include "core/itemmodifier.h"
 #include "core/nsselecter/nsselecter.h"
 #include "core/payload/payloadiface.h"
+#include "core/payload/tuplescompressor.h"
 #include "core/querystat.h"
 #include "core/rdxcontext.h"
 #include "core/selectfunc/functionexecutor.h"
+#include "core/taskscheduler.h"
 #include "core/transactionimpl.h"
 #include "debug/crashqueryreporter.h"
 #include "itemsloader.h"
@@ -39,6 +42,9 @@ using std::chrono::microseconds;
 
 static const std::string kPKIndexName = "#pk";
 constexpr int kWALStatementItemsThreshold = 5;
+// Transactions with less steps are committed item by item
+constexpr size_t kTxStepsForParallelIndexesInsertion = 10000;
+constexpr size_t kTxIndexesInsertionBatchSize = 5000;
 
 #define kStorageMagic 0x1234FEDC
 #define kStorageVersion 0x8
@@ -79,6 +85,7 @@ NamespaceImpl::NamespaceImpl(const NamespaceImpl& src, AsyncStorage::FullLockT&
 	  queryCountCache_{
 		  std::make_unique<QueryCountCache>(config_.cacheConfig.queryCountCacheSize, config_.cacheConfig.queryCountHitsToCache)},
 	  joinCache_{std::make_unique<JoinCache>(config_.cacheConfig.joinCacheSize, config_.cacheConfig.joinHitsToCache)},
+	  compositeSubstitutionCache_{std::make_unique<CompositeSubstitutionCache>()},
 	  wal_{src.wal_, storage_},
 	  repl_{src.repl_},
 	  observers_{src.observers_},
@@ -91,6 +98,7 @@ NamespaceImpl::NamespaceImpl(const NamespaceImpl& src, AsyncStorage::FullLockT&
 	  nsIsLoading_{false},
 	  serverId_{src.serverId_},
 	  itemsDataSize_{src.itemsDataSize_},
+	  payloadArena_{src.payloadArena_},
 	  optimizationState_{NotOptimized},
 	  strHolder_{makeStringsHolder()},
 	  nsUpdateSortedContextMemory_{0},
@@ -112,6 +120,7 @@ NamespaceImpl::NamespaceImpl(const std::string& name, UpdatesObservers& observer
 	  queryCountCache_(
 		  std::make_unique<QueryCountCache>(config_.cacheConfig.queryCountCacheSize, config_.cacheConfig.queryCountHitsToCache)),
 	  joinCache_(std::make_unique<JoinCache>(config_.cacheConfig.joinCacheSize, config_.cacheConfig.joinHitsToCache)),
+	  compositeSubstitutionCache_(std::make_unique<CompositeSubstitutionCache>()),
 	  wal_(getWalSize(config_)),
 	  observers_(&observers),
 	  lastSelectTime_{0},
@@ -127,6 +136,9 @@ NamespaceImpl::NamespaceImpl(const std::string& name, UpdatesObservers& observer
 	itemsCapacity_.store(items_.capacity());
 	optimizationState_.store(NotOptimized);
 
+	payloadType_.SetCompressor(std::make_shared<TuplesCompressor>());
+	tagsMatcher_.UpdatePayloadType(payloadType_, false);
+
 	// Add index and payload field for tuple of non indexed fields
 	IndexDef tupleIndexDef(kTupleName, {}, IndexStrStore, IndexOpts());
 	addIndex(tupleIndexDef);
@@ -248,6 +260,14 @@ void NamespaceImpl::OnConfigUpdated(DBConfigProvider& configProvider, const RdxC
 	storageOpts_.LazyLoad(configData.lazyLoad);
 	storageOpts_.noQueryIdleThresholdSec = configData.noQueryIdleThreshold;
 	storage_.SetForceFlushLimit(config_.syncStorageFlushLimit);
+	payloadType_.Compressor()->Configure(config_.tuplesCompression != TuplesCompression::None, config_.tuplesCompressionMinSize,
+										 config_.cacheConfig.tuplesCacheSize);
+	// Payloads, which are already placed in the arena, keep it alive after the arena is disabled
+	if (config_.payloadArena && !payloadArena_) {
+		payloadArena_ = PayloadArena::Create();
+	} else if (!config_.payloadArena) {
+		payloadArena_ = nullptr;
+	}
 
 	for (auto& idx : indexes_) {
 		idx->EnableUpdatesCountingMode(configData.idxUpdatesCountingMode);
@@ -540,6 +560,15 @@ NamespaceImpl::RollBack_updateItems<needRollBack> NamespaceImpl::updateItems(con
 	if (!items_.empty()) {
 		rollbacker.SaveTuple();
 	}
+	// Keys of the numeric ordered indexes are collected from all of the items and inserted into the btree in the sorted order
+	std::vector<Index::BulkUpsertKeys> bulkKeys(std::max(oldPlType.NumFields(), payloadType_.NumFields()));
+	std::vector<bool> isBulkField(bulkKeys.size(), false);
+	for (auto fieldIdx : changedFields) {
+		if (fieldIdx != 0 && deltaFields >= 0 && indexes_[fieldIdx]->IsPayloadBulkUpsertable()) {
+			isBulkField[fieldIdx] = true;
+			bulkKeys[fieldIdx].reserve(ItemsCount());
+		}
+	}
 	for (size_t rowId = 0; rowId < items_.size(); rowId++) {
 		if (items_[rowId].IsFree()) {
 			continue;
@@ -565,6 +594,16 @@ NamespaceImpl::RollBack_updateItems<needRollBack> NamespaceImpl::updateItems(con
 
 			if ((fieldIdx == 0) || deltaFields >= 0) {
 				newItem.GetPayload().Get(fieldIdx, skrefsUps);
+				if (isBulkField[fieldIdx]) {
+					if (skrefsUps.empty()) {
+						bulkKeys[fieldIdx].emplace_back(Variant{}, rowId);
+					}
+					for (const auto& key : skrefsUps) {
+						bulkKeys[fieldIdx].emplace_back(key, rowId);
+					}
+					newValue.Set(fieldIdx, skrefsUps);
+					continue;
+				}
 				krefs.resize(0);
 				bool needClearCache{false};
 				index.Upsert(krefs, skrefsUps, rowId, needClearCache);
@@ -584,6 +623,13 @@ NamespaceImpl::RollBack_updateItems<needRollBack> NamespaceImpl::updateItems(con
 		repl_.dataHash ^= Payload(payloadType_, plCurr).GetHash();
 		itemsDataSize_ += plCurr.GetCapacity() + sizeof(PayloadValue::dataHeader);
 	}
+	for (auto fieldIdx : changedFields) {
+		if (isBulkField[fieldIdx]) {
+			bool needClearCache{false};
+			indexes_[fieldIdx]->BulkUpsert(bulkKeys[fieldIdx], needClearCache);
+			if (needClearCache) indexesCacheCleaner.Add(indexes_[fieldIdx]->SortId());
+		}
+	}
 	markUpdated(false);
 	if (errCount != 0) {
 		logPrintf(LogError, "Can't update indexes of %d items in namespace %s: %s", errCount, name_, lastErr.what());
@@ -651,6 +697,7 @@ void NamespaceImpl::SetSchema(std::string_view schema, const RdxContext& ctx) {
 	}
 
 	const auto initTmVer = tagsMatcher_.version();
+	compositeSubstitutionCache_->Clear();
 	schema_ = std::make_shared<Schema>(schema);
 	auto fields = schema_->GetPaths();
 	for (auto& field : fields) {
@@ -714,6 +761,7 @@ void NamespaceImpl::dropIndex(const IndexDef& index) {
 		logPrintf(LogError, errMsg, index.name_);
 		throw Error(errParams, errMsg, index.name_);
 	}
+	compositeSubstitutionCache_->Clear();
 
 	int fieldIdx = itIdxName->second;
 	std::unique_ptr<Index>& indexToRemove = indexes_[fieldIdx];
@@ -1041,6 +1089,7 @@ private:
 
 bool NamespaceImpl::addIndex(const IndexDef& indexDef) {
 	const auto& indexName = indexDef.name_;
+	compositeSubstitutionCache_->Clear();
 	if (const auto idxNameIt = indexesNames_.find(indexName); idxNameIt != indexesNames_.end()) {
 		IndexDef oldIndexDef = getIndexDefinition(indexName);
 		if (indexDef.IsEqual(oldIndexDef, IndexComparison::SkipConfig)) {
@@ -1115,6 +1164,28 @@ bool NamespaceImpl::addIndex(const IndexDef& indexDef) {
 
 void NamespaceImpl::fillSparseIndex(Index& index, std::string_view jsonPath) {
 	auto indexesCacheCleaner{GetIndexesCacheCleaner()};
+	if (index.IsOrdered()) {
+		// Keys are collected from all of the items and inserted into the btree in the sorted order
+		Index::BulkUpsertKeys keys;
+		keys.reserve(ItemsCount());
+		for (size_t rowId = 0; rowId < items_.size(); rowId++) {
+			if (items_[rowId].IsFree()) {
+				continue;
+			}
+			Payload{payloadType_, items_[rowId]}.GetByJsonPath(jsonPath, tagsMatcher_, skrefs, index.KeyType());
+			if (skrefs.empty()) {
+				keys.emplace_back(Variant{}, rowId);
+			}
+			for (auto& key : skrefs) {
+				keys.emplace_back(std::move(key), rowId);
+			}
+		}
+		bool needClearCache{false};
+		index.BulkUpsert(keys, needClearCache);
+		if (needClearCache) indexesCacheCleaner.Add(index.SortId());
+		markUpdated(false);
+		return;
+	}
 	for (size_t rowId = 0; rowId < items_.size(); rowId++) {
 		if (items_[rowId].IsFree()) {
 			continue;
@@ -1179,13 +1250,16 @@ void NamespaceImpl::addCompositeIndex(const IndexDef& indexDef) {
 		insertIndex(Index::New(indexDef, PayloadType{payloadType_}, FieldsSet{fields}, config_.cacheConfig), idxPos, indexName)};
 
 	auto indexesCacheCleaner{GetIndexesCacheCleaner()};
+	Index::BulkUpsertKeys keys;
+	keys.reserve(ItemsCount());
 	for (IdType rowId = 0; rowId < int(items_.size()); rowId++) {
 		if (!items_[rowId].IsFree()) {
-			bool needClearCache{false};
-			indexes_[idxPos]->Upsert(Variant(items_[rowId]), rowId, needClearCache);
-			if (needClearCache && indexes_[idxPos]->IsOrdered()) indexesCacheCleaner.Add(indexes_[idxPos]->SortId());
+			keys.emplace_back(Variant(items_[rowId]), rowId);
 		}
 	}
+	bool needClearCache{false};
+	indexes_[idxPos]->BulkUpsert(keys, needClearCache);
+	if (needClearCache && indexes_[idxPos]->IsOrdered()) indexesCacheCleaner.Add(indexes_[idxPos]->SortId());
 
 	for (auto field : fields) {
 		indexesToComposites_[field].emplace_back(idxPos);
@@ -1306,7 +1380,7 @@ void NamespaceImpl::Insert(Item& item, const RdxContext& ctx) { ModifyItem(item,
 
 void NamespaceImpl::Update(Item& item, const RdxContext& ctx) { ModifyItem(item, ModeUpdate, ctx); }
 
-void NamespaceImpl::doUpdate(const Query& query, QueryResults& result, const NsContext& ctx) {
+void NamespaceImpl::selectForModification(const Query& query, QueryResults& result, QueryType type, const NsContext& ctx) {
 	NsSelecter selecter(this);
 	SelectCtxWithJoinPreSelect selCtx(query, nullptr);
 	SelectFunctionsHolder func;
@@ -1314,9 +1388,29 @@ void NamespaceImpl::doUpdate(const Query& query, QueryResults& result, const NsC
 	selCtx.contextCollectingMode = true;
 	selCtx.requiresCrashTracking = true;
 	selCtx.inTransaction = ctx.inTransaction;
-	selCtx.crashReporterQueryType = QueryUpdate;
+	selCtx.crashReporterQueryType = type;
 	selecter(result, selCtx, ctx.rdxContext);
+}
+
+void NamespaceImpl::addPreselected(const Query& query, QueryResults& result, const QueryResults& preselected) {
+	assertrx(result.IsNamespaceAdded(this));
+	result.addNSContext(payloadType_, tagsMatcher_, FieldsSet(tagsMatcher_, query.SelectFilters()), schema_);
+	result.Items().reserve(preselected.Count());
+	for (const ItemRef& item : preselected.Items()) {
+		assertrx(items_.exists(item.Id()));
+		result.Add(ItemRef(item.Id(), items_[item.Id()], item.Proc(), item.Nsid()));
+	}
+	result.totalCount = preselected.totalCount;
+	result.haveRank = preselected.haveRank;
+	result.needOutputRank = preselected.needOutputRank;
+}
 
+void NamespaceImpl::doUpdate(const Query& query, QueryResults& result, const NsContext& ctx) {
+	selectForModification(query, result, QueryUpdate, ctx);
+	updateSelected(query, result, ctx);
+}
+
+void NamespaceImpl::updateSelected(const Query& query, QueryResults& result, const NsContext& ctx) {
 	ActiveQueryScope queryScope(query, QueryUpdate, optimizationState_, strHolder_.get());
 	const auto tmStart = system_clock_w::now();
 
@@ -1523,16 +1617,11 @@ void NamespaceImpl::doDelete(IdType id) {
 }
 
 void NamespaceImpl::doDelete(const Query& query, QueryResults& result, const NsContext& ctx) {
-	NsSelecter selecter(this);
-	SelectCtxWithJoinPreSelect selCtx(query, nullptr);
-	selCtx.contextCollectingMode = true;
-	selCtx.requiresCrashTracking = true;
-	selCtx.inTransaction = ctx.inTransaction;
-	selCtx.crashReporterQueryType = QueryDelete;
-	SelectFunctionsHolder func;
-	selCtx.functions = &func;
-	selecter(result, selCtx, ctx.rdxContext);
+	selectForModification(query, result, QueryDelete, ctx);
+	deleteSelected(query, result, ctx);
+}
 
+void NamespaceImpl::deleteSelected(const Query& query, QueryResults& result, const NsContext& ctx) {
 	ActiveQueryScope queryScope(query, QueryDelete, optimizationState_, strHolder_.get());
 	assertrx(result.IsNamespaceAdded(this));
 	const auto tmStart = system_clock_w::now();
@@ -1565,6 +1654,39 @@ void NamespaceImpl::doDelete(const Query& query, QueryResults& result, const NsC
 	}
 }
 
+bool NamespaceImpl::selectQueryPKs(const Query& query, std::string& pkIndexName, VariantArray& pks, const RdxContext& ctx) {
+	pks.clear();
+	auto rlck = rLock(ctx);
+	const auto pkIt = indexesNames_.find(kPKIndexName);
+	if (pkIt == indexesNames_.end()) return false;
+	const auto& pkIndex = *indexes_[pkIt->second];
+	if (pkIndex.Fields().size() != 1 || pkIndex.Fields()[0] == IndexValueType::SetByJsonPath || pkIndex.Opts().IsArray()) {
+		return false;
+	}
+	const int pkField = pkIndex.Fields()[0];
+
+	Query selectQuery = query;
+	selectQuery.type_ = QuerySelect;
+	QueryResults qr;
+	qr.AddNamespace(this, true);
+	NsSelecter selecter(this);
+	SelectCtxWithJoinPreSelect selCtx(selectQuery, nullptr);
+	SelectFunctionsHolder func;
+	selCtx.functions = &func;
+	selecter(qr, selCtx, ctx);
+
+	pkIndexName = pkIndex.Name();
+	pks.reserve(qr.Count());
+	VariantArray values;
+	for (const auto& item : qr.Items()) {
+		ConstPayload(payloadType_, item.Value()).Get(pkField, values);
+		assertrx(values.size() == 1);
+		// Values are used after the lock release
+		pks.emplace_back(std::move(values[0]).EnsureHold());
+	}
+	return true;
+}
+
 void NamespaceImpl::removeIndex(std::unique_ptr<Index>& idx) {
 	if (idx->HoldsStrings() && !(strHoldersWaitingToBeDeleted_.empty() && strHolder_.unique())) {
 		strHolder_->Add(std::move(idx));
@@ -1689,7 +1811,7 @@ void NamespaceImpl::SetSlaveReplMasterState(MasterState state, const RdxContext&
 
 Transaction NamespaceImpl::NewTransaction(const RdxContext& ctx) {
 	auto rlck = rLock(ctx);
-	return Transaction(name_, payloadType_, tagsMatcher_, pkFields(), schema_);
+	return Transaction(name_, payloadType_, tagsMatcher_, pkFields(), schema_, config_.txItemsSpillThreshold);
 }
 
 void NamespaceImpl::CommitTransaction(Transaction& tx, QueryResults& result, NsContext ctx,
@@ -1720,12 +1842,48 @@ void NamespaceImpl::CommitTransaction(Transaction& tx, QueryResults& result, NsC
 		storageAdvice = storage_.AdviceBatching();
 	}
 
+	// New items of the large transaction are inserted into the indexes in parallel by batches
+	const int pkField = txParallelInsertionPKField(tx.GetSteps().size());
+	std::optional<IndexInserters> indexInserters;
+	std::vector<TxNewItem> newItems;
+	if (pkField >= 0) {
+		indexInserters.emplace(indexes_, payloadType_);
+		indexInserters->Run(std::min(config_.txIndexInsertionThreads, indexes_.firstCompositePos() - 1));
+		newItems.reserve(kTxIndexesInsertionBatchSize);
+	}
+	const auto insertNewItems = [&] {
+		if (!newItems.empty()) insertTxNewItems(newItems, pkField, *indexInserters, result, ctx);
+	};
+
 	for (auto&& step : tx.GetSteps()) {
+		// WAL records and replication have to preserve the order of the steps
+		if (step.type_ != TransactionStep::Type::ModifyItem) insertNewItems();
 		switch (step.type_) {
 			case TransactionStep::Type::ModifyItem: {
 				const auto mode = std::get<TransactionItemStep>(step.data_).mode;
 				Item item = tx.GetItem(std::move(step));
-				modifyItem(item, mode, ctx);
+				if (indexInserters && mode != ModeDelete) {
+					std::pair<IdType, bool> realItem;
+					try {
+						setFieldsBasedOnPrecepts(item.impl_);
+						updateTagsMatcherFromItem(item.impl_);
+						realItem = findByPK(item.impl_, ctx.inTransaction, ctx.rdxContext);
+						if (!realItem.second && mode != ModeUpdate) {
+							addTxNewItem(item, pkField, *indexInserters, ctx);
+							newItems.emplace_back(TxNewItem{std::move(item), mode});
+							if (newItems.size() >= kTxIndexesInsertionBatchSize) insertNewItems();
+							break;
+						}
+					} catch (...) {
+						insertNewItems();
+						throw;
+					}
+					insertNewItems();
+					doModifyItem(item, mode, realItem, ctx);
+				} else {
+					insertNewItems();
+					modifyItem(item, mode, ctx);
+				}
 				result.AddItem(item);
 				break;
 			}
@@ -1762,6 +1920,7 @@ void NamespaceImpl::CommitTransaction(Transaction& tx, QueryResults& result, NsC
 				std::abort();
 		}
 	}
+	insertNewItems();
 
 	WALRecord commitWrec(WalCommitTransaction, 0, true);
 	processWalRecord(commitWrec, ctx.rdxContext);
@@ -1978,10 +2137,13 @@ void NamespaceImpl::doModifyItem(Item& item, ItemModifyMode mode, const NsContex
 
 	setFieldsBasedOnPrecepts(itemImpl);
 	updateTagsMatcherFromItem(itemImpl);
-	auto newPl = itemImpl->GetPayload();
+	doModifyItem(item, mode, findByPK(itemImpl, ctx.inTransaction, ctx.rdxContext), ctx);
+}
 
-	auto realItem = findByPK(itemImpl, ctx.inTransaction, ctx.rdxContext);
-	bool exists = realItem.second;
+void NamespaceImpl::doModifyItem(Item& item, ItemModifyMode mode, std::pair<IdType, bool> realItem, const NsContext& ctx) {
+	ItemImpl* itemImpl = item.impl_;
+	auto newPl = itemImpl->GetPayload();
+	const bool exists = realItem.second;
 
 	if ((exists && mode == ModeInsert) || (!exists && mode == ModeUpdate)) {
 		item.setID(-1);
@@ -2018,6 +2180,94 @@ void NamespaceImpl::doModifyItem(Item& item, ItemModifyMode mode, const NsContex
 	markUpdated(!exists);
 }
 
+int NamespaceImpl::txParallelInsertionPKField(size_t txSteps) const {
+	if (config_.txIndexInsertionThreads <= 0 || txSteps < kTxStepsForParallelIndexesInsertion) return -1;
+	// Tuple, PK and at least one more simple index
+	if (indexes_.firstCompositePos() < 3) return -1;
+	const auto pkIt = indexesNames_.find(kPKIndexName);
+	if (pkIt == indexesNames_.end()) return -1;
+	// Values of the composite and sparse PKs are not available until the whole payload is built
+	const int pkField = pkIt->second;
+	if (pkField <= 0 || pkField >= indexes_.firstCompositePos() || indexes_[pkField]->Opts().IsSparse()) return -1;
+	return pkField;
+}
+
+void NamespaceImpl::addTxNewItem(Item& item, int pkField, IndexInserters& indexInserters, const NsContext& ctx) {
+	ItemImpl* itemImpl = item.impl_;
+	const IdType id = createItem(itemImpl->GetConstPayload().RealSize());
+
+	lsn_t lsn(wal_.Add(WALRecord(WalItemUpdate, id, ctx.inTransaction), lsn_t()), serverId_);
+	if (!ctx.rdxContext.fromReplication_) repl_.lastSelfLSN = lsn;
+	item.setLSN(int64_t(lsn));
+	item.setID(id);
+	items_[id].SetLSN(int64_t(lsn));
+
+	// PK is indexed immediately, so the next steps of the transaction are able to find this item
+	indexInserters.InsertField(pkField, id, *itemImpl, items_[id]);
+}
+
+void NamespaceImpl::insertTxNewItems(std::vector<TxNewItem>& newItems, int pkField, IndexInserters& indexInserters, QueryResults& result,
+									 const NsContext& ctx) {
+	std::vector<IdType> ids;
+	std::vector<ItemImpl*> itemImpls;
+	std::vector<PayloadValue*> payloads;
+	ids.reserve(newItems.size());
+	itemImpls.reserve(newItems.size());
+	payloads.reserve(newItems.size());
+	for (auto& newItem : newItems) {
+		ids.emplace_back(newItem.item.GetID());
+		itemImpls.emplace_back(newItem.item.impl_);
+		payloads.emplace_back(&items_[newItem.item.GetID()]);
+	}
+
+	indexInserters.BuildSimpleIndexesAsync(ids, itemImpls, payloads, pkField);
+	indexInserters.AwaitIndexesBuild();
+	// Index [0] must be inserted after all other simple indexes
+	for (size_t i = 0; i < newItems.size(); ++i) {
+		indexInserters.InsertField(0, ids[i], *itemImpls[i], *payloads[i]);
+	}
+	if (indexes_.compositeIndexesSize()) {
+		indexInserters.BuildCompositeIndexesAsync();
+		indexInserters.AwaitIndexesBuild();
+	}
+	{
+		auto indexesCacheCleaner{GetIndexesCacheCleaner()};
+		for (int field = 0; field < indexes_.totalSize(); ++field) {
+			if (indexInserters.NeedClearCache(field)) indexesCacheCleaner.Add(indexes_[field]->SortId());
+		}
+		indexInserters.ResetClearCacheFlags();
+	}
+
+	saveTagsMatcherToStorage(true);
+	for (size_t i = 0; i < newItems.size(); ++i) {
+		auto& [item, mode] = newItems[i];
+		auto& plData = *payloads[i];
+		repl_.dataHash ^= ConstPayload(payloadType_, plData).GetHash();
+		itemsDataSize_ += plData.GetCapacity() + sizeof(PayloadValue::dataHeader);
+		itemImpls[i]->RealValue() = plData;
+
+		const lsn_t lsn(item.GetLSN());
+		if (storage_.IsValid()) {
+			WrSerializer pk, data;
+			pk << kRxStorageItemPrefix;
+			itemImpls[i]->GetPayload().SerializeFields(pk, pkFields());
+			data.PutUInt64(lsn.Counter());
+			itemImpls[i]->GetCJSON(data);
+			storage_.Write(pk.Slice(), data.Slice());
+		}
+		if (!repl_.temporary) {
+			// not send row with fromReplication=true and originLSN_= empty
+			if (!ctx.rdxContext.fromReplication_ || !ctx.rdxContext.LSNs_.originLSN_.isEmpty())
+				observers_->OnModifyItem(LSNPair(lsn, ctx.rdxContext.fromReplication_ ? ctx.rdxContext.LSNs_.originLSN_ : lsn), name_,
+										 itemImpls[i], mode, ctx.inTransaction);
+		}
+		if (!ctx.rdxContext.fromReplication_) setReplLSNs(LSNPair(lsn_t(), lsn));
+		result.AddItem(item);
+	}
+	markUpdated(true);
+	newItems.clear();
+}
+
 RX_ALWAYS_INLINE VariantArray NamespaceImpl::getPkKeys(const ConstPayload& cpl, Index* pkIndex, int fieldNum) {
 	// It is a faster alternative of "select ID from namespace where pk1 = 'item.pk1' and pk2 = 'item.pk2' "
 	// Get pkey values from pk fields
@@ -2123,20 +2373,16 @@ void NamespaceImpl::optimizeIndexes(const NsContext& ctx) {
 			const bool forceBuildAll = forceBuildAllIndexes || idxIt->IsBuilt() || idxIt->SortId() != currentSortId;
 			idxIt->MakeSortOrders(sortCtx);
 			// Build in multiple threads
-			std::unique_ptr<std::thread[]> thrs(new std::thread[maxIndexWorkers]);
-			for (size_t i = 0; i < maxIndexWorkers; i++) {
-				thrs[i] = std::thread([&, i]() {
-					for (size_t j = i; j < this->indexes_.size() && !cancelCommitCnt_.load(std::memory_order_relaxed) &&
-									   !dbDestroyed_.load(std::memory_order_relaxed);
-						 j += maxIndexWorkers) {
-						auto& idx = this->indexes_[j];
-						if (forceBuildAll || !idx->IsBuilt()) {
-							idx->UpdateSortedIds(sortCtx);
-						}
+			TaskScheduler::Instance().ParallelFor(TaskScheduler::Priority::IndexOptimization, maxIndexWorkers, [&](size_t i) {
+				for (size_t j = i; j < this->indexes_.size() && !cancelCommitCnt_.load(std::memory_order_relaxed) &&
+								   !dbDestroyed_.load(std::memory_order_relaxed);
+					 j += maxIndexWorkers) {
+					auto& idx = this->indexes_[j];
+					if (forceBuildAll || !idx->IsBuilt()) {
+						idx->UpdateSortedIds(sortCtx);
 					}
-				});
-			}
-			for (size_t i = 0; i < maxIndexWorkers; i++) thrs[i].join();
+				}
+			});
 		}
 		if (cancelCommitCnt_.load(std::memory_order_relaxed)) break;
 	}
@@ -2254,6 +2500,27 @@ NamespaceMemStat NamespaceImpl::GetMemStat(const RdxContext& ctx) {
 	ret.Total.dataSize = itemsDataSize_ + items_.capacity() * sizeof(PayloadValue);
 	ret.Total.cacheSize = ret.joinCache.totalSize + ret.queryCache.totalSize;
 	ret.Total.indexOptimizerMemory = nsUpdateSortedContextMemory_.load(std::memory_order_relaxed);
+	if (const auto* compressor = payloadType_.Compressor(); compressor) {
+		const auto stats = compressor->GetStats();
+		// Compressed tuples may still exist after the compression was disabled
+		ret.TuplesCompression.enabled = compressor->Enabled() || stats.decompressionsCount;
+		ret.TuplesCompression.decompressionsCount = stats.decompressionsCount;
+		ret.TuplesCompression.decompressionTimeUs = stats.decompressionTimeUs;
+		ret.TuplesCompression.cacheHitsCount = stats.cacheHitsCount;
+		ret.TuplesCompression.cacheSize = stats.cacheSize;
+		ret.Total.cacheSize += stats.cacheSize;
+	}
+	if (payloadArena_) {
+		const auto stats = payloadArena_->GetStats();
+		ret.PayloadArena.enabled = true;
+		ret.PayloadArena.slabsCount = stats.slabsCount;
+		ret.PayloadArena.allocatedSize = stats.allocatedSize;
+		ret.PayloadArena.usedSize = stats.usedSize;
+		ret.PayloadArena.payloadsCount = stats.blocksCount;
+		ret.PayloadArena.compactionsCount = stats.compactionsCount;
+		ret.PayloadArena.relocatedCount = stats.relocatedCount;
+		ret.PayloadArena.compactionDisabled = indexes_.compositeIndexesSize() > 0;
+	}
 	ret.indexes.reserve(indexes_.size());
 	for (const auto& idx : indexes_) {
 		ret.indexes.emplace_back(idx->GetMemStat(ctx));
@@ -2745,6 +3012,11 @@ void NamespaceImpl::setTagsMatcher(TagsMatcher&& tm, const NsContext& ctx) {
 }
 
 void NamespaceImpl::BackgroundRoutine(RdxActivityContext* ctx) {
+	OptimizationRoutine(ctx);
+	GCRoutine(ctx);
+}
+
+void NamespaceImpl::OptimizationRoutine(RdxActivityContext* ctx) {
 	const RdxContext rdxCtx(ctx);
 	const NsContext nsCtx(rdxCtx);
 	auto replStateUpdates = replStateUpdates_.load(std::memory_order_acquire);
@@ -2756,6 +3028,102 @@ void NamespaceImpl::BackgroundRoutine(RdxActivityContext* ctx) {
 		}
 	}
 	optimizeIndexes(nsCtx);
+	compactPayloads(rdxCtx);
+}
+
+void NamespaceImpl::compactPayloads(const RdxContext& ctx) {
+	// Payloads are moved under the write lock in batches, so the queries are not blocked for the whole compaction
+	constexpr size_t kCompactionBatchSize = 10000;
+	intrusive_ptr<PayloadArena> arena;
+	{
+		auto rlck = rLock(ctx);
+		// Composite indexes' keys share the payloads with items_, so those payloads are never moved and the compaction is useless
+		if (!payloadArena_ || isSystem() || indexes_.compositeIndexesSize() || !payloadArena_->BeginCompaction()) return;
+		arena = payloadArena_;
+	}
+	try {
+		size_t relocated = 0;
+		for (size_t pos = 0; !dbDestroyed_.load(std::memory_order_relaxed);) {
+			auto wlck = wLock(ctx);
+			const size_t end = std::min(pos + kCompactionBatchSize, items_.size());
+			// Shared payloads (i.e. held by the query results) are not moved, so the payloads' addresses are stable for the readers
+			for (; pos < end; ++pos) relocated += items_[pos].Compact();
+			if (pos >= items_.size()) break;
+		}
+		logPrintf(LogTrace, "[%s] Payload arena compaction has relocated %d payloads", name_, relocated);
+	} catch (...) {
+		arena->EndCompaction();
+		throw;
+	}
+	arena->EndCompaction();
+}
+
+void NamespaceImpl::FtCommitRoutine(RdxActivityContext* ctx) {
+	const auto lastUpdateTime = lastUpdateTime_.load(std::memory_order_acquire);
+	if (!lastUpdateTime || lastUpdateTime == ftCommitUpdateTime_) return;
+
+	const RdxContext rdxCtx(ctx);
+	struct FtBuild {
+		int pos;
+		const Index* src;
+		std::shared_ptr<FtBackgroundBuild> build;
+	};
+	h_vector<FtBuild, 8> builds;
+	{
+		auto rlck = rLock(rdxCtx);
+		if (isSystem() || repl_.temporary || config_.ftCommitDebounce <= 0) {
+			ftCommitUpdateTime_ = lastUpdateTime;
+			return;
+		}
+		using namespace std::chrono;
+		const int64_t now = duration_cast<milliseconds>(system_clock_w::now_coarse().time_since_epoch()).count();
+		if (now - lastUpdateTime < config_.ftCommitDebounce || cancelCommitCnt_.load(std::memory_order_relaxed)) return;
+
+		for (int i = 0, s = indexes_.size(); i < s; ++i) {
+			const auto& idx = indexes_[i];
+			if (idx->IsFulltext() && !idx->IsBuilt()) {
+				if (auto build = idx->BeginBackgroundBuild()) {
+					builds.emplace_back(FtBuild{i, idx.get(), std::move(build)});
+				}
+			}
+		}
+	}
+	ftCommitUpdateTime_ = lastUpdateTime;
+	if (builds.empty()) return;
+
+	// Copies are built without the namespace's lock, so the writers do not wait for the build. Queries to the building indexes wait
+	// for the copies instead of building the indexes themselves
+	const auto threadsCnt = config_.optimizationSortWorkers > 0 ? std::min(unsigned(config_.optimizationSortWorkers), builds.size())
+																: std::min(4u, builds.size());
+	std::atomic<unsigned> next = {0};
+	TaskScheduler::Instance().ParallelFor(TaskScheduler::Priority::FtRebuild, threadsCnt, [&](size_t) {
+		for (unsigned num = next.fetch_add(1); num < builds.size(); num = next.fetch_add(1)) {
+			auto& build = *builds[num].build;
+			// Index was modified after the copying. Its queries will build it themselves
+			if (!build.IsCancelled() && !dbDestroyed_.load(std::memory_order_relaxed)) {
+				try {
+					build.Copy().CommitFulltext();
+				} catch (std::exception& e) {
+					logPrintf(LogError, "[%s] Background build of the fulltext index '%s' has failed: %s", name_, build.Copy().Name(),
+							  e.what());
+				}
+			}
+			build.Finish();
+		}
+	});
+
+	// Replaced data is destroyed after the lock's release
+	h_vector<std::unique_ptr<Index>, 8> replaced;
+	auto rlck = rLock(rdxCtx);
+	for (auto& b : builds) {
+		// Index may be dropped in the meantime
+		if (b.pos < int(indexes_.size()) && indexes_[b.pos].get() == b.src) {
+			replaced.emplace_back(indexes_[b.pos]->EndBackgroundBuild(b.build));
+		}
+	}
+}
+
+void NamespaceImpl::GCRoutine(RdxActivityContext* ctx) {
 	removeExpiredItems(ctx);
 	removeExpiredStrings(ctx);
 }
@@ -2885,29 +3253,26 @@ void NamespaceImpl::deleteMeta(const std::string& key, const RdxContext& ctx) {
 }
 
 void NamespaceImpl::warmupFtIndexes() {
-	h_vector<std::thread, 8> warmupThreads;
 	h_vector<Index*, 8> warmupIndexes;
 	for (auto& idx : indexes_) {
 		if (idx->RequireWarmupOnNsCopy()) {
 			warmupIndexes.emplace_back(idx.get());
 		}
 	}
-	auto threadsCnt = config_.optimizationSortWorkers > 0 ? std::min(unsigned(config_.optimizationSortWorkers), warmupIndexes.size())
-														  : std::min(4u, warmupIndexes.size());
-	warmupThreads.resize(threadsCnt);
+	commitFtIndexes(warmupIndexes);
+}
+
+void NamespaceImpl::commitFtIndexes(const h_vector<Index*, 8>& ftIndexes) {
+	auto threadsCnt = config_.optimizationSortWorkers > 0 ? std::min(unsigned(config_.optimizationSortWorkers), ftIndexes.size())
+														  : std::min(4u, ftIndexes.size());
 	std::atomic<unsigned> next = {0};
-	for (unsigned i = 0; i < warmupThreads.size(); ++i) {
-		warmupThreads[i] = std::thread([&warmupIndexes, &next] {
-			unsigned num = next.fetch_add(1);
-			while (num < warmupIndexes.size()) {
-				warmupIndexes[num]->CommitFulltext();
-				num = next.fetch_add(1);
-			}
-		});
-	}
-	for (auto& th : warmupThreads) {
-		th.join();
-	}
+	TaskScheduler::Instance().ParallelFor(TaskScheduler::Priority::FtRebuild, threadsCnt, [&](size_t) {
+		unsigned num = next.fetch_add(1);
+		while (num < ftIndexes.size()) {
+			ftIndexes[num]->CommitFulltext();
+			num = next.fetch_add(1);
+		}
+	});
 }
 
 int NamespaceImpl::getSortedIdxCount() const noexcept {
@@ -2931,13 +3296,13 @@ IdType NamespaceImpl::createItem(size_t realSize) {
 		free_.pop_back();
 		assertrx(id < IdType(items_.size()));
 		assertrx(items_[id].IsFree());
-		items_[id] = PayloadValue(realSize);
+		items_[id] = PayloadValue(realSize, nullptr, 0, payloadArena_.get());
 	} else {
 		id = items_.size();
 		if (id == std::numeric_limits<IdType>::max()) {
 			throw Error(errParams, "Max item ID value is reached: %d", id);
 		}
-		items_.emplace_back(PayloadValue(realSize));
+		items_.emplace_back(PayloadValue(realSize, nullptr, 0, payloadArena_.get()));
 	}
 	return id;
 }
@@ -8,11 +8,13 @@
 #include <vector>
 #include "asyncstorage.h"
 #include "core/cjson/tagsmatcher.h"
+#include "core/compositesubstitutioncache.h"
 #include "core/dbconfig.h"
 #include "core/index/keyentry.h"
 #include "core/item.h"
 #include "core/joincache.h"
 #include "core/namespacedef.h"
+#include "core/payload/payloadarena.h"
 #include "core/payload/payloadiface.h"
 #include "core/perfstatcounter.h"
 #include "core/querycache.h"
@@ -51,6 +53,7 @@ class RdxContext;
 class RdxActivityContext;
 class SortExpression;
 class ProtobufSchema;
+class IndexInserters;
 class QueryResults;
 
 namespace long_actions {
@@ -242,6 +245,10 @@ public:
 	std::vector<std::string> EnumMeta(const RdxContext &ctx);
 
 	void BackgroundRoutine(RdxActivityContext *);
+	// Parts of the background routine, which are executed with the different priorities
+	void OptimizationRoutine(RdxActivityContext *);
+	void GCRoutine(RdxActivityContext *);
+	void FtCommitRoutine(RdxActivityContext *);
 	void StorageFlushingRoutine();
 	void CloseStorage(const RdxContext &);
 
@@ -350,11 +357,34 @@ private:
 	void markUpdated(bool forceOptimizeAllIndexes);
 	void doUpdate(const Query &query, QueryResults &result, const NsContext &);
 	void doDelete(const Query &query, QueryResults &result, const NsContext &);
+	// Selects the items, which will be modified by UPDATE/DELETE query. Requires read lock
+	void selectForModification(const Query &query, QueryResults &result, QueryType type, const NsContext &ctx);
+	// Fills the results of UPDATE/DELETE query with the items, selected from the other version of this namespace.
+	// Both of the versions must have the same items
+	void addPreselected(const Query &query, QueryResults &result, const QueryResults &preselected);
+	// Apply UPDATE/DELETE query to the items, which were already added to the results
+	void updateSelected(const Query &query, QueryResults &result, const NsContext &);
+	void deleteSelected(const Query &query, QueryResults &result, const NsContext &);
+	// Selects values of the single-field PK for the items, matched by UPDATE/DELETE query.
+	// Returns false, if namespace does not have such PK. Takes read lock
+	bool selectQueryPKs(const Query &query, std::string &pkIndexName, VariantArray &pks, const RdxContext &ctx);
 	void doTruncate(const NsContext &ctx);
 	void doUpsert(ItemImpl *ritem, IdType id, bool doUpdate);
 	void modifyItem(Item &item, ItemModifyMode mode, const NsContext &);
 	void doModifyItem(Item &item, ItemModifyMode mode, const NsContext &ctx);
+	// Modifies item, which has been already prepared and searched by PK
+	void doModifyItem(Item &item, ItemModifyMode mode, std::pair<IdType, bool> realItem, const NsContext &ctx);
 	void deleteItem(Item &item, const NsContext &ctx);
+	struct TxNewItem {
+		Item item;
+		ItemModifyMode mode;
+	};
+	// Returns field of the simple PK index, if new items of the transaction may be inserted into the indexes in parallel, and -1 otherwise
+	int txParallelInsertionPKField(size_t txSteps) const;
+	// Creates new item with WAL record and inserts it into the PK index only
+	void addTxNewItem(Item &item, int pkField, IndexInserters &, const NsContext &);
+	// Inserts new items into the rest of indexes in parallel, then writes them to the storage and replicates them in the original order
+	void insertTxNewItems(std::vector<TxNewItem> &, int pkField, IndexInserters &, QueryResults &, const NsContext &);
 	void updateTagsMatcherFromItem(ItemImpl *ritem);
 	template <NeedRollBack needRollBack>
 	[[nodiscard]] RollBack_updateItems<needRollBack> updateItems(const PayloadType &oldPlType, const FieldsSet &changedFields,
@@ -380,6 +410,7 @@ private:
 					   std::optional<PKModifyRevertData> &&modifyData);
 	void removeExpiredItems(RdxActivityContext *);
 	void removeExpiredStrings(RdxActivityContext *);
+	void compactPayloads(const RdxContext &);
 	void setTagsMatcher(TagsMatcher &&tm, const NsContext &ctx);
 	Item newItem();
 
@@ -416,6 +447,8 @@ private:
 	std::vector<std::string> enumMeta() const;
 
 	void warmupFtIndexes();
+	// Commits the fulltext indexes in parallel on the shared scheduler
+	void commitFtIndexes(const h_vector<Index *, 8> &ftIndexes);
 	void updateSelectTime() noexcept {
 		using namespace std::chrono;
 		lastSelectTime_ = duration_cast<seconds>(system_clock_w::now().time_since_epoch()).count();
@@ -488,6 +521,7 @@ private:
 	NamespaceConfigData config_;
 	std::unique_ptr<QueryCountCache> queryCountCache_;
 	std::unique_ptr<JoinCache> joinCache_;
+	std::unique_ptr<CompositeSubstitutionCache> compositeSubstitutionCache_;
 	// Replication variables
 	WALTracker wal_;
 	ReplicationState repl_;
@@ -499,6 +533,8 @@ private:
 	sync_pool<ItemImpl, 1024> pool_;
 	std::atomic<int32_t> cancelCommitCnt_{0};
 	std::atomic<int64_t> lastUpdateTime_;
+	// Value of lastUpdateTime_, which was handled by the last background fulltext commit
+	int64_t ftCommitUpdateTime_ = 0;
 
 	std::atomic<uint32_t> itemsCount_ = {0};
 	std::atomic<uint32_t> itemsCapacity_ = {0};
@@ -507,6 +543,7 @@ private:
 	int serverId_ = 0;
 	std::atomic<bool> serverIdChanged_;
 	size_t itemsDataSize_ = 0;
+	intrusive_ptr<PayloadArena> payloadArena_;
 
 	std::atomic<int> optimizationState_{OptimizationState::NotOptimized};
 	StringsHolderPtr strHolder_;
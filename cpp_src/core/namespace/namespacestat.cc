@@ -32,6 +32,25 @@ void NamespaceMemStat::GetJSON(WrSerializer &ser) {
 		.Put("cache_size", Total.cacheSize)
 		.Put("index_optimizer_memory", Total.indexOptimizerMemory);
 
+	if (TuplesCompression.enabled) {
+		builder.Object("tuples_compression")
+			.Put("decompressions_count", TuplesCompression.decompressionsCount)
+			.Put("decompression_time_us", TuplesCompression.decompressionTimeUs)
+			.Put("cache_hits_count", TuplesCompression.cacheHitsCount)
+			.Put("cache_size", TuplesCompression.cacheSize);
+	}
+	if (PayloadArena.enabled) {
+		builder.Object("payload_arena")
+			.Put("slabs_count", PayloadArena.slabsCount)
+			.Put("allocated_size", PayloadArena.allocatedSize)
+			.Put("used_size", PayloadArena.usedSize)
+			.Put("payloads_count", PayloadArena.payloadsCount)
+			.Put("fragmentation", PayloadArena.Fragmentation())
+			.Put("compactions_count", PayloadArena.compactionsCount)
+			.Put("relocated_count", PayloadArena.relocatedCount)
+			.Put("compaction_disabled", PayloadArena.compactionDisabled);
+	}
+
 	{
 		auto obj = builder.Object("replication");
 		replication.GetJSON(obj);
@@ -58,6 +77,12 @@ void LRUCacheMemStat::GetJSON(JsonBuilder &builder) {
 	builder.Put("items_count", itemsCount);
 	builder.Put("empty_count", emptyCount);
 	builder.Put("hit_count_limit", hitCountLimit);
+	builder.Put("hits_count", hitsCount);
+	builder.Put("misses_count", missesCount);
+	builder.Put("hit_bytes", hitBytes);
+	builder.Put("evicted_count", evictedCount);
+	builder.Put("evicted_bytes", evictedBytes);
+	builder.Put("rejected_count", rejectedCount);
 }
 
 void IndexMemStat::GetJSON(JsonBuilder &builder) {
@@ -72,8 +97,15 @@ void IndexMemStat::GetJSON(JsonBuilder &builder) {
 	if (sortOrdersSize) builder.Put("sort_orders_size", sortOrdersSize);
 	if (fulltextSize) builder.Put("fulltext_size", fulltextSize);
 	if (columnSize) builder.Put("column_size", columnSize);
+	if (dictionarySize) builder.Put("dictionary_size", dictionarySize);
+	if (compressedTuplesCount) {
+		builder.Put("compressed_tuples_count", compressedTuplesCount);
+		builder.Put("compressed_tuples_size", compressedTuplesSize);
+		builder.Put("uncompressed_tuples_size", uncompressedTuplesSize);
+	}
 
-	if (idsetCache.totalSize || idsetCache.itemsCount || idsetCache.emptyCount || idsetCache.hitCountLimit) {
+	if (idsetCache.totalSize || idsetCache.itemsCount || idsetCache.emptyCount || idsetCache.hitCountLimit || idsetCache.hitsCount ||
+		idsetCache.missesCount) {
 		auto obj = builder.Object("idset_cache");
 		idsetCache.GetJSON(obj);
 	}
@@ -109,6 +141,10 @@ void NamespacePerfStat::GetJSON(WrSerializer &ser) {
 		auto obj = builder.Object("transactions");
 		transactions.GetJSON(obj);
 	}
+	{
+		auto obj = builder.Object("background_tasks");
+		backgroundTasks.GetJSON(obj);
+	}
 
 	auto arr = builder.Array("indexes");
 
@@ -276,6 +312,17 @@ void ReplicationStat::GetJSON(JsonBuilder &builder) {
 	}
 }
 
+void BgTasksPerfStat::GetJSON(JsonBuilder &builder) {
+	builder.Put("total_count", totalCount);
+	builder.Put("skipped_count", skippedCount);
+	builder.Put("avg_queue_wait_us", avgQueueWaitUs);
+	builder.Put("min_queue_wait_us", minQueueWaitUs);
+	builder.Put("max_queue_wait_us", maxQueueWaitUs);
+	builder.Put("avg_exec_time_us", avgExecTimeUs);
+	builder.Put("min_exec_time_us", minExecTimeUs);
+	builder.Put("max_exec_time_us", maxExecTimeUs);
+}
+
 void TxPerfStat::GetJSON(JsonBuilder &builder) {
 	builder.Put("total_count", totalCount);
 	builder.Put("total_copy_count", totalCopyCount);
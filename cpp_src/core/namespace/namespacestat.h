@@ -22,6 +22,14 @@ struct LRUCacheMemStat {
 	size_t itemsCount = 0;
 	size_t emptyCount = 0;
 	size_t hitCountLimit = 0;
+	// Lookups, which have found the stored value, and the total size of the values found
+	size_t hitsCount = 0;
+	size_t hitBytes = 0;
+	size_t missesCount = 0;
+	size_t evictedCount = 0;
+	size_t evictedBytes = 0;
+	// Values, which were not stored, because they are cheaper than the evicted ones would be
+	size_t rejectedCount = 0;
 };
 
 struct IndexMemStat {
@@ -34,13 +42,18 @@ struct IndexMemStat {
 	size_t sortOrdersSize = 0;
 	size_t fulltextSize = 0;
 	size_t columnSize = 0;
+	size_t dictionarySize = 0;
 	size_t trackedUpdatesCount = 0;
 	size_t trackedUpdatesBuckets = 0;
 	size_t trackedUpdatesSize = 0;
 	size_t trackedUpdatesOveflow = 0;
+	// Stats of the compressed tuples. Applicable only to the '-tuple' index
+	size_t compressedTuplesCount = 0;
+	size_t compressedTuplesSize = 0;
+	size_t uncompressedTuplesSize = 0;
 	LRUCacheMemStat idsetCache;
 	size_t GetIndexStructSize() const noexcept {
-		return idsetPlainSize + idsetBTreeSize + sortOrdersSize + fulltextSize + columnSize + trackedUpdatesSize;
+		return idsetPlainSize + idsetBTreeSize + sortOrdersSize + fulltextSize + columnSize + dictionarySize + trackedUpdatesSize;
 	}
 };
 
@@ -119,6 +132,25 @@ struct NamespaceMemStat {
 		size_t cacheSize = 0;
 		size_t indexOptimizerMemory = 0;
 	} Total;
+	struct {
+		bool enabled = false;
+		size_t decompressionsCount = 0;
+		size_t decompressionTimeUs = 0;
+		size_t cacheHitsCount = 0;
+		size_t cacheSize = 0;
+	} TuplesCompression;
+	struct {
+		bool enabled = false;
+		size_t slabsCount = 0;
+		size_t allocatedSize = 0;
+		size_t usedSize = 0;
+		size_t payloadsCount = 0;
+		size_t compactionsCount = 0;
+		size_t relocatedCount = 0;
+		// Composite indexes hold the references to the payloads, so the payloads can not be moved
+		bool compactionDisabled = false;
+		double Fragmentation() const noexcept { return allocatedSize ? 1.0 - double(usedSize) / allocatedSize : 0.0; }
+	} PayloadArena;
 	ReplicationStat replication;
 	LRUCacheMemStat joinCache;
 	LRUCacheMemStat queryCache;
@@ -158,6 +190,20 @@ struct TxPerfStat {
 	size_t maxCopyTimeUs;
 };
 
+struct BgTasksPerfStat {
+	void GetJSON(JsonBuilder &builder);
+
+	size_t totalCount = 0;
+	// Runs of the routines, which were skipped, because the previous task of the same routine was still queued or running
+	size_t skippedCount = 0;
+	size_t avgQueueWaitUs = 0;
+	size_t minQueueWaitUs = 0;
+	size_t maxQueueWaitUs = 0;
+	size_t avgExecTimeUs = 0;
+	size_t minExecTimeUs = 0;
+	size_t maxExecTimeUs = 0;
+};
+
 struct IndexPerfStat {
 	IndexPerfStat() = default;
 	IndexPerfStat(const std::string &n, const PerfStat &s, const PerfStat &c) : name(n), selects(s), commits(c) {}
@@ -176,6 +222,8 @@ struct NamespacePerfStat {
 	PerfStat updates;
 	PerfStat selects;
 	TxPerfStat transactions;
+	// Background routines (optimization, fulltext commit, GC) of the namespace
+	BgTasksPerfStat backgroundTasks;
 	std::vector<IndexPerfStat> indexes;
 };
 
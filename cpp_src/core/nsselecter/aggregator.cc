@@ -206,6 +206,23 @@ bool Aggregator::SinglefieldComparator::operator()(const std::pair<Variant, int>
 Aggregator::Aggregator(Aggregator &&) noexcept = default;
 Aggregator::~Aggregator() = default;
 
+size_t Aggregator::MemoryUsage() const noexcept {
+	// Keys share payloads and strings with the namespace's items, so only the containers' nodes are taken into account
+	constexpr size_t kNodeOverhead = 2 * sizeof(void *);
+	size_t ret = 0;
+	if (facets_) {
+		ret += std::visit(
+			[](const auto &facets) noexcept {
+				return facets.size() * (sizeof(typename std::decay_t<decltype(facets)>::value_type) + kNodeOverhead);
+			},
+			*facets_);
+	}
+	if (distincts_) {
+		ret += distincts_->size() * (sizeof(Variant) + kNodeOverhead) + distincts_->bucket_count() * sizeof(void *);
+	}
+	return ret;
+}
+
 Aggregator::Aggregator(const PayloadType &payloadType, const FieldsSet &fields, AggType aggType, const h_vector<std::string, 1> &names,
 					   const h_vector<SortingEntry, 1> &sort, size_t limit, size_t offset, bool compositeIndexFields)
 	: payloadType_(payloadType),
@@ -322,7 +339,26 @@ AggregationResult Aggregator::GetResult() const {
 	return ret;
 }
 
-void Aggregator::Aggregate(const PayloadValue &data) {
+void Aggregator::BindSparseColumn(const SparseColumnView &column) noexcept {
+	switch (aggType_) {
+		case AggSum:
+		case AggAvg:
+		case AggMin:
+		case AggMax:
+			if (fields_.size() == 1 && fields_[0] == IndexValueType::SetByJsonPath) {
+				sparseColumn_ = column;
+			}
+			break;
+		case AggFacet:
+		case AggDistinct:
+		case AggUnknown:
+		case AggCount:
+		case AggCountCached:
+			break;
+	}
+}
+
+void Aggregator::Aggregate(const PayloadValue &data, IdType rowId) {
 	if (aggType_ == AggFacet) {
 		const bool done =
 			std::visit(overloaded{[&data](MultifieldUnorderedMap &fm) {
@@ -344,6 +380,17 @@ void Aggregator::Aggregate(const PayloadValue &data) {
 
 	assertrx(fields_.size() == 1);
 	if (fields_[0] == IndexValueType::SetByJsonPath) {
+		if (sparseColumn_.Valid()) {
+			switch (sparseColumn_.GetState(rowId)) {
+				case SparseColumnView::Empty:
+					return;
+				case SparseColumnView::Value:
+					aggregate(Variant{sparseColumn_.AsDouble(rowId)});
+					return;
+				case SparseColumnView::Tuple:
+					break;
+			}
+		}
 		ConstPayload pl(payloadType_, data);
 		VariantArray va;
 		const TagsPath &tagsPath = fields_.getTagsPath(0);
@@ -3,6 +3,7 @@
 #include <optional>
 #include <unordered_set>
 #include "core/index/payload_map.h"
+#include "core/index/sparsecolumn.h"
 #include "core/query/queryentry.h"
 #include "estl/one_of.h"
 #include "vendor/cpp-btree/btree_map.h"
@@ -25,8 +26,12 @@ public:
 	Aggregator(Aggregator &&) noexcept;
 	~Aggregator();
 
-	void Aggregate(const PayloadValue &lhs);
+	void Aggregate(const PayloadValue &lhs, IdType rowId);
+	// Numeric aggregations over the sparse index read its values from the column instead of the tuple decoding
+	void BindSparseColumn(const SparseColumnView &) noexcept;
 	AggregationResult GetResult() const;
+	// Approximate size of the facets and distincts containers in bytes
+	size_t MemoryUsage() const noexcept;
 
 	Aggregator(const Aggregator &) = delete;
 	Aggregator &operator=(const Aggregator &) = delete;
@@ -59,6 +64,7 @@ private:
 	size_t offset_ = QueryEntry::kDefaultOffset;
 
 	std::unique_ptr<Facets> facets_;
+	SparseColumnView sparseColumn_;
 
 	class RelaxVariantCompare {
 	public:
@@ -94,6 +94,9 @@ static std::string addToJSON(JsonBuilder &builder, const JoinedSelector &js, OpT
 	jsonSel.Put("field"sv, opName(op) + name);
 	jsonSel.Put("matched"sv, js.Matched());
 	jsonSel.Put("selects_count"sv, js.Called());
+	if (js.BatchSelects()) {
+		jsonSel.Put("batch_selects_count"sv, js.BatchSelects());
+	}
 	jsonSel.Put("join_select_total"sv, ExplainCalc::To_us(js.SelectTime()));
 	switch (js.Type()) {
 		case JoinType::InnerJoin:
@@ -102,6 +105,11 @@ static std::string addToJSON(JsonBuilder &builder, const JoinedSelector &js, OpT
 			std::visit(overloaded{[&](const JoinPreResult::Values &values) {
 									  jsonSel.Put("method"sv, "preselected_values"sv);
 									  jsonSel.Put("keys"sv, values.size());
+									  if (js.HashJoinUsed()) {
+										  jsonSel.Put("hash_join"sv, true);
+										  jsonSel.Put("hash_build_us"sv, ExplainCalc::To_us(js.HashBuildTime()));
+										  jsonSel.Put("hash_probe_us"sv, ExplainCalc::To_us(js.HashProbeTime()));
+									  }
 								  },
 								  [&](const IdSet &ids) {
 									  jsonSel.Put("method"sv, "preselected_rows"sv);
@@ -197,6 +205,7 @@ std::string ExplainCalc::GetJSON() {
 			json.Put("postprocess_us"sv, To_us(postprocess_));
 			json.Put("loop_us"sv, To_us(loop_));
 			json.Put("general_sort_us"sv, To_us(sort_));
+			json.Put("peak_memory_bytes"sv, peakMemory_);
 			if (!subqueries_.empty()) {
 				auto subQuries = json.Array("subqueries");
 				for (const auto &sq : subqueries_) {
@@ -210,6 +219,7 @@ std::string ExplainCalc::GetJSON() {
 		}
 		json.Put("sort_index"sv, sortIndex_);
 		json.Put("sort_by_uncommitted_index"sv, sortOptimization_);
+		json.Put("index_only"sv, indexOnly_);
 
 		{
 			auto jsonSelArr = json.Array("selectors"sv);
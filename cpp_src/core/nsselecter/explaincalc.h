@@ -81,6 +81,8 @@ public:
 	void SetPreselectTime(Duration preselectTime) noexcept { preselect_ = preselectTime; }
 	void PutOnConditionInjections(const OnConditionInjections* onCondInjections) noexcept { onInjections_ = onCondInjections; }
 	void SetSortOptimization(bool enable) noexcept { sortOptimization_ = enable; }
+	void SetIndexOnly(bool enable) noexcept { indexOnly_ = enable; }
+	void SetPeakMemory(size_t bytes) noexcept { peakMemory_ = bytes; }
 	void SetSubQueriesExplains(std::vector<SubQueryExplain>&& subQueriesExpl) noexcept { subqueries_ = std::move(subQueriesExpl); }
 
 	void LogDump(int logLevel);
@@ -123,7 +125,9 @@ private:
 
 	int iters_ = 0;
 	int count_ = 0;
+	size_t peakMemory_ = 0;
 	bool sortOptimization_ = false;
+	bool indexOnly_ = false;
 	bool enabled_ = false;
 };
 
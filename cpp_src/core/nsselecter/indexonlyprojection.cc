@@ -0,0 +1,35 @@
+#include "indexonlyprojection.h"
+#include "core/cjson/cjsonbuilder.h"
+#include "core/payload/payloadiface.h"
+
+namespace reindexer {
+
+IndexOnlyProjection::IndexOnlyProjection(const PayloadType &type, const h_vector<Field, 4> &fields, std::vector<key_string> &stringsHolder)
+	: template_(type.TotalSize()), size_(type.TotalSize()) {
+	Payload pl(type, template_);
+	// Non-selected fields are not referenced by the tuple, but string fields have to be valid for the strings copying (e.g. in GetItem)
+	const key_string emptyString = make_key_string();
+	for (int field = 1, numFields = type.NumFields(); field < numFields; ++field) {
+		const PayloadFieldType &fieldType = type.Field(field);
+		if (!fieldType.IsArray() && fieldType.Type().Is<KeyValueType::String>()) {
+			pl.Set(field, Variant(emptyString));
+		}
+	}
+	stringsHolder.emplace_back(emptyString);
+
+	WrSerializer wrser;
+	{
+		CJsonBuilder builder(wrser, ObjType::TypeObject);
+		for (const auto &f : fields) {
+			const PayloadFieldType &fieldType = type.Field(f.field);
+			assertrx_throw(!fieldType.IsArray() && fieldType.Sizeof() == f.column.elemSize);
+			builder.Ref(f.tagName, pl.Get(f.field, 0), f.field);
+			fields_.emplace_back(ColumnField{fieldType.Offset(), f.column});
+		}
+	}
+	const key_string tuple = make_key_string(wrser.Slice());
+	pl.Set(0, Variant(tuple));
+	stringsHolder.emplace_back(tuple);
+}
+
+}  // namespace reindexer
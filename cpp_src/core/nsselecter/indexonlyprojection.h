@@ -0,0 +1,45 @@
+#pragma once
+
+#include "core/index/indexcolumn.h"
+#include "core/keyvalue/key_string.h"
+#include "core/payload/payloadtype.h"
+#include "core/payload/payloadvalue.h"
+#include "estl/h_vector.h"
+
+namespace reindexer {
+
+/// Builder of the results' payloads for the query, which selects the fields of the column indexes only. Selected fields are copied
+/// from the indexes' columns into the payload of the query's template, so the namespace's payloads are not touched at all.
+/// Tuple of the template refers to the selected fields only
+class IndexOnlyProjection {
+public:
+	struct Field {
+		int field;
+		int tagName;
+		IndexColumnView column;
+	};
+
+	/// Template's strings (tuple and empty values of the string fields) are added to the stringsHolder, which has to outlive the payloads
+	IndexOnlyProjection(const PayloadType &, const h_vector<Field, 4> &fields, std::vector<key_string> &stringsHolder);
+
+	PayloadValue Build(IdType rowId) const {
+		PayloadValue pv(size_, template_.Ptr());
+		uint8_t *ptr = pv.Ptr();
+		for (const auto &f : fields_) {
+			if (f.column.Contains(rowId)) memcpy(ptr + f.offset, f.column.Ptr(rowId), f.column.elemSize);
+		}
+		return pv;
+	}
+
+private:
+	struct ColumnField {
+		size_t offset;
+		IndexColumnView column;
+	};
+
+	PayloadValue template_;
+	size_t size_;
+	h_vector<ColumnField, 4> fields_;
+};
+
+}  // namespace reindexer
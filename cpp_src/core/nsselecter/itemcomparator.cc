@@ -70,6 +70,23 @@ bool ItemComparator::operator()(const ItemRef &lhs, const ItemRef &rhs) const {
 																					 mainNsRes.firstDifferentFieldIdx, collateOpts_);
 						   }
 						   return mainNsRes.GetResult(c.desc);
+					   },
+					   [&](CompareBySparseColumn c) {
+						   const auto &column = sparseColumns_[c.column];
+						   const auto lState = column.view.GetState(lhs.Id());
+						   const auto rState = column.view.GetState(rhs.Id());
+						   int res;
+						   if (lState == SparseColumnView::Tuple || rState == SparseColumnView::Tuple) {
+							   size_t firstDifferentFieldIdx = 0;
+							   res = ConstPayload(ns_.payloadType_, ns_.items_[lhs.Id()])
+										 .Compare<WithString::No>(ns_.items_[rhs.Id()], column.fields, firstDifferentFieldIdx, column.collateOpts);
+						   } else if (lState != rState) {
+							   // Item without the field goes first (the same as for the tuple's values comparison)
+							   res = (lState == SparseColumnView::Empty) ? -1 : 1;
+						   } else {
+							   res = (lState == SparseColumnView::Empty) ? 0 : column.view.Compare(lhs.Id(), rhs.Id());
+						   }
+						   return c.desc ? -res : res;
 					   }},
 			comp);
 		if (res != 0) return res < 0;
@@ -88,6 +105,10 @@ public:
 	void fields(int fieldIdx) { comparator_.fields_.push_back(fieldIdx); }
 	void fields(Joined &joined, int fieldIdx) { joined.fields.push_back(fieldIdx); }
 	void index(bool desc) { comparator_.comparators_.emplace_back(CompareByField{desc}); }
+	void sparseColumn(SparseColumn &&column, bool desc) {
+		comparator_.sparseColumns_.emplace_back(std::move(column));
+		comparator_.comparators_.emplace_back(CompareBySparseColumn{comparator_.sparseColumns_.size() - 1, desc});
+	}
 	void joined(size_t nsIdx, bool desc) { comparator_.comparators_.emplace_back(CompareByJoinedField{nsIdx, desc}); }
 	void collateOpts(const CollateOpts *opts) { comparator_.collateOpts_.emplace_back(opts); }
 	void collateOpts(Joined &joined, const CollateOpts *opts) { joined.collateOpts.emplace_back(opts); }
@@ -105,6 +126,11 @@ public:
 	void fields(int fieldIdx) { comparator_.fields_.push_front(fieldIdx); }
 	void fields(Joined &joined, int fieldIdx) { joined.fields.push_front(fieldIdx); }
 	void index(bool desc) { comparator_.comparators_.emplace(comparator_.comparators_.begin(), CompareByField{desc}); }
+	void sparseColumn(SparseColumn &&column, bool desc) {
+		comparator_.sparseColumns_.emplace_back(std::move(column));
+		comparator_.comparators_.emplace(comparator_.comparators_.begin(),
+										 CompareBySparseColumn{comparator_.sparseColumns_.size() - 1, desc});
+	}
 	void joined(size_t nsIdx, bool desc) {
 		comparator_.comparators_.emplace(comparator_.comparators_.begin(), CompareByJoinedField{nsIdx, desc});
 	}
@@ -177,6 +203,19 @@ void ItemComparator::bindOne(const SortingContext::Entry &sortingEntry, Inserter
 				   },
 				   [&](const SortingContext::FieldEntry &e) {
 					   const int fieldIdx = e.data.index;
+					   if (fieldIdx != IndexValueType::SetByJsonPath && ns_.indexes_[fieldIdx]->SparseColumn().Valid()) {
+						   if (std::any_of(sparseColumns_.begin(), sparseColumns_.end(),
+										   [fieldIdx](const SparseColumn &c) noexcept { return c.index == fieldIdx; })) {
+							   throw Error(errQueryExec, "You cannot sort by the same indexes twice: %s", e.data.expression);
+						   }
+						   const auto &index = *ns_.indexes_[fieldIdx];
+						   assertrx_throw(index.Fields().getTagsPathsLength() > 0);
+						   FieldsSet fields;
+						   fields.push_back(index.Fields().getTagsPath(0));
+						   insert.sparseColumn(SparseColumn{fieldIdx, index.SparseColumn(), std::move(fields), {e.opts}}, e.data.desc);
+						   // Collate options of the column are stored separately from the payload fields ones
+						   return;
+					   }
 					   if (fieldIdx == IndexValueType::SetByJsonPath || ns_.indexes_[fieldIdx]->Opts().IsSparse()) {
 						   TagsPath tagsPath;
 						   if (fieldIdx != IndexValueType::SetByJsonPath) {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "core/index/sparsecolumn.h"
 #include "core/payload/fieldsset.h"
 #include "sortingcontext.h"
 
@@ -39,6 +40,17 @@ private:
 	struct CompareByExpression {
 		bool desc;
 	};
+	struct CompareBySparseColumn {
+		size_t column;
+		bool desc;
+	};
+	// Sparse index with the materialized column. Tuple is decoded only for the rows, which values are not stored in the column
+	struct SparseColumn {
+		int index;
+		SparseColumnView view;
+		FieldsSet fields;
+		h_vector<const CollateOpts *, 1> collateOpts;
+	};
 	struct Joined {
 		const JoinedSelector *joinedSelector{nullptr};
 		FieldsSet fields;
@@ -51,7 +63,8 @@ private:
 	FieldsSet fields_;
 	Joined joined_;
 	h_vector<const CollateOpts *, 1> collateOpts_;
-	h_vector<std::variant<CompareByField, CompareByJoinedField, CompareByExpression>, 4> comparators_;
+	h_vector<SparseColumn, 1> sparseColumns_;
+	h_vector<std::variant<CompareByField, CompareByJoinedField, CompareByExpression, CompareBySparseColumn>, 4> comparators_;
 };
 
 }  // namespace reindexer
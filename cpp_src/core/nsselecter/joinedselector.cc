@@ -7,6 +7,7 @@
 #include "vendor/sparse-map/sparse_set.h"
 
 constexpr size_t kMaxIterationsScaleForInnerJoinOptimization = 100;
+constexpr size_t kMinPreResultValuesForHashJoin = 32;
 
 namespace reindexer {
 
@@ -67,6 +68,68 @@ void JoinedSelector::selectFromPreResultValues(QueryResults &joinItemR, const Qu
 	matchedAtLeastOnce = matched;
 }
 
+JoinHashTable::Ptr JoinPreResult::Values::HashTable(const QueryEntry &qe, bool &built) const {
+	std::lock_guard lck(hashTablesMtx_);
+	for (const auto &t : hashTables_) {
+		if (t.first == qe.FieldName()) {
+			built = false;
+			return t.second;
+		}
+	}
+	auto table = std::make_shared<const JoinHashTable>(*this, payloadType, qe);
+	hashTables_.emplace_back(qe.FieldName(), table);
+	built = true;
+	return table;
+}
+
+void JoinedSelector::initHashJoin(const JoinPreResult::Values &values) {
+	hashJoinChecked_ = true;
+	if (values.size() < kMinPreResultValuesForHashJoin) return;
+	const auto &entries = itemQuery_.Entries();
+	assertrx_throw(entries.Size() == joinQuery_.joinEntries_.size());
+	// Any of the mandatory equality conditions may be used as the hash join key
+	for (size_t i = 0; i < joinQuery_.joinEntries_.size(); ++i) {
+		const QueryJoinEntry &je = joinQuery_.joinEntries_[i];
+		if (je.Operation() != OpAnd || (je.Condition() != CondEq && je.Condition() != CondSet) ||
+			(i + 1 < joinQuery_.joinEntries_.size() && joinQuery_.joinEntries_[i + 1].Operation() == OpOr) || !entries.Is<QueryEntry>(i)) {
+			continue;
+		}
+		const auto startTime = ExplainCalc::Clock::now();
+		bool built = false;
+		auto table = values.HashTable(entries.Get<QueryEntry>(i), built);
+		if (built) hashBuildTime_ += ExplainCalc::Clock::now() - startTime;
+		if (table->Valid()) {
+			hashKeyEntryIdx_ = i;
+			hashTable_ = std::move(table);
+			return;
+		}
+	}
+}
+
+void JoinedSelector::selectFromPreResultValuesByHash(QueryResults &joinItemR, const Query &query, bool &found, bool &matchedAtLeastOnce) {
+	const auto startTime = ExplainCalc::Clock::now();
+	const auto &entries = query.Entries();
+	// Key condition may be replaced with AlwaysFalse for the empty left values
+	if (entries.Is<QueryEntry>(hashKeyEntryIdx_) && hashTable_->Find(entries.Get<QueryEntry>(hashKeyEntryIdx_).Values(), hashCandidates_)) {
+		size_t matched = 0;
+		const JoinPreResult::Values &values = std::get<JoinPreResult::Values>(PreResult().preselectedPayload);
+		const auto &pt = values.payloadType;
+		for (uint32_t pos : hashCandidates_) {
+			const ItemRef &item = values[pos];
+			if (entries.CheckIfSatisfyConditions({pt, item.Value()})) {
+				if (++matched > query.Limit()) break;
+				found = true;
+				joinItemR.Add(item);
+			}
+		}
+		matchedAtLeastOnce = matched;
+	} else if (entries.Is<QueryEntry>(hashKeyEntryIdx_)) {
+		// Left values of the different kind. Fallback to the full scan
+		selectFromPreResultValues(joinItemR, query, found, matchedAtLeastOnce);
+	}
+	hashProbeTime_ += ExplainCalc::Clock::now() - startTime;
+}
+
 bool JoinedSelector::Process(IdType rowId, int nsId, ConstPayload payload, bool match) {
 	++called_;
 	if (optimized_ && !match) {
@@ -101,7 +164,14 @@ bool JoinedSelector::Process(IdType rowId, int nsId, ConstPayload payload, bool
 	bool matchedAtLeastOnce = false;
 	QueryResults joinItemR;
 	std::visit(
-		overloaded{[&](const JoinPreResult::Values &) { selectFromPreResultValues(joinItemR, *itemQueryPtr, found, matchedAtLeastOnce); },
+		overloaded{[&](const JoinPreResult::Values &values) {
+					   if (!hashJoinChecked_) initHashJoin(values);
+					   if (hashTable_) {
+						   selectFromPreResultValuesByHash(joinItemR, *itemQueryPtr, found, matchedAtLeastOnce);
+					   } else {
+						   selectFromPreResultValues(joinItemR, *itemQueryPtr, found, matchedAtLeastOnce);
+					   }
+				   },
 				   Restricted<IdSet, SelectIteratorContainer>{}(
 					   [&](const auto &) { selectFromRightNs(joinItemR, *itemQueryPtr, found, matchedAtLeastOnce); })},
 		PreResult().preselectedPayload);
@@ -116,6 +186,125 @@ bool JoinedSelector::Process(IdType rowId, int nsId, ConstPayload payload, bool
 	return matchedAtLeastOnce;
 }
 
+bool JoinedSelector::BatchModeAvailable() {
+	if (batchMode_ != BatchMode::Unknown) return batchMode_ == BatchMode::Available;
+	batchMode_ = BatchMode::Unavailable;
+	// Limited join is processed row by row: the batch select would materialize all of the rows' matches, while each row requires only
+	// 'limit' of them
+	if (joinType_ != JoinType::LeftJoin || !rightNs_ || std::holds_alternative<JoinPreResult::Values>(PreResult().preselectedPayload) ||
+		!itemQuery_.sortingEntries_.empty() || itemQuery_.Entries().Size() != joinQuery_.joinEntries_.size() || joinQuery_.HasLimit()) {
+		return false;
+	}
+	// Each of the join conditions has to be mandatory equality. Otherwise merged keys do not produce superset of the rows' results
+	for (size_t i = 0; i < joinQuery_.joinEntries_.size(); ++i) {
+		const QueryJoinEntry &je = joinQuery_.joinEntries_[i];
+		if (je.Operation() != OpAnd || (je.Condition() != CondEq && je.Condition() != CondSet) || !itemQuery_.Entries().Is<QueryEntry>(i)) {
+			return false;
+		}
+		// Results are distributed between the rows without index's collation
+		const QueryEntry &qe = itemQuery_.Entries().Get<QueryEntry>(i);
+		if (qe.IsFieldIndexed() && rightNs_->indexes_[qe.IndexNo()]->Opts().GetCollateMode() != CollateNone) {
+			return false;
+		}
+	}
+	batchMode_ = BatchMode::Available;
+	return true;
+}
+
+bool JoinedSelector::fillRowValues(Query &query, ConstPayload payload) const {
+	for (size_t i = 0; i < joinQuery_.joinEntries_.size(); ++i) {
+		const QueryJoinEntry &je = joinQuery_.joinEntries_[i];
+		QueryEntry &qentry = query.GetUpdatableEntry<QueryEntry>(i);
+		{
+			auto keyValues = qentry.UpdatableValues(QueryEntry::IgnoreEmptyValues{});
+			payload.GetByFieldsSet(je.LeftFields(), keyValues, je.LeftFieldType(), je.LeftCompositeFieldsTypes());
+		}
+		if (qentry.Values().empty()) return false;
+	}
+	return true;
+}
+
+void JoinedSelector::ProcessBatch(span<IdType> rowIds, int nsId) {
+	assertrx_throw(batchMode_ == BatchMode::Available);
+	const auto startTime = ExplainCalc::Clock::now();
+	called_ += rowIds.size();
+
+	// Keys of all the rows are merged into the single CondSet condition for each of the join entries
+	Query batchQuery{itemQuery_};
+	VariantArray rowKeys;
+	for (size_t i = 0; i < joinQuery_.joinEntries_.size(); ++i) {
+		const QueryJoinEntry &je = joinQuery_.joinEntries_[i];
+		VariantArray keys;
+		if (je.LeftFieldType().Is<KeyValueType::Composite>()) {
+			for (IdType rowId : rowIds) {
+				ConstPayload{leftNs_->payloadType_, leftNs_->items_[rowId]}.GetByFieldsSet(je.LeftFields(), rowKeys, je.LeftFieldType(),
+																						   je.LeftCompositeFieldsTypes());
+				keys.insert(keys.end(), rowKeys.begin(), rowKeys.end());
+			}
+		} else {
+			tsl::sparse_set<Variant> set(rowIds.size());
+			for (IdType rowId : rowIds) {
+				ConstPayload{leftNs_->payloadType_, leftNs_->items_[rowId]}.GetByFieldsSet(je.LeftFields(), rowKeys, je.LeftFieldType(),
+																						   je.LeftCompositeFieldsTypes());
+				for (Variant &v : rowKeys) set.insert(std::move(v));
+			}
+			keys.reserve(set.size());
+			for (auto &v : set) keys.emplace_back(v);
+		}
+		if (keys.empty()) {
+			// None of the rows may be joined
+			selectTime_ += (ExplainCalc::Clock::now() - startTime);
+			return;
+		}
+		batchQuery.GetUpdatableEntry<QueryEntry>(i).SetCondAndValues(CondSet, std::move(keys));
+	}
+
+	// Batch select goes through the join cache as well as the rows' selects
+	QueryResults batchR;
+	bool found = false, matchedAtLeastOnce = false;
+	selectFromRightNs(batchR, batchQuery, found, matchedAtLeastOnce);
+	++batchSelects_;
+
+	// Distribute the results between the rows
+	auto &items = batchR.Items();
+	for (auto &item : items) {
+		if (!item.ValueInitialized()) item.SetValue(rightNs_->items_[item.Id()]);
+	}
+	const JoinHashTable table{items, rightNs_->payloadType_, batchQuery.Entries().Get<QueryEntry>(0)};
+	const auto &pt = rightNs_->payloadType_;
+	const size_t limit = joinQuery_.Limit();
+	Query rowQuery{itemQuery_};
+	for (IdType rowId : rowIds) {
+		if (!fillRowValues(rowQuery, ConstPayload{leftNs_->payloadType_, leftNs_->items_[rowId]})) continue;
+		const auto &entries = rowQuery.Entries();
+		QueryResults joinItemR;
+		size_t matched = 0;
+		const auto checkItem = [&](const ItemRef &item) {
+			if (!entries.CheckIfSatisfyConditions({pt, item.Value()})) return true;
+			if (++matched > limit) return false;
+			joinItemR.Add(item);
+			return true;
+		};
+		if (table.Valid() && table.Find(entries.Get<QueryEntry>(0).Values(), hashCandidates_)) {
+			for (uint32_t pos : hashCandidates_) {
+				if (!checkItem(items[pos])) break;
+			}
+		} else {
+			for (const auto &item : items) {
+				if (!checkItem(item)) break;
+			}
+		}
+		if (matched) ++matched_;
+		if (joinItemR.Count()) {
+			assertrx_throw(nsId < static_cast<int>(result_.joined_.size()));
+			joins::NamespaceResults &nsJoinRes = result_.joined_[nsId];
+			assertrx_dbg(nsJoinRes.GetJoinedSelectorsCount());
+			nsJoinRes.Insert(rowId, joinedFieldIdx_, std::move(joinItemR));
+		}
+	}
+	selectTime_ += (ExplainCalc::Clock::now() - startTime);
+}
+
 template <typename Cont, typename Fn>
 VariantArray JoinedSelector::readValuesOfRightNsFrom(const Cont &data, const Fn &createPayload, const QueryJoinEntry &entry,
 													 const PayloadType &pt) const {
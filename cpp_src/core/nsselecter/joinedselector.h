@@ -2,6 +2,7 @@
 #include "core/joincache.h"
 #include "core/namespace/namespaceimpl.h"
 #include "explaincalc.h"
+#include "joinhashtable.h"
 #include "selectiteratorcontainer.h"
 
 namespace reindexer {
@@ -14,7 +15,8 @@ struct JoinPreResult {
 			: std::vector<ItemRef>(std::move(other)),
 			  payloadType(std::move(other.payloadType)),
 			  tagsMatcher(std::move(other.tagsMatcher)),
-			  locked_(other.locked_) {
+			  locked_(other.locked_),
+			  hashTables_(std::move(other.hashTables_)) {
 			other.locked_ = false;
 		}
 		Values() noexcept : locked_(false) {}
@@ -34,6 +36,9 @@ struct JoinPreResult {
 		}
 		bool IsPreselectAllowed() const noexcept { return preselectAllowed_; }
 		void PreselectAllowed(bool a) noexcept { preselectAllowed_ = a; }
+		// Returns hash table for the join condition's field. Table is built once on the first request and shared between all of the
+		// queries, which are using this preresult from the join cache
+		JoinHashTable::Ptr HashTable(const QueryEntry &, bool &built) const;
 
 		PayloadType payloadType;
 		TagsMatcher tagsMatcher;
@@ -41,6 +46,8 @@ struct JoinPreResult {
 	private:
 		bool locked_ = false;
 		bool preselectAllowed_ = true;
+		mutable std::mutex hashTablesMtx_;
+		mutable h_vector<std::pair<std::string, JoinHashTable::Ptr>, 1> hashTables_;
 	};
 
 	typedef std::shared_ptr<JoinPreResult> Ptr;
@@ -140,6 +147,9 @@ public:
 	JoinedSelector &operator=(const JoinedSelector &) = delete;
 
 	bool Process(IdType, int nsId, ConstPayload, bool match);
+	// Left join may be processed for the block of the left rows with the single select from the right namespace
+	bool BatchModeAvailable();
+	void ProcessBatch(span<IdType> rowIds, int nsId);
 	JoinType Type() const noexcept { return joinType_; }
 	void SetType(JoinType type) noexcept { joinType_ = type; }
 	const std::string &RightNsName() const noexcept { return itemQuery_.NsName(); }
@@ -147,6 +157,7 @@ public:
 	const JoinedQuery &JoinQuery() const noexcept { return joinQuery_; }
 	int Called() const noexcept { return called_; }
 	int Matched() const noexcept { return matched_; }
+	int BatchSelects() const noexcept { return batchSelects_; }
 	void AppendSelectIteratorOfJoinIndexData(SelectIteratorContainer &, int *maxIterations, unsigned sortId, const SelectFunction::Ptr &,
 											 const RdxContext &);
 	static constexpr int MaxIterationsForPreResultStoreValuesOptimization() noexcept { return 200; }
@@ -155,6 +166,9 @@ public:
 	JoinPreSelectMode PreSelectMode() const noexcept { return preSelectCtx_.Mode(); }
 	const NamespaceImpl::Ptr &RightNs() const noexcept { return rightNs_; }
 	ExplainCalc::Duration SelectTime() const noexcept { return selectTime_; }
+	bool HashJoinUsed() const noexcept { return hashTable_ != nullptr; }
+	ExplainCalc::Duration HashBuildTime() const noexcept { return hashBuildTime_; }
+	ExplainCalc::Duration HashProbeTime() const noexcept { return hashProbeTime_; }
 	const std::string &ExplainOneSelect() const & noexcept { return explainOneSelect_; }
 
 	auto ExplainOneSelect() const && = delete;
@@ -168,9 +182,13 @@ private:
 													   const PayloadType &) const;
 	void selectFromRightNs(QueryResults &joinItemR, const Query &, bool &found, bool &matchedAtLeastOnce);
 	void selectFromPreResultValues(QueryResults &joinItemR, const Query &, bool &found, bool &matchedAtLeastOnce) const;
+	void selectFromPreResultValuesByHash(QueryResults &joinItemR, const Query &, bool &found, bool &matchedAtLeastOnce);
+	void initHashJoin(const JoinPreResult::Values &);
+	bool fillRowValues(Query &, ConstPayload) const;
 
 	JoinType joinType_;
 	int called_, matched_;
+	int batchSelects_ = 0;
 	NamespaceImpl::Ptr leftNs_;
 	NamespaceImpl::Ptr rightNs_;
 	JoinCacheRes joinRes_;
@@ -187,6 +205,13 @@ private:
 	bool inTransaction_ = false;
 	int64_t lastUpdateTime_ = 0;
 	ExplainCalc::Duration selectTime_ = ExplainCalc::Duration::zero();
+	enum class BatchMode { Unknown, Available, Unavailable } batchMode_ = BatchMode::Unknown;
+	bool hashJoinChecked_ = false;
+	size_t hashKeyEntryIdx_ = 0;
+	JoinHashTable::Ptr hashTable_;
+	JoinHashTable::Positions hashCandidates_;
+	ExplainCalc::Duration hashBuildTime_ = ExplainCalc::Duration::zero();
+	ExplainCalc::Duration hashProbeTime_ = ExplainCalc::Duration::zero();
 };
 using JoinedSelectors = std::vector<JoinedSelector>;
 
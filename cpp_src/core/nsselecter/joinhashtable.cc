@@ -0,0 +1,87 @@
+#include "joinhashtable.h"
+#include "core/payload/payloadiface.h"
+#include "core/query/queryentry.h"
+
+namespace reindexer {
+
+constexpr uint64_t kNumericKeyKind = 1;
+constexpr uint64_t kStringKeyKind = 2;
+constexpr uint64_t kTupleKeyKind = 3;
+constexpr size_t kMaxTupleKeyParts = 30;
+
+JoinHashTable::JoinHashTable(span<ItemRef> items, const PayloadType &pt, const QueryEntry &qe) {
+	VariantArray values;
+	for (uint32_t pos = 0; pos < items.size(); ++pos) {
+		const auto &pv = items[pos].Value();
+		assertrx(!pv.IsFree());
+		ConstPayload{pt, pv}.GetByFieldsSet(qe.Fields(), values, qe.FieldType(), qe.CompositeFieldsTypes());
+		for (const Variant &v : values) {
+			uint64_t signature;
+			size_t hash;
+			if (!keyHash(v, signature, hash) || (signature_ != kEmptySignature && signature_ != signature)) {
+				table_.clear();
+				signature_ = kInvalidSignature;
+				return;
+			}
+			signature_ = signature;
+			auto &positions = table_[hash];
+			// Array may contain duplicated values
+			if (positions.empty() || positions.back() != pos) {
+				positions.emplace_back(pos);
+			}
+		}
+	}
+}
+
+bool JoinHashTable::Find(const VariantArray &keys, Positions &positions) const {
+	assertrx(Valid());
+	positions.clear();
+	for (const Variant &k : keys) {
+		uint64_t signature;
+		size_t hash;
+		if (!keyHash(k, signature, hash)) return false;
+		if (signature_ == kEmptySignature) continue;
+		if (signature != signature_) return false;
+		const auto it = table_.find(hash);
+		if (it != table_.end()) {
+			positions.insert(positions.end(), it->second.begin(), it->second.end());
+		}
+	}
+	if (keys.size() > 1) {
+		std::sort(positions.begin(), positions.end());
+		positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+	}
+	return true;
+}
+
+// Hash has to be the same for all of the values, which are equal in terms of Variant::RelaxCompare with the same signature
+bool JoinHashTable::keyHash(const Variant &v, uint64_t &signature, size_t &hash) {
+	return v.Type().EvaluateOneOf(
+		[&](OneOf<KeyValueType::Int, KeyValueType::Int64, KeyValueType::Double, KeyValueType::Bool>) noexcept {
+			signature = kNumericKeyKind;
+			hash = std::hash<double>()(v.As<double>());
+			return true;
+		},
+		[&](KeyValueType::String) noexcept {
+			signature = kStringKeyKind;
+			hash = std::hash<std::string_view>()(std::string_view(v));
+			return true;
+		},
+		[&](KeyValueType::Tuple) {
+			const VariantArray parts = v.getCompositeValues();
+			if (parts.size() > kMaxTupleKeyParts) return false;
+			signature = kTupleKeyKind;
+			hash = 0;
+			for (const Variant &p : parts) {
+				uint64_t partSignature;
+				size_t partHash;
+				if (!keyHash(p, partSignature, partHash) || partSignature == kTupleKeyKind) return false;
+				signature = (signature << 2) | partSignature;
+				hash = (hash * 127) ^ partHash;
+			}
+			return true;
+		},
+		[](OneOf<KeyValueType::Uuid, KeyValueType::Composite, KeyValueType::Null, KeyValueType::Undefined>) noexcept { return false; });
+}
+
+}  // namespace reindexer
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include "core/keyvalue/variant.h"
+#include "core/payload/payloadtype.h"
+#include "core/queryresults/itemref.h"
+#include "estl/fast_hash_map.h"
+#include "estl/span.h"
+
+namespace reindexer {
+
+class QueryEntry;
+
+// Hash table over the join field of the right namespace's items (preselected JoinPreResult::Values or results of the batched join select).
+// Maps hash of the normalized field value to the positions of the items. Table works as a filter only: candidates still have to be checked by all of the join conditions,
+// so hash collisions and relaxed values comparison do not affect the join results
+class JoinHashTable {
+public:
+	using Ptr = std::shared_ptr<const JoinHashTable>;
+	using Positions = h_vector<uint32_t, 32>;
+
+	JoinHashTable(span<ItemRef> items, const PayloadType &, const QueryEntry &);
+
+	// Table can not be built, if the field contains values of the different kinds (e.g. strings and numbers)
+	bool Valid() const noexcept { return signature_ != kInvalidSignature; }
+	// Fills sorted positions of the candidates for the keys. Returns false, if the keys can not be looked up in this table
+	bool Find(const VariantArray &keys, Positions &positions) const;
+	size_t Size() const noexcept { return table_.size(); }
+
+private:
+	constexpr static uint64_t kEmptySignature = 0;
+	constexpr static uint64_t kInvalidSignature = std::numeric_limits<uint64_t>::max();
+
+	static bool keyHash(const Variant &, uint64_t &signature, size_t &hash);
+
+	fast_hash_map<size_t, h_vector<uint32_t, 2>> table_;
+	// Kinds of the key's parts. Values with equal hashes and different signatures may still be equal in terms of the RelaxCompare
+	uint64_t signature_ = kEmptySignature;
+};
+
+}  // namespace reindexer
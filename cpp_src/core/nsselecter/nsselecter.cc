@@ -1,6 +1,7 @@
 #include "nsselecter.h"
 
 #include "core/namespace/namespaceimpl.h"
+#include "core/querymemorytracker.h"
 #include "core/queryresults/joinresults.h"
 #include "debug/crashqueryreporter.h"
 #include "estl/multihash_map.h"
@@ -16,6 +17,8 @@ using namespace std::string_view_literals;
 constexpr int kMinIterationsForInnerJoinOptimization = 100;
 constexpr int kMaxIterationsForIdsetPreresult = 20000;
 constexpr int kCancelCheckFrequency = 1024;
+constexpr unsigned kMemoryCheckFrequency = 1024;
+constexpr size_t kLeftJoinBatchSize = 1024;
 
 namespace reindexer {
 
@@ -76,6 +79,9 @@ void NsSelecter::operator()(QueryResults &result, SelectCtxWithJoinPreSelect<Joi
 										   ctx.sortingContext.enableSortOrders, rdxCtx);
 		explain.PutOnConditionInjections(&explainInjectedOnConditions);
 	}
+	if constexpr (std::is_same_v<JoinPreResultCtx, void>) {
+		qPreproc.InjectNearestItemsCondition();
+	}
 	auto aggregators = getAggregators(aggregationQueryRef.aggregations_, aggregationQueryRef.GetStrictMode());
 
 	qPreproc.AddDistinctEntries(aggregators);
@@ -123,6 +129,14 @@ void NsSelecter::operator()(QueryResults &result, SelectCtxWithJoinPreSelect<Joi
 	QresExplainHolder qresHolder(qres, (explain.IsEnabled() || logLevel >= LogTrace) ? QresExplainHolder::ExplainEnabled::Yes
 																					 : QresExplainHolder::ExplainEnabled::No);
 	LoopCtx lctx(qres, ctx, qPreproc, aggregators, explain);
+	std::optional<IndexOnlyProjection> indexOnly;
+	if constexpr (std::is_same_v<JoinPreResultCtx, void>) {
+		// Index-only results do not preserve the absence of the fields in the documents, so the mode has to be requested explicitly
+		if (ctx.query.IsIndexOnly() && ctx.contextCollectingMode && ctx.isMergeQuery == IsMergeQuery::No && !ctx.joinedSelectors &&
+			!ctx.inTransaction && ctx.crashReporterQueryType == QuerySelect && aggregators.empty() && !ctx.query.IsWithRank()) {
+			indexOnly = prepareIndexOnlyProjection(ctx.query, result);
+		}
+	}
 	if (!ctx.query.forcedSortOrder_.empty() && !qPreproc.MoreThanOneEvaluation()) {
 		ctx.isForceAll = true;
 	}
@@ -248,12 +262,21 @@ void NsSelecter::operator()(QueryResults &result, SelectCtxWithJoinPreSelect<Joi
 					   std::visit([](const auto &e) noexcept { return e.data.desc; }, ctx.sortingContext.entries[0]);
 
 		bool hasComparators = false;
+		bool comparatorsReadPayloads = false;
 		qres.ExecuteAppropriateForEach(
 			Skip<JoinSelectIterator, SelectIteratorsBracket, AlwaysTrue>{},
-			[&hasComparators](const FieldsComparator &) noexcept { hasComparators = true; },
-			[&hasComparators](const SelectIterator &it) noexcept {
-				if (it.comparators_.size()) hasComparators = true;
+			[&](const FieldsComparator &) noexcept { hasComparators = comparatorsReadPayloads = true; },
+			[&](const SelectIterator &it) noexcept {
+				for (const auto &comparator : it.comparators_) {
+					hasComparators = true;
+					if (!comparator.ReadsColumnOnly()) comparatorsReadPayloads = true;
+				}
 			});
+		// Index-only scan: neither filters, nor sorting, nor results read the namespace's payloads
+		lctx.indexOnly = (indexOnly && !isFt && !comparatorsReadPayloads && !SortingOptions(ctx.sortingContext).postLoopSortingRequired())
+							 ? &*indexOnly
+							 : nullptr;
+		if (lctx.indexOnly) explain.SetIndexOnly(true);
 
 		if (!qres.HasIdsets()) {
 			SelectKeyResult scan;
@@ -343,6 +366,8 @@ void NsSelecter::operator()(QueryResults &result, SelectCtxWithJoinPreSelect<Joi
 	} while (qPreproc.NeedNextEvaluation(lctx.start, lctx.count, ctx.matchedAtLeastOnce, qresHolder));
 
 	processLeftJoins(result, ctx, resultInitSize, rdxCtx);
+	QueryMemoryTracker *const memoryTracker = rdxCtx.MemoryTracker();
+	if (memoryTracker) updateMemoryUsage(*memoryTracker, lctx, result);
 	if (!ctx.sortingContext.expressions.empty()) {
 		if constexpr (std::is_same_v<JoinPreResultCtx, JoinPreResultBuildCtx>) {
 			std::visit(overloaded{[this](JoinPreResult::Values &values) {
@@ -366,6 +391,10 @@ void NsSelecter::operator()(QueryResults &result, SelectCtxWithJoinPreSelect<Joi
 			result.aggregationResults.push_back(aggregator.GetResult());
 		}
 	}
+	if (memoryTracker) {
+		// Aggregators are destroyed with the selecter's context, their results are much smaller
+		for (const auto &aggregator : aggregators) memoryTracker->Release(&aggregator);
+	}
 	//	Put count/count_cached to aggretions
 	if (aggregationQueryRef.HasCalcTotal() || containAggCount || containAggCountCached) {
 		AggregationResult ret;
@@ -385,6 +414,7 @@ void NsSelecter::operator()(QueryResults &result, SelectCtxWithJoinPreSelect<Joi
 	explain.AddPostprocessTime();
 	explain.StopTiming();
 	explain.SetSortOptimization(ctx.sortingContext.isOptimizationEnabled());
+	if (memoryTracker) explain.SetPeakMemory(memoryTracker->Peak());
 	explain.PutSortIndex(ctx.sortingContext.sortIndex() ? ctx.sortingContext.sortIndex()->Name() : "-"sv);
 	if constexpr (std::is_same_v<JoinPreResultCtx, JoinPreResultBuildCtx>) {
 		explain.PutCount(std::visit(overloaded{[](const IdSet &ids) noexcept -> size_t { return ids.size(); },
@@ -916,13 +946,36 @@ void NsSelecter::setLimitAndOffset(ItemRefVector &queryResult, size_t offset, si
 
 void NsSelecter::processLeftJoins(QueryResults &qr, SelectCtx &sctx, size_t startPos, const RdxContext &rdxCtx) {
 	if (!checkIfThereAreLeftJoins(sctx)) return;
-	for (size_t i = startPos; i < qr.Count(); ++i) {
-		IdType rowid = qr[i].GetItemRef().Id();
-		ConstPayload pl(ns_->payloadType_, ns_->items_[rowid]);
-		for (auto &joinedSelector : *sctx.joinedSelectors) {
-			if (joinedSelector.Type() == JoinType::LeftJoin) joinedSelector.Process(rowid, sctx.nsid, pl, true);
+	h_vector<JoinedSelector *, 4> rowJoins;
+	h_vector<JoinedSelector *, 4> batchJoins;
+	for (auto &joinedSelector : *sctx.joinedSelectors) {
+		if (joinedSelector.Type() != JoinType::LeftJoin) continue;
+		if (qr.Count() > startPos + 1 && joinedSelector.BatchModeAvailable()) {
+			batchJoins.emplace_back(&joinedSelector);
+		} else {
+			rowJoins.emplace_back(&joinedSelector);
+		}
+	}
+	if (!rowJoins.empty()) {
+		for (size_t i = startPos; i < qr.Count(); ++i) {
+			IdType rowid = qr[i].GetItemRef().Id();
+			ConstPayload pl(ns_->payloadType_, ns_->items_[rowid]);
+			for (auto joinedSelector : rowJoins) joinedSelector->Process(rowid, sctx.nsid, pl, true);
+			if (!sctx.inTransaction && (i % kCancelCheckFrequency == 0)) ThrowOnCancel(rdxCtx);
+		}
+	}
+	if (!batchJoins.empty()) {
+		// Each block of the rows is joined via single select from the right namespace
+		std::vector<IdType> rowIds;
+		rowIds.reserve(std::min(qr.Count() - startPos, kLeftJoinBatchSize));
+		for (size_t i = startPos; i < qr.Count(); i += kLeftJoinBatchSize) {
+			rowIds.clear();
+			for (size_t j = i, end = std::min(qr.Count(), i + kLeftJoinBatchSize); j < end; ++j) {
+				rowIds.emplace_back(qr[j].GetItemRef().Id());
+			}
+			for (auto joinedSelector : batchJoins) joinedSelector->ProcessBatch(rowIds, sctx.nsid);
+			if (!sctx.inTransaction) ThrowOnCancel(rdxCtx);
 		}
-		if (!sctx.inTransaction && (i % kCancelCheckFrequency == 0)) ThrowOnCancel(rdxCtx);
 	}
 }
 
@@ -1034,9 +1087,14 @@ void NsSelecter::selectLoop(LoopCtx<JoinPreResultCtx> &ctx, ResultsT &result, co
 	assertrx_throw(!qres.Empty());
 	assertrx_throw(qres.IsSelectIterator(0));
 	SelectIterator &firstIterator = qres.begin()->Value<SelectIterator>();
+	QueryMemoryTracker *const memoryTracker = rdxCtx.MemoryTracker();
+	unsigned iterationsCount = 0;
 	IdType rowId = firstIterator.Val();
 	while (firstIterator.Next(rowId) && !finish) {
 		if ((rowId % kCancelCheckFrequency == 0) && !sctx.inTransaction) ThrowOnCancel(rdxCtx);
+		if constexpr (!kPreprocessingBeforFT) {
+			if (memoryTracker && (++iterationsCount % kMemoryCheckFrequency == 0)) updateMemoryUsage(*memoryTracker, ctx, result);
+		}
 		rowId = firstIterator.Val();
 		IdType properRowId = rowId;
 
@@ -1082,7 +1140,8 @@ void NsSelecter::selectLoop(LoopCtx<JoinPreResultCtx> &ctx, ResultsT &result, co
 						}
 					}
 					if (!multiSortFinished) {
-						addSelectResult<aggregationsOnly>(proc, rowId, properRowId, sctx, ctx.aggregators, result, ctx.preselectForFt);
+						addSelectResult<aggregationsOnly>(proc, rowId, properRowId, sctx, ctx.aggregators, result, ctx.preselectForFt,
+														  ctx.indexOnly);
 					}
 					if (lastResSize < result.Count()) {
 						if (ctx.start) {
@@ -1093,7 +1152,8 @@ void NsSelecter::selectLoop(LoopCtx<JoinPreResultCtx> &ctx, ResultsT &result, co
 				if (ctx.start) {
 					--ctx.start;
 				} else if (ctx.count) {
-					addSelectResult<aggregationsOnly>(proc, rowId, properRowId, sctx, ctx.aggregators, result, ctx.preselectForFt);
+					addSelectResult<aggregationsOnly>(proc, rowId, properRowId, sctx, ctx.aggregators, result, ctx.preselectForFt,
+													  ctx.indexOnly);
 					--ctx.count;
 					if (!ctx.count && sortingOptions.multiColumn && !multiSortFinished)
 						getSortIndexValue(sctx.sortingContext, properRowId, prevValues, proc,
@@ -1113,6 +1173,7 @@ void NsSelecter::selectLoop(LoopCtx<JoinPreResultCtx> &ctx, ResultsT &result, co
 	}
 
 	if constexpr (!kPreprocessingBeforFT) {
+		calculatePendingSortExpressions(sctx.sortingContext);
 		bool toPreResultValues = false;
 		if constexpr (std::is_same_v<JoinPreResultCtx, JoinPreResultBuildCtx>) {
 			if (auto values = std::get_if<JoinPreResult::Values>(&sctx.preSelect.Result().preselectedPayload); values) {
@@ -1158,6 +1219,21 @@ void NsSelecter::selectLoop(LoopCtx<JoinPreResultCtx> &ctx, ResultsT &result, co
 				ctx.count = ctx.qPreproc.Count() - countChange;
 			}
 		}
+		if (memoryTracker) updateMemoryUsage(*memoryTracker, ctx, result);
+	}
+}
+
+template <typename JoinPreResultCtx>
+void NsSelecter::updateMemoryUsage(QueryMemoryTracker &tracker, LoopCtx<JoinPreResultCtx> &ctx, const QueryResults &result) {
+	tracker.Update(&result.Items(), result.Items().capacity() * sizeof(ItemRef));
+	size_t joinedMemory = 0;
+	for (const auto &nsJoinedResults : result.joined_) joinedMemory += nsJoinedResults.MemoryUsage();
+	tracker.Update(&result.joined_, joinedMemory);
+	for (const auto &aggregator : ctx.aggregators) tracker.Update(&aggregator, aggregator.MemoryUsage());
+	if constexpr (std::is_same_v<JoinPreResultCtx, JoinPreResultBuildCtx>) {
+		if (auto *values = std::get_if<JoinPreResult::Values>(&ctx.sctx.preSelect.Result().preselectedPayload); values) {
+			tracker.Update(values, values->capacity() * sizeof(ItemRef));
+		}
 	}
 }
 
@@ -1183,24 +1259,45 @@ void NsSelecter::getSortIndexValue(const SortingContext &sortCtx, IdType rowId,
 			   sortCtx.getFirstColumnEntry());
 }
 
-void NsSelecter::calculateSortExpressions(uint8_t proc, IdType rowId, IdType properRowId, SelectCtx &sctx, const QueryResults &result) {
+unsigned NsSelecter::calculateSortExpressions(uint8_t proc, IdType rowId, IdType properRowId, SelectCtx &sctx, const QueryResults &result) {
 	static const JoinedSelectors emptyJoinedSelectors;
-	const auto &exprs = sctx.sortingContext.expressions;
-	auto &exprResults = sctx.sortingContext.exprResults;
+	auto &sortCtx = sctx.sortingContext;
+	const auto &exprs = sortCtx.expressions;
+	auto &exprResults = sortCtx.exprResults;
 	assertrx_throw(exprs.size() == exprResults.size());
+	const unsigned resultsIdx = exprResults[0].size() + sortCtx.pendingRowIds.size();
+	if (!sortCtx.programs.empty()) {
+		// Compiled expressions are calculated for the whole block of items at once
+		sortCtx.pendingRowIds.push_back(properRowId);
+		sortCtx.pendingProcs.push_back(proc);
+		if (sortCtx.pendingRowIds.size() >= SortExpressionProgram::kBlockSize) calculatePendingSortExpressions(sortCtx);
+		return resultsIdx;
+	}
 	const ConstPayload pv(ns_->payloadType_, ns_->items_[properRowId]);
 	const auto &joinedSelectors = sctx.joinedSelectors ? *sctx.joinedSelectors : emptyJoinedSelectors;
 	const auto joinedResultPtr = sctx.nsid < result.joined_.size() ? &result.joined_[sctx.nsid] : nullptr;
 	for (size_t i = 0; i < exprs.size(); ++i) {
 		exprResults[i].push_back(exprs[i].Calculate(rowId, pv, joinedResultPtr, joinedSelectors, proc, ns_->tagsMatcher_));
 	}
+	return resultsIdx;
+}
+
+void NsSelecter::calculatePendingSortExpressions(SortingContext &sortCtx) {
+	if (sortCtx.pendingRowIds.empty()) return;
+	assertrx_throw(sortCtx.programs.size() == sortCtx.exprResults.size());
+	for (size_t i = 0; i < sortCtx.programs.size(); ++i) {
+		sortCtx.programs[i].Calculate(sortCtx.pendingRowIds, sortCtx.pendingProcs, ns_->items_, ns_->tagsMatcher_, sortCtx.exprResults[i]);
+	}
+	sortCtx.pendingRowIds.clear();
+	sortCtx.pendingProcs.clear();
 }
 
 template <bool aggregationsOnly, typename JoinPreResultCtx>
 void NsSelecter::addSelectResult(uint8_t proc, IdType rowId, IdType properRowId, SelectCtxWithJoinPreSelect<JoinPreResultCtx> &sctx,
-								 h_vector<Aggregator, 4> &aggregators, QueryResults &result, bool preselectForFt) {
+								 h_vector<Aggregator, 4> &aggregators, QueryResults &result, bool preselectForFt,
+								 const IndexOnlyProjection *indexOnly) {
 	if (preselectForFt) return;
-	for (auto &aggregator : aggregators) aggregator.Aggregate(ns_->items_[properRowId]);
+	for (auto &aggregator : aggregators) aggregator.Aggregate(ns_->items_[properRowId], properRowId);
 	if constexpr (aggregationsOnly) return;
 	// Due to how aggregationsOnly is calculated the aggregators here can either be empty or contain only one value with the Distinct type
 	if (!aggregators.empty() && !aggregators.front().DistinctChanged()) return;
@@ -1209,8 +1306,8 @@ void NsSelecter::addSelectResult(uint8_t proc, IdType rowId, IdType properRowId,
 		std::visit(overloaded{[rowId](IdSet &ids) { ids.AddUnordered(rowId); },
 							  [&](JoinPreResult::Values &values) {
 								  if (!sctx.sortingContext.expressions.empty()) {
-									  values.emplace_back(properRowId, sctx.sortingContext.exprResults[0].size(), proc, sctx.nsid);
-									  calculateSortExpressions(proc, rowId, properRowId, sctx, result);
+									  const unsigned exprResultsIdx = calculateSortExpressions(proc, rowId, properRowId, sctx, result);
+									  values.emplace_back(properRowId, exprResultsIdx, proc, sctx.nsid);
 								  } else {
 									  values.emplace_back(properRowId, ns_->items_[properRowId], proc, sctx.nsid);
 								  }
@@ -1219,8 +1316,10 @@ void NsSelecter::addSelectResult(uint8_t proc, IdType rowId, IdType properRowId,
 				   sctx.preSelect.Result().preselectedPayload);
 	} else {
 		if (!sctx.sortingContext.expressions.empty()) {
-			result.Add({properRowId, sctx.sortingContext.exprResults[0].size(), proc, sctx.nsid});
-			calculateSortExpressions(proc, rowId, properRowId, sctx, result);
+			const unsigned exprResultsIdx = calculateSortExpressions(proc, rowId, properRowId, sctx, result);
+			result.Add({properRowId, exprResultsIdx, proc, sctx.nsid});
+		} else if (indexOnly) {
+			result.Add({properRowId, indexOnly->Build(properRowId), proc, sctx.nsid});
 		} else {
 			result.Add({properRowId, ns_->items_[properRowId], proc, sctx.nsid});
 		}
@@ -1234,6 +1333,29 @@ void NsSelecter::addSelectResult(uint8_t proc, IdType rowId, IdType properRowId,
 	}
 }
 
+std::optional<IndexOnlyProjection> NsSelecter::prepareIndexOnlyProjection(const Query &query, QueryResults &result) const {
+	// Select filter also makes the results non-cacheable (see QueryResults::addNSContext), so the bindings do not mix the projected
+	// payloads with the cached items
+	if (query.SelectFilters().empty()) return std::nullopt;
+	h_vector<IndexOnlyProjection::Field, 4> fields;
+	for (const auto &filter : query.SelectFilters()) {
+		int idx = -1;
+		if (!ns_->getIndexByNameOrJsonPath(filter, idx) || idx >= ns_->payloadType_.NumFields()) return std::nullopt;
+		const auto column = ns_->indexes_[idx]->Column();
+		const auto &jsonPaths = ns_->payloadType_.Field(idx).JsonPaths();
+		// Nested fields would require the objects in the projected tuple
+		if (!column.Valid() || jsonPaths.size() != 1 || jsonPaths[0] != filter || filter.find('.') != std::string::npos) {
+			return std::nullopt;
+		}
+		const int tagName = ns_->tagsMatcher_.name2tag(filter);
+		if (!tagName) return std::nullopt;
+		if (std::none_of(fields.begin(), fields.end(), [idx](const IndexOnlyProjection::Field &f) noexcept { return f.field == idx; })) {
+			fields.emplace_back(IndexOnlyProjection::Field{idx, tagName, column});
+		}
+	}
+	return std::optional<IndexOnlyProjection>{std::in_place, ns_->payloadType_, fields, result.stringsHolder_};
+}
+
 void NsSelecter::checkStrictModeAgg(StrictMode strictMode, const std::string &name, const std::string &nsName,
 									const TagsMatcher &tagsMatcher) const {
 	if (int index = IndexValueType::SetByJsonPath; ns_->tryGetIndexByName(name, index)) return;
@@ -1271,6 +1393,7 @@ h_vector<Aggregator, 4> NsSelecter::getAggregators(const std::vector<AggregateEn
 			sortingEntries.push_back({(iequals("count"sv, s.expression) ? Aggregator::SortingEntry::Count : NotFilled), s.desc});
 		}
 		int idx = -1;
+		SparseColumnView sparseColumn;
 		for (size_t i = 0; i < ag.Fields().size(); ++i) {
 			checkStrictModeAgg(strictMode == StrictModeNotSet ? ns_->config_.strictMode : strictMode, ag.Fields()[i], ns_->name_,
 							   ns_->tagsMatcher_);
@@ -1283,6 +1406,7 @@ h_vector<Aggregator, 4> NsSelecter::getAggregators(const std::vector<AggregateEn
 			if (ns_->getIndexByNameOrJsonPath(ag.Fields()[i], idx)) {
 				if (ns_->indexes_[idx]->Opts().IsSparse()) {
 					fields.push_back(ns_->indexes_[idx]->Fields().getTagsPath(0));
+					sparseColumn = ns_->indexes_[idx]->SparseColumn();
 				} else if (ag.Type() == AggFacet && ag.Fields().size() > 1 && ns_->indexes_[idx]->Opts().IsArray()) {
 					throw Error(errQueryExec, "Multifield facet cannot contain an array field");
 				} else if (ag.Type() == AggDistinct && IsComposite(ns_->indexes_[idx]->Type())) {
@@ -1305,6 +1429,7 @@ h_vector<Aggregator, 4> NsSelecter::getAggregators(const std::vector<AggregateEn
 		}
 		if (ag.Type() == AggDistinct) distinctIndexes.push_back(ret.size());
 		ret.emplace_back(ns_->payloadType_, fields, ag.Type(), ag.Fields(), sortingEntries, ag.Limit(), ag.Offset(), compositeIndexFields);
+		if (sparseColumn.Valid()) ret.back().BindSparseColumn(sparseColumn);
 	}
 
 	if (distinctIndexes.size() <= 1) return ret;
@@ -1489,8 +1614,19 @@ void NsSelecter::prepareSortingContext(SortingEntries &sortBy, SelectCtx &ctx, b
 			ctx.isForceAll = true;
 		}
 	}
+	ctx.sortingContext.programs.clear();
+	for (const auto &expr : ctx.sortingContext.expressions) {
+		auto program = SortExpressionProgram::Compile(expr, ns_->payloadType_);
+		if (!program) {
+			ctx.sortingContext.programs.clear();
+			break;
+		}
+		ctx.sortingContext.programs.emplace_back(std::move(*program));
+	}
 	ctx.sortingContext.exprResults.clear();
 	ctx.sortingContext.exprResults.resize(ctx.sortingContext.expressions.size());
+	ctx.sortingContext.pendingRowIds.clear();
+	ctx.sortingContext.pendingProcs.clear();
 }
 
 enum class CostCountingPolicy : bool { Any, ExceptTargetSortIdxSeq };
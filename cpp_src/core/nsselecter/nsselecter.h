@@ -2,11 +2,14 @@
 #include "aggregator.h"
 #include "core/index/index.h"
 #include "explaincalc.h"
+#include "indexonlyprojection.h"
 #include "joinedselector.h"
 #include "sortingcontext.h"
 
 namespace reindexer {
 
+class QueryMemoryTracker;
+
 enum class IsMergeQuery : bool { Yes = true, No = false };
 enum class IsFTQuery { Yes, No, NotSet };
 
@@ -80,6 +83,8 @@ private:
 		unsigned start = QueryEntry::kDefaultOffset;
 		unsigned count = QueryEntry::kDefaultLimit;
 		bool preselectForFt = false;
+		// Results' payloads are built from the indexes' columns instead of the references to the namespace's payloads
+		const IndexOnlyProjection *indexOnly = nullptr;
 	};
 
 	template <bool reverse, bool haveComparators, bool aggregationsOnly, typename ResultsT, typename JoinPreResultCtx>
@@ -92,10 +97,13 @@ private:
 	template <typename It>
 	void applyGeneralSort(It itFirst, It itLast, It itEnd, const ItemComparator &, const SelectCtx &ctx);
 
-	void calculateSortExpressions(uint8_t proc, IdType rowId, IdType properRowId, SelectCtx &, const QueryResults &);
+	unsigned calculateSortExpressions(uint8_t proc, IdType rowId, IdType properRowId, SelectCtx &, const QueryResults &);
+	void calculatePendingSortExpressions(SortingContext &);
 	template <bool aggregationsOnly, typename JoinPreResultCtx>
 	void addSelectResult(uint8_t proc, IdType rowId, IdType properRowId, SelectCtxWithJoinPreSelect<JoinPreResultCtx> &sctx,
-						 h_vector<Aggregator, 4> &aggregators, QueryResults &result, bool preselectForFt);
+						 h_vector<Aggregator, 4> &aggregators, QueryResults &result, bool preselectForFt,
+						 const IndexOnlyProjection *indexOnly);
+	std::optional<IndexOnlyProjection> prepareIndexOnlyProjection(const Query &, QueryResults &) const;
 
 	h_vector<Aggregator, 4> getAggregators(const std::vector<AggregateEntry> &aggEntrys, StrictMode strictMode) const;
 	void setLimitAndOffset(ItemRefVector &result, size_t offset, size_t limit);
@@ -107,6 +115,8 @@ private:
 						   const JoinedSelectors &);
 	void processLeftJoins(QueryResults &qr, SelectCtx &sctx, size_t startPos, const RdxContext &);
 	bool checkIfThereAreLeftJoins(SelectCtx &sctx) const;
+	template <typename JoinPreResultCtx>
+	void updateMemoryUsage(QueryMemoryTracker &, LoopCtx<JoinPreResultCtx> &, const QueryResults &);
 	template <typename It, typename JoinPreResultCtx>
 	void sortResults(LoopCtx<JoinPreResultCtx> &sctx, It begin, It end, const SortingOptions &sortingOptions,
 					 const joins::NamespaceResults *);
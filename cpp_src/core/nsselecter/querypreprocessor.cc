@@ -547,12 +547,10 @@ static VariantArray createCompositeKeyValues(const span<std::pair<int, VariantAr
 }
 
 size_t QueryPreprocessor::substituteCompositeIndexes(const size_t from, const size_t to) {
-	using composite_substitution_helpers::CompositeSearcher;
 	using composite_substitution_helpers::EntriesRanges;
-	using composite_substitution_helpers::CompositeValuesCountLimits;
 
 	size_t deleted = 0;
-	CompositeSearcher searcher(ns_);
+	CompositeSubstitutionKey key;
 	for (size_t cur = from, end = to; cur < end; cur = Next(cur), end = to - deleted) {
 		if (IsSubTree(cur)) {
 			const auto &bracket = Get<QueryEntriesBracket>(cur);
@@ -577,24 +575,81 @@ size_t QueryPreprocessor::substituteCompositeIndexes(const size_t from, const si
 		if (!found || found->empty()) {
 			continue;
 		}
-		searcher.Add(qe.IndexNo(), *found, cur);
+		assertrx_throw(cur - from < std::numeric_limits<uint16_t>::max());
+		key.Add(cur - from, qe.IndexNo(), qe.Values().size());
+	}
+	if (key.Empty()) {
+		return deleted;
+	}
+
+	// Plan depends on the query shape and on the namespace's indexes only, so it is shared by the executions of the same prepared query
+	CompositeSubstitutionPlan plan;
+	auto cached = ns_.compositeSubstitutionCache_->Get(key);
+	if (cached.valid && cached.val.inited) {
+		plan = std::move(cached.val);
+	} else {
+		plan = buildCompositeSubstitutionPlan(key);
+		if (cached.valid) {
+			ns_.compositeSubstitutionCache_->Put(key, CompositeSubstitutionPlan{plan});
+		}
 	}
 
 	EntriesRanges deleteRanges;
 	h_vector<std::pair<int, VariantArray>, 4> values;
+	for (auto &substitution : plan.substitutions) {
+		values.clear<false>();
+		uint32_t resultSetSize = 1;
+		for (auto &i : substitution.entries) {
+			i = uint16_t(i + from);
+			resultSetSize *= Get<QueryEntry>(i).Values().size();
+		}
+		for (auto i : substitution.entries) {
+			auto &qe = Get<QueryEntry>(i);
+			qe.ConvertValuesToFieldType();
+			const int idxNo = qe.IndexNo();
+			values.emplace_back(idxNo, std::move(qe).Values());
+		}
+		{
+			VariantArray qValues = createCompositeKeyValues(values, ns_.payloadType_, resultSetSize);
+			const auto first = substitution.entries.front();
+			SetOperation(OpAnd, first);
+			QueryField fld{ns_.indexes_[substitution.idx]->Name()};
+			setQueryIndex(fld, substitution.idx, ns_);
+			container_[first].Emplace<QueryEntry>(std::move(fld), qValues.size() == 1 ? CondEq : CondSet, std::move(qValues));
+		}
+		deleteRanges.Add(span(substitution.entries.data() + 1, substitution.entries.size() - 1));
+	}
+	for (auto rit = deleteRanges.rbegin(); rit != deleteRanges.rend(); ++rit) {
+		Erase(rit->From(), rit->To());
+		deleted += rit->Size();
+	}
+	return deleted;
+}
+
+CompositeSubstitutionPlan QueryPreprocessor::buildCompositeSubstitutionPlan(const CompositeSubstitutionKey &key) const {
+	using composite_substitution_helpers::CompositeSearcher;
+	using composite_substitution_helpers::CompositeValuesCountLimits;
+
+	CompositeSearcher searcher(ns_);
+	for (const auto &e : key.Entries()) {
+		searcher.Add(e.field, *getCompositeIndex(e.field), e.position);
+	}
+
+	CompositeSubstitutionPlan plan;
+	plan.inited = true;
 	auto resIdx = searcher.GetResult();
 	while (resIdx >= 0) {
 		auto &res = searcher[resIdx];
-		values.clear<false>();
 		uint32_t resultSetSize = 1;
 		uint32_t maxSetSize = 0;
 		for (auto i : res.entries) {
-			auto &qe = Get<QueryEntry>(i);
-			if rx_unlikely (!res.fields.contains(qe.IndexNo())) {
+			const auto &entries = key.Entries();
+			const auto it = std::find_if(entries.begin(), entries.end(), [i](const auto &e) noexcept { return e.position == i; });
+			if rx_unlikely (it == entries.end() || !res.fields.contains(it->field)) {
 				throw Error(errLogic, "Error during composite index's fields substitution (this should not happen)");
 			}
-			maxSetSize = std::max(maxSetSize, qe.Values().size());
-			resultSetSize *= qe.Values().size();
+			maxSetSize = std::max(maxSetSize, it->valuesCount);
+			resultSetSize *= it->valuesCount;
 		}
 		constexpr static CompositeValuesCountLimits kCompositeSetLimits;
 		if (resultSetSize != maxSetSize) {
@@ -606,28 +661,10 @@ size_t QueryPreprocessor::substituteCompositeIndexes(const size_t from, const si
 				continue;
 			}
 		}
-		for (auto i : res.entries) {
-			auto &qe = Get<QueryEntry>(i);
-			qe.ConvertValuesToFieldType();
-			const int idxNo = qe.IndexNo();
-			values.emplace_back(idxNo, std::move(qe).Values());
-		}
-		{
-			VariantArray qValues = createCompositeKeyValues(values, ns_.payloadType_, resultSetSize);
-			const auto first = res.entries.front();
-			SetOperation(OpAnd, first);
-			QueryField fld{ns_.indexes_[res.idx]->Name()};
-			setQueryIndex(fld, res.idx, ns_);
-			container_[first].Emplace<QueryEntry>(std::move(fld), qValues.size() == 1 ? CondEq : CondSet, std::move(qValues));
-		}
-		deleteRanges.Add(span(res.entries.data() + 1, res.entries.size() - 1));
+		plan.substitutions.emplace_back(CompositeSubstitutionPlan::Substitution{res.idx, res.entries});
 		resIdx = searcher.RemoveUsedAndGetNext(resIdx);
 	}
-	for (auto rit = deleteRanges.rbegin(); rit != deleteRanges.rend(); ++rit) {
-		Erase(rit->From(), rit->To());
-		deleted += rit->Size();
-	}
-	return deleted;
+	return plan;
 }
 
 void QueryPreprocessor::initIndexedQueries(size_t begin, size_t end) {
@@ -1386,6 +1423,32 @@ void QueryPreprocessor::AddDistinctEntries(const h_vector<Aggregator, 4> &aggreg
 	}
 }
 
+// Nearest items are not searched, if the query requires more than this part of the namespace's items
+constexpr double kMaxNearestItemsPart = 0.1;
+void QueryPreprocessor::InjectNearestItemsCondition() {
+	// Query 'ORDER BY ST_Distance(field, point) LIMIT k' without filters requires only k nearest items. They are found by the best-first
+	// search in the rtree index and the select is restricted by the distance to the farthest of them
+	if (!Empty() || isMergeQuery_ || forcedSortOrder_ || !query_.HasLimit() || query_.sortingEntries_.empty() ||
+		query_.sortingEntries_[0].desc || query_.HasCalcTotal() || !query_.aggregations_.empty() || !query_.GetJoinQueries().empty() ||
+		!query_.GetMergeQueries().empty()) {
+		return;
+	}
+	const size_t nearestCount = size_t(query_.Offset()) + query_.Limit();
+	if (double(nearestCount) > kMaxNearestItemsPart * double(ns_.ItemsCount())) return;
+	static const std::vector<JoinedSelector> emptyJoinedSelectors;
+	const auto expr = SortExpression::Parse(query_.sortingEntries_[0].expression, emptyJoinedSelectors);
+	if (!expr.ByDistanceFromPoint()) return;
+	const auto &distanceFromPoint = expr.GetDistanceFromPoint();
+	int idxNo = IndexValueType::NotSet;
+	if (!ns_.getIndexByNameOrJsonPath(distanceFromPoint.column, idxNo) || ns_.indexes_[idxNo]->Type() != IndexRTree) return;
+	const auto distance = ns_.indexes_[idxNo]->NearestItemsDistance(distanceFromPoint.point, nearestCount);
+	if (!distance) return;
+	QueryField fld{std::string{distanceFromPoint.column}};
+	SetQueryField(fld, ns_);
+	// Distance is slightly increased to keep the farthest items despite the rounding errors
+	Append<QueryEntry>(OpAnd, std::move(fld), CondDWithin, VariantArray::Create(distanceFromPoint.point, *distance * (1.0 + 1e-9)));
+}
+
 std::pair<CondType, VariantArray> QueryPreprocessor::queryValuesFromOnCondition(std::string &explainStr, AggType &oAggType,
 																				NamespaceImpl &rightNs, Query joinQuery,
 																				JoinPreResult::CPtr joinPreresult,
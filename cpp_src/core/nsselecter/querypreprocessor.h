@@ -1,6 +1,7 @@
 #pragma once
 
 #include "aggregator.h"
+#include "core/compositesubstitutioncache.h"
 #include "core/index/ft_preselect.h"
 #include "core/query/queryentry.h"
 #include "estl/h_vector.h"
@@ -43,6 +44,7 @@ public:
 	}
 	void InitIndexedQueries() { initIndexedQueries(0, Size()); }
 	void AddDistinctEntries(const h_vector<Aggregator, 4> &);
+	void InjectNearestItemsCondition();
 	bool NeedNextEvaluation(unsigned start, unsigned count, bool &matchedAtLeastOnce, QresExplainHolder &qresHolder) noexcept;
 	unsigned Start() const noexcept { return start_; }
 	unsigned Count() const noexcept { return count_; }
@@ -102,6 +104,7 @@ private:
 	[[nodiscard]] bool forcedStage() const noexcept { return evaluationsCount_ == (desc_ ? 1 : 0); }
 	[[nodiscard]] size_t lookupQueryIndexes(uint16_t dst, uint16_t srcBegin, uint16_t srcEnd);
 	[[nodiscard]] size_t substituteCompositeIndexes(size_t from, size_t to);
+	[[nodiscard]] CompositeSubstitutionPlan buildCompositeSubstitutionPlan(const CompositeSubstitutionKey &) const;
 	[[nodiscard]] MergeResult mergeQueryEntries(size_t lhs, size_t rhs, MergeOrdered, const CollateOpts &);
 	[[nodiscard]] MergeResult mergeQueryEntriesSetSet(QueryEntry &lqe, QueryEntry &rqe, bool distinct, size_t position,
 													  const CollateOpts &);
@@ -95,6 +95,16 @@ const SortExprFuncs::JoinedIndex& SortExpression::GetJoinedIndex() const noexcep
 	return container_[0].Value<JoinedIndex>();
 }
 
+bool SortExpression::ByDistanceFromPoint() const noexcept {
+	static constexpr SortExpressionOperation noOperation;
+	return Size() == 1 && container_[0].Is<DistanceFromPoint>() && GetOperation(0) == noOperation;
+}
+
+const SortExprFuncs::DistanceFromPoint& SortExpression::GetDistanceFromPoint() const noexcept {
+	assertrx(Size() == 1);
+	return container_[0].Value<DistanceFromPoint>();
+}
+
 double SortExprFuncs::Index::GetValue(ConstPayload pv, TagsMatcher& tagsMatcher) const {
 	const VariantArray values = getFieldValues(pv, tagsMatcher, index, column);
 	if (values.empty()) throw Error(errQueryExec, "Empty field in sort expression: %s", column);
@@ -563,6 +573,243 @@ double SortExpression::calculate(const_iterator it, const_iterator end, IdType r
 	return result;
 }
 
+std::optional<SortExpressionProgram> SortExpressionProgram::Compile(const SortExpression& expr, const PayloadType& type) {
+	SortExpressionProgram program(type);
+	if (expr.Empty() || !program.compile(expr.cbegin(), expr.cend())) return std::nullopt;
+	assertrx_throw(program.stackSize_ == 1);
+	return program;
+}
+
+bool SortExpressionProgram::compile(SortExpression::const_iterator begin, SortExpression::const_iterator end) {
+	assertrx(begin != end);
+	assertrx(begin->operation.op == OpPlus);
+	for (auto it = begin; it != end; ++it) {
+		const bool compiled = it->InvokeAppropriate<bool>(
+			[this, &it](const SortExpressionBracket& b) {
+				if (!compile(it.cbegin(), it.cend())) return false;
+				if (b.IsAbs()) addOperation({.type = Operation::Type::Abs});
+				return true;
+			},
+			[this](const Value& v) {
+				addOperation({.type = Operation::Type::Constant, .value = v.value});
+				return true;
+			},
+			[this](const SortExprFuncs::Index& i) {
+				addOperation({.type = Operation::Type::Load, .column = addColumn(i)});
+				return true;
+			},
+			[this](const Rank& r) {
+				addOperation({.type = Operation::Type::Load, .column = addColumn(r)});
+				return true;
+			},
+			[this](const DistanceFromPoint& d) {
+				addOperation({.type = Operation::Type::Load, .column = addColumn(d)});
+				return true;
+			},
+			[this](const DistanceBetweenIndexes& d) {
+				addOperation({.type = Operation::Type::Load, .column = addColumn(d)});
+				return true;
+			},
+			// Expressions with the joined fields are calculated item by item
+			[](const JoinedIndex&) noexcept { return false; }, [](const DistanceJoinedIndexFromPoint&) noexcept { return false; },
+			[](const DistanceBetweenIndexAndJoinedIndex&) noexcept { return false; },
+			[](const DistanceBetweenJoinedIndexes&) noexcept { return false; },
+			[](const DistanceBetweenJoinedIndexesSameNs&) noexcept { return false; });
+		if (!compiled) return false;
+		if (it->operation.negative) addOperation({.type = Operation::Type::Negate});
+		if (it == begin) continue;
+		switch (it->operation.op) {
+			case OpPlus:
+				addOperation({.type = Operation::Type::Add});
+				break;
+			case OpMinus:
+				addOperation({.type = Operation::Type::Subtract});
+				break;
+			case OpMult:
+				addOperation({.type = Operation::Type::Multiply});
+				break;
+			case OpDiv:
+				addOperation({.type = Operation::Type::Divide});
+				break;
+		}
+	}
+	return true;
+}
+
+void SortExpressionProgram::addOperation(Operation op) {
+	switch (op.type) {
+		case Operation::Type::Load:
+		case Operation::Type::Constant:
+			maxStackSize_ = std::max(maxStackSize_, ++stackSize_);
+			break;
+		case Operation::Type::Add:
+		case Operation::Type::Subtract:
+		case Operation::Type::Multiply:
+		case Operation::Type::Divide:
+			assertrx_throw(stackSize_ >= 2);
+			--stackSize_;
+			break;
+		case Operation::Type::Negate:
+		case Operation::Type::Abs:
+			assertrx_throw(stackSize_ >= 1);
+			break;
+	}
+	operations_.emplace_back(op);
+}
+
+size_t SortExpressionProgram::addColumn(Column::Source&& source) {
+	// The same field may be used several times in the expression, but its values are extracted only once
+	for (size_t i = 0; i < columns_.size(); ++i) {
+		if (columns_[i].source == source) return i;
+	}
+	Column column{.source = std::move(source)};
+	const auto fieldOf = [this](int index) -> const PayloadFieldType* {
+		return (index >= 0 && index < type_.NumFields()) ? &type_.Field(index) : nullptr;
+	};
+	std::visit(overloaded{[&column, &fieldOf](const SortExprFuncs::Index& i) {
+							  const PayloadFieldType* field = fieldOf(i.index);
+							  if (!field || field->IsArray()) return;
+							  field->Type().EvaluateOneOf([&column](KeyValueType::Int) noexcept { column.kind = Column::Kind::Int; },
+														  [&column](KeyValueType::Int64) noexcept { column.kind = Column::Kind::Int64; },
+														  [&column](KeyValueType::Double) noexcept { column.kind = Column::Kind::Double; },
+														  [](OneOf<KeyValueType::Bool, KeyValueType::String, KeyValueType::Null,
+																   KeyValueType::Undefined, KeyValueType::Composite, KeyValueType::Tuple,
+																   KeyValueType::Uuid>) noexcept {});
+							  column.offset = field->Offset();
+						  },
+						  [&column](const Rank&) noexcept { column.kind = Column::Kind::Rank; },
+						  [&column, &fieldOf](const DistanceFromPoint& d) {
+							  const PayloadFieldType* field = fieldOf(d.index);
+							  if (field && field->IsArray() && field->Type().Is<KeyValueType::Double>()) column.kind = Column::Kind::Point;
+						  },
+						  [](const DistanceBetweenIndexes&) noexcept {}},
+			   column.source);
+	columns_.emplace_back(std::move(column));
+	return columns_.size() - 1;
+}
+
+void SortExpressionProgram::Calculate(span<IdType> rowIds, span<uint8_t> procs, const std::vector<PayloadValue>& items,
+									  TagsMatcher& tagsMatcher, h_vector<double, 32>& results) {
+	assertrx_throw(rowIds.size() == procs.size());
+	for (size_t begin = 0; begin < rowIds.size(); begin += kBlockSize) {
+		const size_t count = std::min(kBlockSize, rowIds.size() - begin);
+		calculateBlock(rowIds.subspan(begin, count), procs.subspan(begin, count), items, tagsMatcher, results);
+	}
+}
+
+void SortExpressionProgram::fillColumn(const Column& column, span<IdType> rowIds, span<uint8_t> procs,
+									   const std::vector<PayloadValue>& items, TagsMatcher& tagsMatcher, double* values) const {
+	const size_t count = rowIds.size();
+	switch (column.kind) {
+		case Column::Kind::Int:
+			for (size_t i = 0; i < count; ++i) values[i] = *reinterpret_cast<const int*>(items[rowIds[i]].Ptr() + column.offset);
+			return;
+		case Column::Kind::Int64:
+			for (size_t i = 0; i < count; ++i) values[i] = *reinterpret_cast<const int64_t*>(items[rowIds[i]].Ptr() + column.offset);
+			return;
+		case Column::Kind::Double:
+			for (size_t i = 0; i < count; ++i) values[i] = *reinterpret_cast<const double*>(items[rowIds[i]].Ptr() + column.offset);
+			return;
+		case Column::Kind::Rank:
+			for (size_t i = 0; i < count; ++i) values[i] = procs[i];
+			return;
+		case Column::Kind::Point: {
+			const auto& d = std::get<DistanceFromPoint>(column.source);
+			for (size_t i = 0; i < count; ++i) {
+				ConstPayload pv(type_, items[rowIds[i]]);
+				const auto point = pv.GetArray<double>(d.index);
+				if (point.size() == 2) {
+					values[i] = std::sqrt((point[0] - d.point.X()) * (point[0] - d.point.X()) +
+										  (point[1] - d.point.Y()) * (point[1] - d.point.Y()));
+				} else {
+					// Reports the error
+					values[i] = d.GetValue(pv, tagsMatcher);
+				}
+			}
+			return;
+		}
+		case Column::Kind::Generic:
+			break;
+	}
+	std::visit(
+		[&](const auto& source) {
+			for (size_t i = 0; i < count; ++i) {
+				if constexpr (std::is_same_v<std::decay_t<decltype(source)>, Rank>) {
+					values[i] = procs[i];
+				} else {
+					values[i] = source.GetValue(ConstPayload(type_, items[rowIds[i]]), tagsMatcher);
+				}
+			}
+		},
+		column.source);
+}
+
+void SortExpressionProgram::calculateBlock(span<IdType> rowIds, span<uint8_t> procs, const std::vector<PayloadValue>& items,
+										   TagsMatcher& tagsMatcher, h_vector<double, 32>& results) {
+	const size_t count = rowIds.size();
+	assertrx_throw(count <= kBlockSize);
+	columnsData_.resize(columns_.size() * kBlockSize);
+	stack_.resize(maxStackSize_ * kBlockSize);
+	for (size_t i = 0; i < columns_.size(); ++i) {
+		fillColumn(columns_[i], rowIds, procs, items, tagsMatcher, columnsData_.data() + i * kBlockSize);
+	}
+	size_t top = 0;
+	for (const auto& op : operations_) {
+		switch (op.type) {
+			case Operation::Type::Load: {
+				const double* column = columnsData_.data() + op.column * kBlockSize;
+				std::copy(column, column + count, stack_.data() + top++ * kBlockSize);
+				continue;
+			}
+			case Operation::Type::Constant:
+				std::fill_n(stack_.data() + top++ * kBlockSize, count, op.value);
+				continue;
+			case Operation::Type::Negate: {
+				double* values = stack_.data() + (top - 1) * kBlockSize;
+				for (size_t i = 0; i < count; ++i) values[i] = -values[i];
+				continue;
+			}
+			case Operation::Type::Abs: {
+				double* values = stack_.data() + (top - 1) * kBlockSize;
+				for (size_t i = 0; i < count; ++i) values[i] = values[i] < 0 ? -values[i] : values[i];
+				continue;
+			}
+			case Operation::Type::Add:
+			case Operation::Type::Subtract:
+			case Operation::Type::Multiply:
+			case Operation::Type::Divide:
+				break;
+		}
+		--top;
+		double* left = stack_.data() + (top - 1) * kBlockSize;
+		const double* right = stack_.data() + top * kBlockSize;
+		switch (op.type) {
+			case Operation::Type::Add:
+				for (size_t i = 0; i < count; ++i) left[i] += right[i];
+				break;
+			case Operation::Type::Subtract:
+				for (size_t i = 0; i < count; ++i) left[i] -= right[i];
+				break;
+			case Operation::Type::Multiply:
+				for (size_t i = 0; i < count; ++i) left[i] *= right[i];
+				break;
+			case Operation::Type::Divide:
+				for (size_t i = 0; i < count; ++i) {
+					if (right[i] == 0.0) throw Error(errQueryExec, "Division by zero in sort expression");
+					left[i] /= right[i];
+				}
+				break;
+			case Operation::Type::Load:
+			case Operation::Type::Constant:
+			case Operation::Type::Negate:
+			case Operation::Type::Abs:
+				break;
+		}
+	}
+	assertrx_throw(top == 1);
+	results.insert(results.end(), stack_.data(), stack_.data() + count);
+}
+
 std::string SortExpression::Dump() const {
 	WrSerializer ser;
 	dump(cbegin(), cend(), ser);
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <optional>
 #include "core/expressiontree.h"
 #include "core/keyvalue/geometry.h"
 #include "core/payload/payloadiface.h"
+#include "estl/span.h"
 
 namespace reindexer {
 
@@ -176,6 +178,8 @@ public:
 	[[nodiscard]] bool ByIndexField() const noexcept;
 	[[nodiscard]] bool ByJoinedIndexField() const noexcept;
 	[[nodiscard]] const SortExprFuncs::JoinedIndex& GetJoinedIndex() const noexcept;
+	[[nodiscard]] bool ByDistanceFromPoint() const noexcept;
+	[[nodiscard]] const SortExprFuncs::DistanceFromPoint& GetDistanceFromPoint() const noexcept;
 
 	[[nodiscard]] std::string Dump() const;
 	[[nodiscard]] static VariantArray GetJoinedFieldValues(IdType rowId, const joins::NamespaceResults& joinResults,
@@ -204,4 +208,53 @@ private:
 };
 std::ostream& operator<<(std::ostream&, const SortExpression&);
 
+/// Sort expression without joined fields, compiled into the flat postfix program.
+/// Program is evaluated over the blocks of items: values of each field are extracted once per block into the contiguous column and
+/// each operation is applied to the whole block at once
+class SortExpressionProgram {
+public:
+	static constexpr size_t kBlockSize = 256;
+
+	/// Returns std::nullopt, if the expression depends on the joined namespaces
+	[[nodiscard]] static std::optional<SortExpressionProgram> Compile(const SortExpression&, const PayloadType&);
+	/// Calculates expression for the items with the specified row ids and ranks and appends the results to the end of 'results'
+	void Calculate(span<IdType> rowIds, span<uint8_t> procs, const std::vector<PayloadValue>& items, TagsMatcher&,
+				   h_vector<double, 32>& results);
+
+private:
+	struct Operation {
+		enum class Type : uint8_t { Load, Constant, Add, Subtract, Multiply, Divide, Negate, Abs };
+
+		Type type;
+		size_t column = 0;
+		double value = 0.0;
+	};
+	struct Column {
+		enum class Kind : uint8_t { Int, Int64, Double, Point, Rank, Generic };
+		using Source = std::variant<SortExprFuncs::Index, SortExprFuncs::Rank, SortExprFuncs::DistanceFromPoint,
+									SortExprFuncs::DistanceBetweenIndexes>;
+
+		Source source;
+		Kind kind = Kind::Generic;
+		size_t offset = 0;
+	};
+
+	SortExpressionProgram(const PayloadType& type) : type_(type) {}
+	[[nodiscard]] bool compile(SortExpression::const_iterator begin, SortExpression::const_iterator end);
+	void addOperation(Operation);
+	[[nodiscard]] size_t addColumn(Column::Source&&);
+	void fillColumn(const Column&, span<IdType> rowIds, span<uint8_t> procs, const std::vector<PayloadValue>& items,
+					TagsMatcher&, double* values) const;
+	void calculateBlock(span<IdType> rowIds, span<uint8_t> procs, const std::vector<PayloadValue>& items, TagsMatcher&,
+						h_vector<double, 32>& results);
+
+	PayloadType type_;
+	h_vector<Operation, 8> operations_;
+	h_vector<Column, 4> columns_;
+	size_t stackSize_ = 0;
+	size_t maxStackSize_ = 0;
+	std::vector<double> columnsData_;
+	std::vector<double> stack_;
+};
+
 }  // namespace reindexer
@@ -77,7 +77,12 @@ struct SortingContext {
 	int uncommitedIndex = -1;
 	bool forcedMode = false;
 	std::vector<SortExpression> expressions;
+	// Compiled expressions. Empty, if some of the expressions can not be compiled
+	std::vector<SortExpressionProgram> programs;
 	std::vector<h_vector<double, 32>> exprResults;
+	// Items, which expressions values are not calculated yet (for the compiled expressions only)
+	std::vector<IdType> pendingRowIds;
+	std::vector<uint8_t> pendingProcs;
 };
 
 struct SortingOptions {
@@ -0,0 +1,182 @@
+#include "payloadarena.h"
+#include <algorithm>
+#include <new>
+#include <vector>
+
+namespace reindexer {
+
+PayloadArena::~PayloadArena() { assertrx(slabsCount_ == 0); }
+
+void *PayloadArena::Alloc(size_t size) {
+	if (size > kMaxBlockSize) return nullptr;
+	const size_t sizeClass = (std::max<size_t>(size, 1) + kBlockAlign - 1) / kBlockAlign - 1;
+	std::lock_guard lck(mtx_);
+	auto &cls = classes_[sizeClass];
+	return allocFrom(cls.partial ? cls.partial : newSlab(sizeClass));
+}
+
+void PayloadArena::Free(void *block) noexcept {
+	Slab *slab = slabOf(block);
+	slab->arena->free(slab, block);
+}
+
+bool PayloadArena::BeginCompaction() {
+	std::lock_guard lck(mtx_);
+	if (!slabsCount_ || usedSize_ >= (1.0 - kCompactionThreshold) * slabsCount_ * kSlabSize) return false;
+	std::vector<Slab *> slabs;
+	bool evacuated = false;
+	for (auto &cls : classes_) {
+		slabs.clear();
+		size_t freeBlocks = 0;
+		for (Slab *s = cls.partial; s; s = s->next) {
+			slabs.emplace_back(s);
+			freeBlocks += s->capacity - s->used;
+		}
+		if (slabs.size() < 2) continue;
+		std::sort(slabs.begin(), slabs.end(), [](const Slab *l, const Slab *r) noexcept { return l->used < r->used; });
+		size_t moved = 0;
+		for (Slab *s : slabs) {
+			// Only the sparse slabs are evacuated and the rest of the class' slabs have to be able to take their blocks
+			const size_t slabFree = s->capacity - s->used;
+			if (2 * s->used > s->capacity || moved + s->used > freeBlocks - slabFree) break;
+			moved += s->used;
+			freeBlocks -= slabFree;
+			unlink(cls.partial, s);
+			s->evacuated = true;
+			link(cls.evacuated, s);
+			evacuated = true;
+		}
+	}
+	if (evacuated) ++compactionsCount_;
+	return evacuated;
+}
+
+void *PayloadArena::AllocRelocation(const void *block) noexcept {
+	Slab *slab = slabOf(block);
+	PayloadArena *arena = slab->arena;
+	std::lock_guard lck(arena->mtx_);
+	auto &cls = arena->classes_[slab->blockSize / kBlockAlign - 1];
+	// New slabs are not allocated for the relocations
+	if (!slab->evacuated || !cls.partial) return nullptr;
+	++arena->relocatedCount_;
+	return arena->allocFrom(cls.partial);
+}
+
+void PayloadArena::EndCompaction() noexcept {
+	std::lock_guard lck(mtx_);
+	for (auto &cls : classes_) {
+		while (cls.evacuated) {
+			Slab *s = cls.evacuated;
+			if (!s->used) {
+				freeSlab(cls.evacuated, s);
+				continue;
+			}
+			unlink(cls.evacuated, s);
+			s->evacuated = false;
+			link(cls.partial, s);
+		}
+	}
+}
+
+PayloadArena::Stats PayloadArena::GetStats() const {
+	Stats stats;
+	std::lock_guard lck(mtx_);
+	stats.slabsCount = slabsCount_;
+	stats.allocatedSize = slabsCount_ * kSlabSize;
+	stats.usedSize = usedSize_;
+	stats.blocksCount = blocksCount_;
+	stats.compactionsCount = compactionsCount_;
+	stats.relocatedCount = relocatedCount_;
+	return stats;
+}
+
+void PayloadArena::link(Slab *&head, Slab *slab) noexcept {
+	slab->prev = nullptr;
+	slab->next = head;
+	if (head) head->prev = slab;
+	head = slab;
+}
+
+void PayloadArena::unlink(Slab *&head, Slab *slab) noexcept {
+	if (slab->prev) {
+		slab->prev->next = slab->next;
+	} else {
+		head = slab->next;
+	}
+	if (slab->next) slab->next->prev = slab->prev;
+	slab->prev = slab->next = nullptr;
+}
+
+void *PayloadArena::allocFrom(Slab *slab) noexcept {
+	void *block = slab->freeList;
+	if (block) {
+		slab->freeList = *static_cast<void **>(block);
+	} else {
+		block = reinterpret_cast<uint8_t *>(slab) + kSlabHeaderSize + size_t(slab->bumped++) * slab->blockSize;
+	}
+	if (++slab->used == slab->capacity) {
+		unlink(classes_[slab->blockSize / kBlockAlign - 1].partial, slab);
+	}
+	usedSize_ += slab->blockSize;
+	++blocksCount_;
+	return block;
+}
+
+PayloadArena::Slab *PayloadArena::newSlab(size_t sizeClass) {
+	const uint32_t blockSize = (sizeClass + 1) * kBlockAlign;
+	void *mem = operator new(kSlabSize, std::align_val_t(kSlabSize));
+	const uint32_t capacity = (kSlabSize - kSlabHeaderSize) / blockSize;
+	Slab *slab = new (mem) Slab{this, nullptr, nullptr, nullptr, blockSize, capacity, 0, 0, false};
+	link(classes_[sizeClass].partial, slab);
+	++slabsCount_;
+	return slab;
+}
+
+void PayloadArena::freeSlab(Slab *&head, Slab *slab) noexcept {
+	unlink(head, slab);
+	slab->~Slab();
+	operator delete(slab, std::align_val_t(kSlabSize));
+	--slabsCount_;
+}
+
+void PayloadArena::free(Slab *slab, void *block) noexcept {
+	bool destroy = false;
+	{
+		std::lock_guard lck(mtx_);
+		auto &cls = classes_[slab->blockSize / kBlockAlign - 1];
+		Slab *&head = slab->evacuated ? cls.evacuated : cls.partial;
+		*static_cast<void **>(block) = slab->freeList;
+		slab->freeList = block;
+		usedSize_ -= slab->blockSize;
+		--blocksCount_;
+		if (slab->used-- == slab->capacity) {
+			link(head, slab);
+		}
+		const bool hasOwners = owners_.load(std::memory_order_relaxed);
+		// The last empty slab of the class is kept to avoid the slabs' reallocations on the alternating inserts and deletes
+		if (!slab->used && (slab->evacuated || !hasOwners || head != slab || slab->next)) {
+			freeSlab(head, slab);
+		}
+		destroy = !hasOwners && !slabsCount_;
+	}
+	if (destroy) delete this;
+}
+
+void PayloadArena::releaseOwner() noexcept {
+	bool destroy = false;
+	{
+		std::lock_guard lck(mtx_);
+		if (owners_.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+		for (auto &cls : classes_) {
+			for (Slab *s = cls.partial; s;) {
+				Slab *next = s->next;
+				if (!s->used) freeSlab(cls.partial, s);
+				s = next;
+			}
+		}
+		destroy = !slabsCount_;
+	}
+	if (destroy) delete this;
+}
+
+}  // namespace reindexer
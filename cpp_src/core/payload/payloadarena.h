@@ -0,0 +1,97 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include "estl/intrusive_ptr.h"
+
+namespace reindexer {
+
+/// Slab allocator of the namespace's payloads. Blocks of the same size class are packed into the aligned slabs, so the slab of the
+/// block is found by the block's address. Arena is shared by the namespace's copies and lives while it has owners or allocated blocks
+class PayloadArena {
+public:
+	struct Stats {
+		size_t slabsCount = 0;
+		size_t allocatedSize = 0;
+		size_t usedSize = 0;
+		size_t blocksCount = 0;
+		size_t compactionsCount = 0;
+		size_t relocatedCount = 0;
+	};
+
+	static constexpr size_t kSlabSize = 64 * 1024;
+	static constexpr size_t kBlockAlign = 16;
+	static constexpr size_t kMaxBlockSize = 2048;
+
+	static intrusive_ptr<PayloadArena> Create() { return intrusive_ptr<PayloadArena>(new PayloadArena()); }
+	PayloadArena(const PayloadArena &) = delete;
+	PayloadArena &operator=(const PayloadArena &) = delete;
+
+	/// Returns nullptr, if the size is too large for the arena's size classes
+	void *Alloc(size_t size);
+	static void Free(void *block) noexcept;
+	static PayloadArena *Of(const void *block) noexcept { return slabOf(block)->arena; }
+
+	/// Marks the sparse slabs as evacuated, so the new blocks are not allocated there. Returns false, if there is nothing to compact
+	bool BeginCompaction();
+	/// Allocates the new block for the data of the evacuated slab's block. Returns nullptr, if the block does not have to be moved
+	static void *AllocRelocation(const void *block) noexcept;
+	void EndCompaction() noexcept;
+	Stats GetStats() const;
+
+private:
+	struct Slab {
+		PayloadArena *arena;
+		Slab *prev;
+		Slab *next;
+		void *freeList;
+		uint32_t blockSize;
+		uint32_t capacity;
+		uint32_t used;
+		uint32_t bumped;
+		bool evacuated;
+	};
+	struct SizeClass {
+		// Slabs with free blocks. Full slabs are not linked anywhere until one of their blocks is freed
+		Slab *partial = nullptr;
+		Slab *evacuated = nullptr;
+	};
+
+	static constexpr size_t kSlabHeaderSize = (sizeof(Slab) + kBlockAlign - 1) / kBlockAlign * kBlockAlign;
+	static constexpr size_t kSizeClassesCount = kMaxBlockSize / kBlockAlign;
+	// Compaction is not started, while the share of the unused slabs' memory is lower
+	static constexpr double kCompactionThreshold = 0.25;
+
+	PayloadArena() = default;
+	~PayloadArena();
+
+	static Slab *slabOf(const void *block) noexcept {
+		return reinterpret_cast<Slab *>(reinterpret_cast<uintptr_t>(block) & ~uintptr_t(kSlabSize - 1));
+	}
+	static void link(Slab *&head, Slab *slab) noexcept;
+	static void unlink(Slab *&head, Slab *slab) noexcept;
+	void *allocFrom(Slab *slab) noexcept;
+	Slab *newSlab(size_t sizeClass);
+	void freeSlab(Slab *&head, Slab *slab) noexcept;
+	void free(Slab *slab, void *block) noexcept;
+	void releaseOwner() noexcept;
+
+	friend void intrusive_ptr_add_ref(PayloadArena *x) noexcept {
+		if (x) x->owners_.fetch_add(1, std::memory_order_relaxed);
+	}
+	friend void intrusive_ptr_release(PayloadArena *x) noexcept {
+		if (x) x->releaseOwner();
+	}
+
+	mutable std::mutex mtx_;
+	std::array<SizeClass, kSizeClassesCount> classes_;
+	std::atomic<int> owners_ = 0;
+	size_t slabsCount_ = 0;
+	size_t usedSize_ = 0;
+	size_t blocksCount_ = 0;
+	size_t compactionsCount_ = 0;
+	size_t relocatedCount_ = 0;
+};
+
+}  // namespace reindexer
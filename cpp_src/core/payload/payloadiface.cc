@@ -2,9 +2,11 @@
 
 #include "core/cjson/baseencoder.h"
 #include "core/cjson/cjsondecoder.h"
+#include "core/cjson/cjsontools.h"
 #include "core/keyvalue/p_string.h"
 #include "core/keyvalue/variant.h"
 #include "core/namespace/stringsholder.h"
+#include "core/payload/tuplescompressor.h"
 #include "payloadiface.h"
 #include "payloadvalue.h"
 
@@ -100,6 +102,20 @@ void PayloadIface<T>::GetByJsonPath(std::string_view jsonPath, TagsMatcher &tags
 	GetByJsonPath(tagsMatcher.path2indexedtag(jsonPath, nullptr, false), kvs, expectedType);
 }
 
+static bool scanTuple(std::string_view tuple, const TagsPath &path, KeyValueType expectedType, VariantArray &krefs) {
+	return scanCjsonPath(tuple, path, expectedType, krefs);
+}
+
+template <unsigned hvSize>
+static bool scanTuple(std::string_view tuple, const IndexedTagsPathImpl<hvSize> &path, KeyValueType expectedType, VariantArray &krefs) {
+	TagsPath tagsPath;
+	for (const auto &node : path) {
+		if (node.IsArrayNode() || node.IsWithExpression()) return false;
+		tagsPath.emplace_back(node.NameTag());
+	}
+	return scanCjsonPath(tuple, tagsPath, expectedType, krefs);
+}
+
 template <typename T>
 template <typename P>
 void PayloadIface<T>::getByJsonPath(const P &path, VariantArray &krefs, KeyValueType expectedType) const {
@@ -107,11 +123,20 @@ void PayloadIface<T>::getByJsonPath(const P &path, VariantArray &krefs, KeyValue
 	if (path.empty()) {
 		return;
 	}
+	// Fast path for the non-indexed fields of the uncompressed tuple
+	Get(0, krefs);
+	const std::string_view tuple(krefs[0]);
+	krefs.clear<false>();
+	if (!TuplesCompressor::IsCompressed(tuple)) {
+		if (scanTuple(tuple, path, expectedType, krefs)) return;
+		krefs.clear<false>();
+	}
 	const FieldsSet filter{{path}};
 	ConstPayload pl(t_, *v_);
 	BaseEncoder<FieldsExtractor> encoder(nullptr, &filter);
 	FieldsExtractor extractor(&krefs, expectedType, path.size(), &filter);
 	encoder.Encode(pl, extractor);
+	if (encoder.IsTupleDecompressed()) krefs.EnsureHold();
 }
 
 template <typename T>
@@ -190,6 +215,7 @@ VariantArray PayloadIface<T>::GetIndexedArrayData(const IndexedTagsPath &tagsPat
 
 	ConstPayload pl(t_, *v_);
 	encoder.Encode(pl, extractor);
+	if (encoder.IsTupleDecompressed()) values.EnsureHold();
 	return values;
 }
 
@@ -385,6 +411,15 @@ uint64_t PayloadIface<T>::GetHash() const noexcept {
 			for (int i = 0; i < arr->len; i++, p += f.ElemSizeof()) {
 				ret ^= PayloadFieldValue(f, p).Hash();
 			}
+		} else if (field == 0 && f.Type().Is<KeyValueType::String>()) {
+			// Hash of the tuple must not depend on its compression (e.g. the same data on master and slave may be stored in different forms),
+			// so the compressed tuple holds the hash of the raw one
+			const p_string tuple(Field(field).Get());
+			if (TuplesCompressor::IsCompressed(tuple)) {
+				ret ^= TuplesCompressor::RawHash(tuple);
+			} else {
+				ret ^= std::hash<p_string>()(tuple);
+			}
 		} else
 			ret ^= Field(field).Hash();
 	}
@@ -195,6 +195,8 @@ bool PayloadType::FieldByName(std::string_view name, int &field) const { return
 bool PayloadType::Contains(std::string_view field) const { return get()->Contains(field); }
 int PayloadType::FieldByJsonPath(std::string_view jsonPath) const { return get()->FieldByJsonPath(jsonPath); }
 const std::vector<int> &PayloadType::StrFields() const { return get()->StrFields(); }
+TuplesCompressor *PayloadType::Compressor() const noexcept { return get()->Compressor(); }
+void PayloadType::SetCompressor(std::shared_ptr<TuplesCompressor> compressor) { clone()->SetCompressor(std::move(compressor)); }
 size_t PayloadType::TotalSize() const { return get()->TotalSize(); }
 std::string PayloadType::ToString() const { return get()->ToString(); }
 
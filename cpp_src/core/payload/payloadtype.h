@@ -1,6 +1,7 @@
 #pragma once
 
 #include <initializer_list>
+#include <memory>
 #include <string>
 #include <vector>
 #include "estl/cow.h"
@@ -9,6 +10,7 @@
 namespace reindexer {
 
 class PayloadTypeImpl;
+class TuplesCompressor;
 
 class PayloadType : public shared_cow_ptr<PayloadTypeImpl> {
 public:
@@ -32,6 +34,8 @@ public:
 	bool Contains(std::string_view field) const;
 	int FieldByJsonPath(std::string_view jsonPath) const;
 	const std::vector<int> &StrFields() const;
+	TuplesCompressor *Compressor() const noexcept;
+	void SetCompressor(std::shared_ptr<TuplesCompressor>);
 	size_t TotalSize() const;
 	std::string ToString() const;
 	void Dump(std::ostream &, std::string_view step = "  ", std::string_view offset = "") const;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <initializer_list>
+#include <memory>
 #include <string>
 #include <vector>
 #include "estl/fast_hash_map.h"
@@ -11,6 +12,7 @@ namespace reindexer {
 
 class Serializer;
 class WrSerializer;
+class TuplesCompressor;
 
 // Type of all payload object
 class PayloadTypeImpl {
@@ -38,6 +40,9 @@ public:
 	int FieldByJsonPath(std::string_view jsonPath) const noexcept;
 	const std::vector<int> &StrFields() const &noexcept { return strFields_; }
 	const std::vector<int> &StrFields() const && = delete;
+	// Compressor of the namespace's tuples. May be null
+	TuplesCompressor *Compressor() const noexcept { return compressor_.get(); }
+	void SetCompressor(std::shared_ptr<TuplesCompressor> compressor) noexcept { compressor_ = std::move(compressor); }
 
 	void serialize(WrSerializer &ser) const;
 	void deserialize(Serializer &ser);
@@ -52,6 +57,7 @@ private:
 	JsonPathMap fieldsByJsonPath_;
 	std::string name_;
 	std::vector<int> strFields_;
+	std::shared_ptr<TuplesCompressor> compressor_;
 };
 
 }  // namespace reindexer
@@ -1,11 +1,12 @@
 #include "payloadvalue.h"
 #include <iostream>
 #include "core/keyvalue/p_string.h"
+#include "payloadarena.h"
 
 namespace reindexer {
 
-PayloadValue::PayloadValue(size_t size, const uint8_t *ptr, size_t cap) : p_(nullptr) {
-	p_ = alloc((cap != 0) ? cap : size);
+PayloadValue::PayloadValue(size_t size, const uint8_t *ptr, size_t cap, PayloadArena *arena) : p_(nullptr) {
+	p_ = alloc((cap != 0) ? cap : size, arena);
 
 	if (ptr) {
 		memcpy(Ptr(), ptr, size);
@@ -14,11 +15,16 @@ PayloadValue::PayloadValue(size_t size, const uint8_t *ptr, size_t cap) : p_(nul
 	}
 }
 
-uint8_t *PayloadValue::alloc(size_t cap) {
-	auto pn = reinterpret_cast<uint8_t *>(operator new(cap + sizeof(dataHeader)));
+uint8_t *PayloadValue::alloc(size_t cap, PayloadArena *arena) {
+	assertrx(cap < kArenaFlag);
+	auto pn = arena ? static_cast<uint8_t *>(arena->Alloc(cap + sizeof(dataHeader))) : nullptr;
+	const unsigned arenaFlag = pn ? kArenaFlag : 0;
+	if (!pn) {
+		pn = reinterpret_cast<uint8_t *>(operator new(cap + sizeof(dataHeader)));
+	}
 	dataHeader *nheader = reinterpret_cast<dataHeader *>(pn);
 	new (nheader) dataHeader();
-	nheader->cap = cap;
+	nheader->cap = cap | arenaFlag;
 	if (p_) {
 		nheader->lsn = header()->lsn;
 	} else
@@ -28,8 +34,13 @@ uint8_t *PayloadValue::alloc(size_t cap) {
 
 void PayloadValue::release() noexcept {
 	if (p_ && header()->refcount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+		const bool inArena = header()->cap & kArenaFlag;
 		header()->~dataHeader();
-		operator delete(p_);
+		if (inArena) {
+			PayloadArena::Free(p_);
+		} else {
+			operator delete(p_);
+		}
 	}
 	p_ = nullptr;
 }
@@ -41,10 +52,10 @@ void PayloadValue::Clone(size_t size) {
 	}
 	assertrx(size || p_);
 
-	auto pn = alloc(p_ ? header()->cap : size);
+	auto pn = alloc(p_ ? GetCapacity() : size, p_ ? arena() : nullptr);
 	if (p_) {
 		// Make new data & copy
-		memcpy(pn + sizeof(dataHeader), Ptr(), header()->cap);
+		memcpy(pn + sizeof(dataHeader), Ptr(), GetCapacity());
 		// Release old data
 		release();
 	} else {
@@ -58,9 +69,9 @@ void PayloadValue::Resize(size_t oldSize, size_t newSize) {
 	assertrx(p_);
 	assertrx(header()->refcount.load(std::memory_order_acquire) == 1);
 
-	if (newSize <= header()->cap) return;
+	if (newSize <= GetCapacity()) return;
 
-	auto pn = alloc(newSize);
+	auto pn = alloc(newSize, arena());
 	memcpy(pn + sizeof(dataHeader), Ptr(), oldSize);
 	memset(pn + sizeof(dataHeader) + oldSize, 0, newSize - oldSize);
 
@@ -69,14 +80,31 @@ void PayloadValue::Resize(size_t oldSize, size_t newSize) {
 	p_ = pn;
 }
 
+bool PayloadValue::Compact() noexcept {
+	if (!p_ || !(header()->cap & kArenaFlag) || header()->refcount.load(std::memory_order_acquire) != 1) {
+		return false;
+	}
+	auto pn = static_cast<uint8_t *>(PayloadArena::AllocRelocation(p_));
+	if (!pn) return false;
+	dataHeader *nheader = new (pn) dataHeader();
+	nheader->cap = header()->cap;
+	nheader->lsn = header()->lsn;
+	memcpy(pn + sizeof(dataHeader), Ptr(), GetCapacity());
+	release();
+	p_ = pn;
+	return true;
+}
+
+PayloadArena *PayloadValue::arena() const noexcept { return (header()->cap & kArenaFlag) ? PayloadArena::Of(p_) : nullptr; }
+
 std::ostream &operator<<(std::ostream &os, const PayloadValue &pv) {
 	os << "{p_: " << std::hex << static_cast<const void *>(pv.p_) << std::dec;
 	if (pv.p_) {
 		const auto *header = pv.header();
-		os << ", refcount: " << header->refcount.load(std::memory_order_relaxed) << ", cap: " << header->cap << ", lsn: " << header->lsn
-		   << ", [" << std::hex;
+		os << ", refcount: " << header->refcount.load(std::memory_order_relaxed) << ", cap: " << pv.GetCapacity()
+		   << ", lsn: " << header->lsn << ", [" << std::hex;
 		const uint8_t *ptr = pv.Ptr();
-		const size_t cap = header->cap;
+		const size_t cap = pv.GetCapacity();
 		for (size_t i = 0; i < cap; ++i) {
 			if (i != 0) os << ' ';
 			os << static_cast<unsigned>(ptr[i]);
@@ -7,6 +7,8 @@
 
 namespace reindexer {
 
+class PayloadArena;
+
 // The full item's payload object. It must be speed & size optimized
 class PayloadValue {
 public:
@@ -26,8 +28,8 @@ public:
 			header()->refcount.fetch_add(1, std::memory_order_relaxed);
 		}
 	}
-	// Alloc payload store with size, and copy data from another array
-	PayloadValue(size_t size, const uint8_t *ptr = nullptr, size_t cap = 0);
+	// Alloc payload store with size, and copy data from another array. Data is placed into the arena, if it's set and the size fits
+	PayloadValue(size_t size, const uint8_t *ptr = nullptr, size_t cap = 0, PayloadArena *arena = nullptr);
 	~PayloadValue() { release(); }
 	PayloadValue &operator=(const PayloadValue &other) noexcept {
 		if (&other != this) {
@@ -52,17 +54,23 @@ public:
 	void Clone(size_t size = 0);
 	// Resize
 	void Resize(size_t oldSize, size_t newSize);
+	// Move exclusive data out of the arena's evacuated slab. Returns true, if data was moved
+	bool Compact() noexcept;
 	// Get data pointer
 	uint8_t *Ptr() const noexcept { return p_ + sizeof(dataHeader); }
 	void SetLSN(int64_t lsn) noexcept { header()->lsn = lsn; }
 	int64_t GetLSN() const noexcept { return p_ ? header()->lsn : 0; }
 	bool IsFree() const noexcept { return bool(p_ == nullptr); }
 	void Free() noexcept { release(); }
-	size_t GetCapacity() const noexcept { return header()->cap; }
+	size_t GetCapacity() const noexcept { return header()->cap & ~kArenaFlag; }
 	const uint8_t *get() const noexcept { return p_; }
 
 protected:
-	uint8_t *alloc(size_t cap);
+	// Set in the capacity of the data allocated in the arena
+	static constexpr unsigned kArenaFlag = 1u << 31;
+
+	uint8_t *alloc(size_t cap, PayloadArena *arena);
+	PayloadArena *arena() const noexcept;
 	void release() noexcept;
 
 	dataHeader *header() noexcept { return reinterpret_cast<dataHeader *>(p_); }
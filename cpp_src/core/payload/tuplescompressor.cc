@@ -0,0 +1,122 @@
+#include "tuplescompressor.h"
+#include <mutex>
+#include <snappy.h>
+#include "core/keyvalue/p_string.h"
+#include "tools/clock.h"
+#include "tools/errors.h"
+
+namespace reindexer {
+
+TuplesCompressor::TuplesCompressor() : cache_(kCacheSlots) {}
+
+size_t TuplesCompressor::UncompressedSize(std::string_view compressedTuple) {
+	assertrx(IsCompressed(compressedTuple));
+	size_t size = 0;
+	if (!snappy::GetUncompressedLength(compressedTuple.data() + kHeaderSize, compressedTuple.size() - kHeaderSize, &size)) {
+		throw Error(errParseBin, "Unable to get size of the compressed tuple");
+	}
+	return size;
+}
+
+key_string TuplesCompressor::Decompress(TuplesCompressor *compressor, p_string compressedTuple) {
+	if (compressor) {
+		return compressor->decompress(compressedTuple);
+	}
+	return uncompress(compressedTuple);
+}
+
+void TuplesCompressor::Configure(bool enabled, size_t minTupleSize, size_t cacheSizeLimit) {
+	enabled_.store(enabled, std::memory_order_relaxed);
+	minTupleSize_.store(minTupleSize, std::memory_order_relaxed);
+	if (cacheSizeLimit_.exchange(cacheSizeLimit, std::memory_order_relaxed) > cacheSizeLimit) {
+		clearCache();
+	}
+}
+
+bool TuplesCompressor::Compress(std::string_view tuple, std::string &out) const {
+	if (!Enabled() || tuple.size() < minTupleSize_.load(std::memory_order_relaxed) || IsCompressed(tuple)) {
+		return false;
+	}
+	out.resize(kHeaderSize + snappy::MaxCompressedLength(tuple.size()));
+	out[0] = kMarker;
+	const uint64_t hash = std::hash<p_string>()(p_string(&tuple));
+	std::memcpy(out.data() + 1, &hash, sizeof(hash));
+	size_t compressedSize = 0;
+	snappy::RawCompress(tuple.data(), tuple.size(), out.data() + kHeaderSize, &compressedSize);
+	// There is no reason to store tuple in the compressed form, if it does not save at least 1/8 of the memory
+	if (kHeaderSize + compressedSize > tuple.size() - tuple.size() / 8) {
+		return false;
+	}
+	out.resize(kHeaderSize + compressedSize);
+	return true;
+}
+
+TuplesCompressor::Stats TuplesCompressor::GetStats() const noexcept {
+	Stats stats;
+	stats.decompressionsCount = decompressionsCount_.load(std::memory_order_relaxed);
+	stats.decompressionTimeUs = decompressionTimeNs_.load(std::memory_order_relaxed) / 1000;
+	stats.cacheHitsCount = cacheHitsCount_.load(std::memory_order_relaxed);
+	stats.cacheSize = cacheSize_.load(std::memory_order_relaxed);
+	return stats;
+}
+
+key_string TuplesCompressor::uncompress(std::string_view compressedTuple) {
+	assertrx(IsCompressed(compressedTuple));
+	std::string tuple;
+	if (!snappy::Uncompress(compressedTuple.data() + kHeaderSize, compressedTuple.size() - kHeaderSize, &tuple)) {
+		throw Error(errParseBin, "Unable to decompress tuple");
+	}
+	return make_key_string(std::move(tuple));
+}
+
+key_string TuplesCompressor::decompress(p_string compressedTuple) {
+	// Only the tuples from the namespace's storage (i.e. key_strings) may be cached
+	const bool cacheable = uint64_t(compressedTuple.type()) == p_string::tagKeyString && cacheSizeLimit_.load(std::memory_order_relaxed);
+	const void *key = cacheable ? compressedTuple.getKeyString().get() : nullptr;
+	const size_t idx = cacheable ? slot(key) : 0;
+	if (cacheable) {
+		std::lock_guard lck(cacheLocks_[idx % kCacheLocks]);
+		const auto &entry = cache_[idx];
+		if (entry.compressed.get() == key) {
+			cacheHitsCount_.fetch_add(1, std::memory_order_relaxed);
+			return entry.tuple;
+		}
+	}
+
+	const auto start = steady_clock_w::now();
+	key_string tuple = uncompress(compressedTuple);
+	decompressionTimeNs_.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(steady_clock_w::now() - start).count(),
+								   std::memory_order_relaxed);
+	decompressionsCount_.fetch_add(1, std::memory_order_relaxed);
+
+	if (cacheable) {
+		const size_t size = sizeof(base_key_string) + tuple->heap_size();
+		CacheEntry evicted;
+		{
+			std::lock_guard lck(cacheLocks_[idx % kCacheLocks]);
+			auto &entry = cache_[idx];
+			// Slot is just overwritten by the last decompressed tuple. Entry is not replaced, if the cache is full
+			if (cacheSize_.load(std::memory_order_relaxed) + size <= cacheSizeLimit_.load(std::memory_order_relaxed) + entry.size) {
+				cacheSize_.fetch_add(size, std::memory_order_relaxed);
+				cacheSize_.fetch_sub(entry.size, std::memory_order_relaxed);
+				evicted = std::move(entry);
+				entry.compressed = compressedTuple.getKeyString();
+				entry.tuple = tuple;
+				entry.size = size;
+			}
+		}
+	}
+	return tuple;
+}
+
+void TuplesCompressor::clearCache() {
+	for (size_t i = 0; i < kCacheSlots; ++i) {
+		CacheEntry evicted;
+		std::lock_guard lck(cacheLocks_[i % kCacheLocks]);
+		cacheSize_.fetch_sub(cache_[i].size, std::memory_order_relaxed);
+		evicted = std::move(cache_[i]);
+		cache_[i] = CacheEntry();
+	}
+}
+
+}  // namespace reindexer
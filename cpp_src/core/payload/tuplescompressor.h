@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <vector>
+#include "core/keyvalue/key_string.h"
+#include "estl/mutex.h"
+
+namespace reindexer {
+
+struct p_string;
+
+// Compressor of the items' tuples (CJSON with non-indexed fields, which is stored in the payload's field 0).
+// Compressed tuple starts with the marker byte, which is never the first byte of the raw tuple (raw tuple always starts with TAG_OBJECT),
+// so raw and compressed tuples may coexist in the same namespace and compression mode may be changed at any time.
+// Marker is followed by the 64-bit hash of the raw tuple and by the snappy data.
+// Compressor also holds small cache of the decompressed tuples for the hot rows
+class TuplesCompressor {
+public:
+	struct Stats {
+		size_t decompressionsCount = 0;
+		size_t decompressionTimeUs = 0;
+		size_t cacheHitsCount = 0;
+		size_t cacheSize = 0;
+	};
+
+	TuplesCompressor();
+	TuplesCompressor(const TuplesCompressor &) = delete;
+	TuplesCompressor &operator=(const TuplesCompressor &) = delete;
+
+	static bool IsCompressed(std::string_view tuple) noexcept { return !tuple.empty() && tuple[0] == kMarker; }
+	static size_t UncompressedSize(std::string_view compressedTuple);
+	// Hash of the raw tuple, which is equal to the hash of the tuple's p_string. Tuple is not decompressed
+	static uint64_t RawHash(std::string_view compressedTuple) noexcept {
+		uint64_t hash;
+		std::memcpy(&hash, compressedTuple.data() + 1, sizeof(hash));
+		return hash;
+	}
+	// Decompresses tuple, using cache of the compressor, if it's not null
+	static key_string Decompress(TuplesCompressor *, p_string compressedTuple);
+
+	void Configure(bool enabled, size_t minTupleSize, size_t cacheSizeLimit);
+	bool Enabled() const noexcept { return enabled_.load(std::memory_order_relaxed); }
+	// Returns false, if tuple has to be stored as is (compression is disabled, tuple is too small or was not compressed well enough)
+	bool Compress(std::string_view tuple, std::string &out) const;
+	Stats GetStats() const noexcept;
+
+private:
+	// ctag of TAG_END
+	constexpr static char kMarker = 0x07;
+	constexpr static size_t kHeaderSize = 1 + sizeof(uint64_t);
+	constexpr static unsigned kCacheSlotsBits = 10;
+	constexpr static size_t kCacheSlots = size_t(1) << kCacheSlotsBits;
+	constexpr static size_t kCacheLocks = 64;
+
+	struct CacheEntry {
+		// Holds compressed tuple, so its address can not be reused while the entry exists
+		key_string compressed;
+		key_string tuple;
+		size_t size = 0;
+	};
+
+	static key_string uncompress(std::string_view compressedTuple);
+	key_string decompress(p_string compressedTuple);
+	static size_t slot(const void *ptr) noexcept {
+		return (uint64_t(reinterpret_cast<uintptr_t>(ptr)) * 0x9E3779B97F4A7C15ull) >> (64 - kCacheSlotsBits);
+	}
+	void clearCache();
+
+	std::atomic<bool> enabled_ = {false};
+	std::atomic<size_t> minTupleSize_ = {0};
+	std::atomic<size_t> cacheSizeLimit_ = {0};
+	std::atomic<size_t> cacheSize_ = {0};
+	std::atomic<size_t> decompressionsCount_ = {0};
+	std::atomic<size_t> decompressionTimeNs_ = {0};
+	std::atomic<size_t> cacheHitsCount_ = {0};
+	std::vector<CacheEntry> cache_;
+	std::array<spinlock, kCacheLocks> cacheLocks_;
+};
+
+}  // namespace reindexer
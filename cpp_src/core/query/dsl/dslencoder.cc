@@ -233,6 +233,9 @@ void toDsl(const Query& query, QueryScope scope, JsonBuilder& builder) {
 					builder.Put("strict_mode", strictMode);
 				}
 				builder.Put("select_with_rank", query.IsWithRank());
+				if (query.IsIndexOnly()) {
+					builder.Put("select_index_only", true);
+				}
 			}
 
 			encodeSelectFilter(query, builder);
@@ -28,6 +28,7 @@ enum class Root {
 	Explain,
 	EqualPositions,
 	WithRank,
+	IndexOnly,
 	StrictMode,
 	QueryType,
 	DropFields,
@@ -61,6 +62,7 @@ static const fast_str_map<Root> root_map = {
 	{"explain", Root::Explain},
 	{"equal_positions", Root::EqualPositions},
 	{"select_with_rank", Root::WithRank},
+	{"select_index_only", Root::IndexOnly},
 	{"strict_mode", Root::StrictMode},
 	{"type", Root::QueryType},
 	{"drop_fields", Root::DropFields},
@@ -670,6 +672,10 @@ void parse(const JsonValue& root, Query& q) {
 				checkJsonValueType(v, name, JSON_FALSE, JSON_TRUE);
 				if (v.getTag() == JSON_TRUE) q.WithRank();
 				break;
+			case Root::IndexOnly:
+				checkJsonValueType(v, name, JSON_FALSE, JSON_TRUE);
+				if (v.getTag() == JSON_TRUE) q.IndexOnly();
+				break;
 			case Root::StrictMode:
 				checkJsonValueType(v, name, JSON_STRING);
 				q.Strict(strictModeFromString(std::string(v.toString())));
@@ -18,6 +18,10 @@ enum class Command : int {
 	ArrayRemove = 1,
 	ArrayRemoveOnce,
 };
+
+bool isArithmeticType(KeyValueType type) noexcept {
+	return type.Is<KeyValueType::Int>() || type.Is<KeyValueType::Int64>() || type.Is<KeyValueType::Double>();
+}
 }
 
 void ExpressionEvaluator::captureArrayContent(tokenizer& parser) {
@@ -346,4 +350,140 @@ VariantArray ExpressionEvaluator::Evaluate(std::string_view expr, const PayloadV
 	return (state_ == StateArrayConcat) ? std::move(arrayValues_).MarkArray() : VariantArray{Variant(expressionValue)};
 }
 
+std::optional<CompiledExpression> CompiledExpression::Compile(std::string_view expr, const PayloadType& type) {
+	CompiledExpression result(type);
+	tokenizer parser(expr);
+	try {
+		if (!result.compileSumAndSubtracting(parser)) return std::nullopt;
+	} catch (const Error&) {
+		// Syntax errors are reported by ExpressionEvaluator
+		return std::nullopt;
+	}
+	return result;
+}
+
+// Parsing mirrors ExpressionEvaluator to get exactly the same results
+bool CompiledExpression::compilePrimary(tokenizer& parser) {
+	token tok = parser.next_token();
+	if (tok.text() == "("sv) {
+		if (!compileSumAndSubtracting(parser)) return false;
+		return parser.next_token().text() == ")"sv;
+	}
+	switch (tok.type) {
+		case TokenNumber: {
+			using double_conversion::StringToDoubleConverter;
+			static const StringToDoubleConverter converter{StringToDoubleConverter::NO_FLAGS, NAN, NAN, nullptr, nullptr};
+			int countOfCharsParsedAsDouble;
+			operations_.emplace_back(Operation{.type = Operation::Type::Number,
+											   .value = converter.StringToDouble(tok.text_.data(), tok.text_.size(), &countOfCharsParsedAsDouble)});
+			break;
+		}
+		case TokenName:
+			if (!compileName(parser, tok)) return false;
+			break;
+		case TokenString:
+		case TokenEnd:
+		case TokenOp:
+		case TokenSymbol:
+		case TokenSign:
+			return false;
+	}
+	// Arrays concatenation
+	return parser.peek_token().text() != "|"sv;
+}
+
+bool CompiledExpression::compileName(tokenizer& parser, const token& tok) {
+	int field = 0;
+	if (type_->FieldByName(tok.text(), field)) {
+		const auto& fieldType = type_->Field(field);
+		if (fieldType.IsArray() || !isArithmeticType(fieldType.Type())) return false;
+		operations_.emplace_back(Operation{.type = Operation::Type::Field, .field = field});
+		return true;
+	}
+	if (tok.text() == "array_remove"sv || tok.text() == "array_remove_once"sv || tok.text() == "true"sv || tok.text() == "false"sv ||
+		parser.peek_token(tokenizer::flags::treat_sign_as_token).text() == "("sv) {
+		return false;
+	}
+	operations_.emplace_back(Operation{.type = Operation::Type::JsonPath, .field = int(jsonPaths_.size())});
+	jsonPaths_.emplace_back(tok.text());
+	return true;
+}
+
+bool CompiledExpression::compileMultiplicationAndDivision(tokenizer& parser, token& tok) {
+	if (!compilePrimary(parser)) return false;
+	tok = parser.peek_token(tokenizer::flags::treat_sign_as_token);
+	while (tok.text() == "*"sv || tok.text() == "/"sv) {
+		const auto type = (tok.text() == "*"sv) ? Operation::Type::Multiply : Operation::Type::Divide;
+		parser.next_token(tokenizer::flags::treat_sign_as_token);
+		if (!compileMultiplicationAndDivision(parser, tok)) return false;
+		operations_.emplace_back(Operation{.type = type});
+	}
+	return true;
+}
+
+bool CompiledExpression::compileSumAndSubtracting(tokenizer& parser) {
+	token tok;
+	if (!compileMultiplicationAndDivision(parser, tok)) return false;
+	tok = parser.peek_token(tokenizer::flags::treat_sign_as_token);
+	while (tok.text() == "+"sv || tok.text() == "-"sv) {
+		const auto type = (tok.text() == "+"sv) ? Operation::Type::Add : Operation::Type::Subtract;
+		parser.next_token(tokenizer::flags::treat_sign_as_token);
+		if (!compileMultiplicationAndDivision(parser, tok)) return false;
+		operations_.emplace_back(Operation{.type = type});
+	}
+	return true;
+}
+
+std::optional<double> CompiledExpression::Evaluate(const PayloadValue& v, TagsMatcher& tagsMatcher) {
+	ConstPayload pv(*type_, v);
+	stack_.clear();
+	for (const auto& op : operations_) {
+		switch (op.type) {
+			case Operation::Type::Number:
+				stack_.push_back(op.value);
+				continue;
+			case Operation::Type::Field:
+				stack_.push_back(pv.Get(op.field, 0).As<double>());
+				continue;
+			case Operation::Type::JsonPath:
+				pv.GetByJsonPath(jsonPaths_[op.field], tagsMatcher, values_, KeyValueType::Undefined{});
+				if (values_.size() != 1 || values_.IsArrayValue() || !isArithmeticType(values_.front().Type())) {
+					return std::nullopt;
+				}
+				stack_.push_back(values_.front().As<double>());
+				continue;
+			case Operation::Type::Add:
+			case Operation::Type::Subtract:
+			case Operation::Type::Multiply:
+			case Operation::Type::Divide:
+				break;
+		}
+		assertrx_throw(stack_.size() >= 2);
+		const double right = stack_.back();
+		stack_.pop_back();
+		double& left = stack_.back();
+		switch (op.type) {
+			case Operation::Type::Add:
+				left += right;
+				break;
+			case Operation::Type::Subtract:
+				left -= right;
+				break;
+			case Operation::Type::Multiply:
+				left *= right;
+				break;
+			case Operation::Type::Divide:
+				if (right == 0) throw Error(errLogic, "Division by zero!");
+				left /= right;
+				break;
+			case Operation::Type::Number:
+			case Operation::Type::Field:
+			case Operation::Type::JsonPath:
+				break;
+		}
+	}
+	assertrx_throw(stack_.size() == 1);
+	return stack_.back();
+}
+
 }  // namespace reindexer
@@ -2,6 +2,7 @@
 
 #include <optional>
 #include "core/keyvalue/variant.h"
+#include "estl/h_vector.h"
 
 namespace reindexer {
 
@@ -44,4 +45,38 @@ private:
 	VariantArray arrayValues_;
 	State state_ = None;
 };
+
+/// Arithmetical expression, which is parsed once for all the modified items: field names are resolved against the payload type and
+/// the expression is executed as a sequence of stack machine operations. Expressions with arrays, strings, functions and commands are
+/// not compiled and have to be evaluated by ExpressionEvaluator
+class CompiledExpression {
+public:
+	/// Returns std::nullopt, if the expression can not be compiled
+	[[nodiscard]] static std::optional<CompiledExpression> Compile(std::string_view expr, const PayloadType& type);
+	/// Returns std::nullopt, if some of the item's fields are not scalar numbers, so the expression has to be evaluated by
+	/// ExpressionEvaluator to get the exact result or error
+	[[nodiscard]] std::optional<double> Evaluate(const PayloadValue& v, TagsMatcher& tagsMatcher);
+
+private:
+	struct Operation {
+		enum class Type : uint8_t { Number, Field, JsonPath, Add, Subtract, Multiply, Divide };
+
+		Type type;
+		int field = 0;
+		double value = 0.0;
+	};
+
+	CompiledExpression(const PayloadType& type) noexcept : type_(&type) {}
+	[[nodiscard]] bool compilePrimary(tokenizer& parser);
+	[[nodiscard]] bool compileName(tokenizer& parser, const token& tok);
+	[[nodiscard]] bool compileMultiplicationAndDivision(tokenizer& parser, token& tok);
+	[[nodiscard]] bool compileSumAndSubtracting(tokenizer& parser);
+
+	const PayloadType* type_;
+	h_vector<Operation, 8> operations_;
+	h_vector<std::string, 2> jsonPaths_;
+	h_vector<double, 8> stack_;
+	VariantArray values_;
+};
+
 }  // namespace reindexer
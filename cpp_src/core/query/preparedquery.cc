@@ -0,0 +1,59 @@
+#include "preparedquery.h"
+
+namespace reindexer {
+
+// Heap memory of the query structures. Values and strings are accounted by the serialized query size
+static size_t queryStructuresSize(const Query &q) noexcept {
+	size_t size = sizeof(Query) + q.Entries().Size() * sizeof(QueryEntry) + q.UpdateFields().size() * sizeof(UpdateEntry) +
+				  q.sortingEntries_.size() * sizeof(SortingEntry) + q.aggregations_.size() * sizeof(AggregateEntry);
+	for (const auto &jq : q.GetJoinQueries()) size += queryStructuresSize(jq);
+	for (const auto &mq : q.GetMergeQueries()) size += queryStructuresSize(mq);
+	for (const auto &sq : q.GetSubQueries()) size += queryStructuresSize(sq);
+	return size;
+}
+
+PreparedQuery::PreparedQuery(Query &&q, std::vector<QueryParamPosition> &&params) : query_(std::move(q)), params_(std::move(params)) {
+	WrSerializer ser;
+	query_.Serialize(ser);
+	querySize_ = ser.Len() + queryStructuresSize(query_);
+}
+
+PreparedQuery PreparedQuery::FromSQL(std::string_view sql) {
+	std::vector<QueryParamPosition> params;
+	Query q = SQLParser::Parse(sql, params);
+	return PreparedQuery(std::move(q), std::move(params));
+}
+
+Query PreparedQuery::Bind(const VariantArray &params) const {
+	if (params.size() != params_.size()) {
+		throw Error(errParams, "Prepared query expects %d parameters, but %d parameters was provided", params_.size(), params.size());
+	}
+	Query q = query_;
+	for (size_t i = 0, s = params_.size(); i < s; ++i) {
+		const auto &pos = params_[i];
+		// Values are verified against the entry's condition on the updater's destruction
+		auto values = q.GetUpdatableEntry<QueryEntry>(pos.entryIdx).UpdatableValues();
+		values.Get()[pos.valueIdx] = params[i];
+	}
+	return q;
+}
+
+PreparedQueriesCache &PreparedQueriesCache::Instance() {
+	static PreparedQueriesCache cache;
+	return cache;
+}
+
+std::shared_ptr<const PreparedQuery> PreparedQueriesCache::Prepare(std::string_view sql) {
+	PreparedQueryCacheKey key{std::string(sql)};
+	auto cached = Get(key);
+	if (cached.valid && cached.val.query) {
+		return std::move(cached.val.query);
+	}
+	auto prepared = std::make_shared<const PreparedQuery>(PreparedQuery::FromSQL(sql));
+	if (cached.valid) {
+		Put(key, PreparedQueryCacheVal{prepared});
+	}
+	return prepared;
+}
+
+}  // namespace reindexer
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "core/lrucache.h"
+#include "core/query/query.h"
+#include "core/query/sql/sqlparser.h"
+
+namespace reindexer {
+
+/// Parsed sql query with '?' parameter placeholders.
+/// Parsing is done once, then the placeholders are replaced with the actual values on each execution.
+class PreparedQuery {
+public:
+	/// Parses sql query with parameter placeholders.
+	/// Placeholders are allowed as the values of the where conditions of the main query: 'WHERE id = ?', 'WHERE id IN (?, ?, 10)'.
+	/// @param sql - sql query.
+	[[nodiscard]] static PreparedQuery FromSQL(std::string_view sql);
+
+	/// Creates executable query from the prepared one.
+	/// @param params - values of the placeholders (in the order of appearance in the sql text).
+	/// @return query with the substituted values
+	[[nodiscard]] Query Bind(const VariantArray &params) const;
+
+	[[nodiscard]] size_t ParamsCount() const noexcept { return params_.size(); }
+	/// Estimated memory size of the prepared query, including the parsed query
+	[[nodiscard]] size_t Size() const noexcept {
+		return sizeof(PreparedQuery) + params_.capacity() * sizeof(QueryParamPosition) + querySize_;
+	}
+	[[nodiscard]] const Query &GetQuery() const noexcept { return query_; }
+
+private:
+	PreparedQuery(Query &&q, std::vector<QueryParamPosition> &&params);
+
+	Query query_;
+	std::vector<QueryParamPosition> params_;
+	size_t querySize_ = 0;
+};
+
+struct PreparedQueryCacheKey {
+	size_t Size() const noexcept { return sizeof(PreparedQueryCacheKey) + sql.size(); }
+
+	std::string sql;
+};
+
+struct PreparedQueryCacheVal {
+	size_t Size() const noexcept { return query ? query->Size() : 0; }
+
+	std::shared_ptr<const PreparedQuery> query;
+};
+
+struct HashPreparedQueryCacheKey {
+	size_t operator()(const PreparedQueryCacheKey &k) const noexcept { return std::hash<std::string_view>()(k.sql); }
+};
+struct EqPreparedQueryCacheKey {
+	bool operator()(const PreparedQueryCacheKey &lhs, const PreparedQueryCacheKey &rhs) const noexcept { return lhs.sql == rhs.sql; }
+};
+
+/// Parsed queries cache. Key is the sql text with placeholders, i.e. the query shape without the parameters values.
+/// Parsed query does not depend on the database, so the single cache is shared by the whole process
+/// (embedded databases, RPC and HTTP servers)
+class PreparedQueriesCache
+	: public LRUCache<PreparedQueryCacheKey, PreparedQueryCacheVal, HashPreparedQueryCacheKey, EqPreparedQueryCacheKey> {
+public:
+	constexpr static size_t kDefaultCacheSizeLimit = 16 * 1024 * 1024;
+	constexpr static uint32_t kDefaultHitCountToCache = 1;
+
+	PreparedQueriesCache() noexcept : LRUCache(kDefaultCacheSizeLimit, kDefaultHitCountToCache) {}
+
+	static PreparedQueriesCache &Instance();
+
+	/// Returns cached prepared query or parses the sql and puts the result into the cache
+	std::shared_ptr<const PreparedQuery> Prepare(std::string_view sql);
+};
+
+}  // namespace reindexer
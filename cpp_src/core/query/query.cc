@@ -321,6 +321,9 @@ void Query::deserialize(Serializer &ser, bool &hasJoinConditions) {
 			case QueryWithRank:
 				withRank_ = true;
 				break;
+			case QueryIndexOnly:
+				indexOnly_ = true;
+				break;
 			case QuerySelectFunction:
 				selectFunctions_.emplace_back(ser.GetVString());
 				break;
@@ -519,6 +522,10 @@ void Query::Serialize(WrSerializer &ser, uint8_t mode) const {
 		if (withRank_) {
 			ser.PutVarUint(QueryWithRank);
 		}
+
+		if (indexOnly_) {
+			ser.PutVarUint(QueryIndexOnly);
+		}
 	}
 
 	for (const auto &field : updateFields_) {
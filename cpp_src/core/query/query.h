@@ -799,6 +799,16 @@ public:
 	[[nodiscard]] Query &&WithRank() && noexcept { return std::move(WithRank()); }
 	[[nodiscard]] bool IsWithRank() const noexcept { return withRank_; }
 
+	/// Allow to build the results from the columns of the selected indexes ('is_column' option) without access to the documents.
+	/// Results contain the index value even for the documents without this field
+	/// @return Query object
+	Query &IndexOnly() & noexcept {
+		indexOnly_ = true;
+		return *this;
+	}
+	[[nodiscard]] Query &&IndexOnly() && noexcept { return std::move(IndexOnly()); }
+	[[nodiscard]] bool IsIndexOnly() const noexcept { return indexOnly_; }
+
 	/// Can we add aggregation functions
 	/// or new select fields to a current query?
 	[[nodiscard]] bool CanAddAggregation(AggType type) const noexcept { return type == AggDistinct || (selectFilter_.empty()); }
@@ -966,6 +976,7 @@ private:
 	std::vector<Query> subQueries_;
 	h_vector<std::string, 1> selectFilter_;	 /// List of columns in a final result set.
 	bool withRank_ = false;
+	bool indexOnly_ = false;
 	StrictMode strictMode_ = StrictModeNotSet;	/// Strict mode.
 	int debugLevel_ = 0;						/// Debug level.
 	bool explain_ = false;						/// Explain query if true
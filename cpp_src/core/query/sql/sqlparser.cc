@@ -21,6 +21,15 @@ Query SQLParser::Parse(std::string_view q) {
 	return query;
 }
 
+Query SQLParser::Parse(std::string_view q, std::vector<QueryParamPosition> &params) {
+	tokenizer parser(q);
+	Query query;
+	SQLParser sqlParser{query};
+	sqlParser.params_ = &params;
+	sqlParser.Parse(parser);
+	return query;
+}
+
 bool SQLParser::reachedAutocompleteToken(tokenizer &parser, const token &tok) const {
 	size_t pos = parser.getPos() + tok.text().length();
 	return pos > ctx_.suggestionsPos;
@@ -703,6 +712,25 @@ Query SQLParser::parseSubQuery(tokenizer &parser) {
 	return subquery;
 }
 
+template <typename T>
+bool SQLParser::isParamPlaceholder(const token &tok, tokenizer &parser) const {
+	if (tok.type != TokenSymbol || tok.text() != "?"sv) return false;
+	if (!params_) {
+		throw Error(errParseSQL, "Parameter placeholders are allowed in prepared queries only, %s", parser.where());
+	}
+	if constexpr (std::is_same_v<std::decay_t<T>, Query>) {
+		throw Error(errParseSQL, "Parameter placeholders are not allowed in conditions with subquery, %s", parser.where());
+	}
+	return true;
+}
+
+Variant SQLParser::paramPlaceholder(size_t valueIdx) {
+	// Where() appends the new entry to the end of the entries container
+	params_->emplace_back(QueryParamPosition{query_.Entries().Size(), valueIdx});
+	// String is the only type, which passes verification for any condition with values
+	return Variant{std::string{}};
+}
+
 template <typename T>
 void SQLParser::parseWhereCondition(tokenizer &parser, T &&firstArg, OpType op) {
 	// Operator
@@ -746,13 +774,15 @@ void SQLParser::parseWhereCondition(tokenizer &parser, T &&firstArg, OpType op)
 		for (;;) {
 			tok = parser.next_token();
 			if (tok.text() == ")"sv && tok.type == TokenSymbol) break;
-			values.push_back(token2kv(tok, parser, true));
+			values.push_back(isParamPlaceholder<T>(tok, parser) ? paramPlaceholder(values.size()) : token2kv(tok, parser, true));
 			tok = parser.next_token();
 			if (tok.text() == ")"sv) break;
 			if (tok.text() != ","sv)
 				throw Error(errParseSQL, "Expected ')' or ',', but found '%s' in query, %s", tok.text(), parser.where());
 		}
 		query_.NextOp(op).Where(std::forward<T>(firstArg), condition, std::move(values));
+	} else if (isParamPlaceholder<T>(tok, parser)) {
+		query_.NextOp(op).Where(std::forward<T>(firstArg), condition, {paramPlaceholder(0)});
 	} else if (tok.type != TokenName || iequals(tok.text(), "true"sv) || iequals(tok.text(), "false"sv)) {
 		query_.NextOp(op).Where(std::forward<T>(firstArg), condition, {token2kv(tok, parser, true)});
 	} else {
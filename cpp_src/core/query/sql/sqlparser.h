@@ -16,6 +16,12 @@ struct SortingEntries;
 class UpdateEntry;
 using EqualPosition_t = h_vector<std::string, 2>;
 
+/// Position of the '?' parameter placeholder in the parsed query: index of the entry and index of the value in this entry
+struct QueryParamPosition {
+	size_t entryIdx;
+	size_t valueIdx;
+};
+
 class SQLParser {
 	class ParserContextsAppendGuard;
 	enum class Nested : bool { Yes = true, No = false };
@@ -25,6 +31,11 @@ public:
 	/// @param q - sql query.
 	/// @return parsed query
 	[[nodiscard]] static Query Parse(std::string_view sql);
+	/// Parses sql query with '?' parameter placeholders in the where conditions of the main query.
+	/// @param q - sql query.
+	/// @param params - positions of the placeholders in the parsed query (in the order of appearance).
+	/// @return parsed query
+	[[nodiscard]] static Query Parse(std::string_view sql, std::vector<QueryParamPosition> &params);
 
 protected:
 	explicit SQLParser(Query &q) noexcept : query_(q) {}
@@ -92,6 +103,9 @@ protected:
 	int parseWhere(tokenizer &parser);
 	template <typename T>
 	void parseWhereCondition(tokenizer &, T &&firstArg, OpType);
+	template <typename T>
+	bool isParamPlaceholder(const token &, tokenizer &) const;
+	Variant paramPlaceholder(size_t valueIdx);
 
 	/// Parse order by
 	int parseOrderBy(tokenizer &parser, SortingEntries &sortingEntries, std::vector<Variant> &forcedSortOrder);
@@ -127,6 +141,7 @@ protected:
 	static CondType getCondType(std::string_view cond);
 	SqlParsingCtx ctx_;
 	Query &query_;
+	std::vector<QueryParamPosition> *params_ = nullptr;
 };
 
 }  // namespace reindexer
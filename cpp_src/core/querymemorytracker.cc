@@ -0,0 +1,46 @@
+#include "querymemorytracker.h"
+#include <algorithm>
+#include "tools/errors.h"
+
+namespace reindexer {
+
+void QueryMemoryTracker::Update(const void *owner, size_t bytes) {
+	std::lock_guard lck(mtx_);
+	auto it = std::find_if(accounts_.begin(), accounts_.end(), [owner](const Account &a) noexcept { return a.owner == owner; });
+	if (it == accounts_.end()) {
+		if (!bytes) return;
+		accounts_.emplace_back(Account{owner, 0});
+		it = accounts_.end() - 1;
+	}
+	if (bytes <= it->bytes) {
+		const size_t delta = it->bytes - bytes;
+		it->bytes = bytes;
+		used_ -= delta;
+		totalUsed_.fetch_sub(delta, std::memory_order_relaxed);
+		return;
+	}
+
+	const size_t delta = bytes - it->bytes;
+	it->bytes = bytes;
+	used_ += delta;
+	peak_ = std::max(peak_, used_);
+	const size_t total = totalUsed_.fetch_add(delta, std::memory_order_relaxed) + delta;
+	if (queryLimit_ && used_ > queryLimit_) {
+		throw Error(errQueryMemoryLimit, "Query memory limit exceeded: %d bytes are used, limit is %d bytes", used_, queryLimit_);
+	}
+	if (totalLimit_ && total > totalLimit_) {
+		throw Error(errQueryMemoryLimit, "Total queries memory limit exceeded: %d bytes are used by the running queries, limit is %d bytes",
+					total, totalLimit_);
+	}
+}
+
+void QueryMemoryTracker::Release(const void *owner) noexcept {
+	std::lock_guard lck(mtx_);
+	auto it = std::find_if(accounts_.begin(), accounts_.end(), [owner](const Account &a) noexcept { return a.owner == owner; });
+	if (it == accounts_.end()) return;
+	used_ -= it->bytes;
+	totalUsed_.fetch_sub(it->bytes, std::memory_order_relaxed);
+	accounts_.erase(it);
+}
+
+}  // namespace reindexer
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include "estl/h_vector.h"
+
+namespace reindexer {
+
+/// Accounts memory of the query's results and intermediate structures (item refs, joined items, aggregation facets, fulltext merge
+/// data). Usage is sampled by the select at the checkpoints, so the actual peak may slightly exceed the limit.
+class QueryMemoryTracker {
+public:
+	/// @param queryLimit - memory limit for the single query in bytes (0 - unlimited)
+	/// @param totalLimit - memory limit for all the concurrently executing queries in bytes (0 - unlimited)
+	/// @param totalUsed - memory used by all the concurrently executing queries
+	QueryMemoryTracker(size_t queryLimit, size_t totalLimit, std::atomic<size_t> &totalUsed) noexcept
+		: queryLimit_(queryLimit), totalLimit_(totalLimit), totalUsed_(totalUsed) {}
+	~QueryMemoryTracker() { totalUsed_.fetch_sub(used_, std::memory_order_relaxed); }
+	QueryMemoryTracker(const QueryMemoryTracker &) = delete;
+	QueryMemoryTracker &operator=(const QueryMemoryTracker &) = delete;
+
+	/// Sets current memory usage of the structure, identified by the owner's address
+	/// Throws errQueryMemoryLimit, if one of the limits is exceeded
+	void Update(const void *owner, size_t bytes);
+	/// Removes memory of the destroyed structure from the accounting
+	void Release(const void *owner) noexcept;
+	size_t Used() const noexcept {
+		std::lock_guard lck(mtx_);
+		return used_;
+	}
+	size_t Peak() const noexcept {
+		std::lock_guard lck(mtx_);
+		return peak_;
+	}
+
+	/// Releases accounted memory of the transient structure on the scope exit
+	class Scope {
+	public:
+		Scope(QueryMemoryTracker *tracker, const void *owner) noexcept : tracker_(tracker), owner_(owner) {}
+		~Scope() {
+			if (tracker_) tracker_->Release(owner_);
+		}
+		Scope(const Scope &) = delete;
+		Scope &operator=(const Scope &) = delete;
+
+		void Update(size_t bytes) {
+			if (tracker_) tracker_->Update(owner_, bytes);
+		}
+
+	private:
+		QueryMemoryTracker *tracker_;
+		const void *owner_;
+	};
+
+private:
+	struct Account {
+		const void *owner;
+		size_t bytes;
+	};
+
+	const size_t queryLimit_;
+	const size_t totalLimit_;
+	std::atomic<size_t> &totalUsed_;
+	mutable std::mutex mtx_;
+	h_vector<Account, 8> accounts_;
+	size_t used_ = 0;
+	size_t peak_ = 0;
+};
+
+}  // namespace reindexer
@@ -51,6 +51,12 @@ public:
 	/// all the joined fields
 	size_t TotalItems() const noexcept { return items_.size(); }
 
+	/// @returns approximate size of joined items and offsets in bytes
+	size_t MemoryUsage() const noexcept {
+		return items_.capacity() * sizeof(ItemRef) + offsets_.bucket_count() * sizeof(void*) +
+			   offsets_.size() * (sizeof(IdType) + sizeof(ItemOffsets) + sizeof(void*));
+	}
+
 private:
 	friend class ItemIterator;
 	friend class JoinedFieldIterator;
@@ -55,6 +55,29 @@ struct QueryResults::Context {
 static_assert(QueryResults::kSizeofContext >= sizeof(QueryResults::Context),
 			  "QueryResults::kSizeofContext should >= sizeof(QueryResults::Context)");
 
+void QueryResults::AppendChunk(QueryResults &&chunk) {
+	assertrx(ctxs.size() <= 1 && chunk.ctxs.size() <= 1);
+	if (chunk.ctxs.empty()) return;
+	if (ctxs.empty()) {
+		ctxs = std::move(chunk.ctxs);
+	} else {
+		// Items of the previous chunks can not be decoded with the new payload type
+		if (ctxs[0].type_.get() != chunk.ctxs[0].type_.get()) {
+			throw Error(errConflict, "Namespace '%s' structure was changed during the query execution. %d items were already processed",
+						ctxs[0].type_.Name(), items_.size());
+		}
+		// Tags matcher of the last chunk contains all the tags of the previous ones
+		ctxs[0].tagsMatcher_ = std::move(chunk.ctxs[0].tagsMatcher_);
+	}
+	for (auto &nsData : chunk.nsData_) {
+		if (!IsNamespaceAdded(nsData.ns)) {
+			nsData_.emplace_back(std::move(nsData));
+		}
+	}
+	items_.insert(items_.end(), chunk.items_.begin(), chunk.items_.end());
+	totalCount += chunk.totalCount;
+}
+
 QueryResults::QueryResults(std::initializer_list<ItemRef> l) : items_(l) {}
 QueryResults::QueryResults(int /*flags*/) {}
 QueryResults::QueryResults(QueryResults &&obj) noexcept
@@ -69,9 +92,11 @@ QueryResults::QueryResults(QueryResults &&obj) noexcept
 	  items_(std::move(obj.items_)),
 	  activityCtx_(std::move(obj.activityCtx_)),
 	  isWalQuery_(obj.isWalQuery_),
+	  releasedItems_(obj.releasedItems_),
 	  nsData_(std::move(obj.nsData_)),
 	  stringsHolder_(std::move(obj.stringsHolder_)) {
 	obj.isWalQuery_ = false;
+	obj.releasedItems_ = 0;
 }
 
 QueryResults::QueryResults(const ItemRefVector::const_iterator &begin, const ItemRefVector::const_iterator &end) : items_(begin, end) {}
@@ -97,6 +122,8 @@ QueryResults &QueryResults::operator=(QueryResults &&obj) noexcept {
 		}
 		isWalQuery_ = obj.isWalQuery_;
 		obj.isWalQuery_ = false;
+		releasedItems_ = obj.releasedItems_;
+		obj.releasedItems_ = 0;
 	}
 	return *this;
 }
@@ -109,6 +136,16 @@ void QueryResults::Erase(ItemRefVector::iterator start, ItemRefVector::iterator
 
 void QueryResults::Add(const ItemRef &i) { items_.push_back(i); }
 
+void QueryResults::ReleaseItems(size_t count) noexcept {
+	count = std::min(count, size_t(items_.size()));
+	for (size_t i = releasedItems_; i < count; ++i) {
+		if (items_[i].ValueInitialized()) {
+			items_[i].Value() = PayloadValue();
+		}
+	}
+	releasedItems_ = std::max(releasedItems_, count);
+}
+
 std::string QueryResults::Dump() const {
 	std::string buf;
 	for (size_t i = 0; i < items_.size(); ++i) {
@@ -52,6 +52,12 @@ public:
 	void AddItem(Item &item, bool withData = false, bool enableHold = true);
 	std::string Dump() const;
 	void Erase(ItemRefVector::iterator begin, ItemRefVector::iterator end);
+	// Drops references to the payloads of the first 'count' items, so namespace is able to free them after update/delete.
+	// Released items can not be read anymore, but items count and positions remain unchanged
+	void ReleaseItems(size_t count) noexcept;
+	// Appends items of the next chunk of the UPDATE/DELETE query, executed in chunks. Both results must be from the same namespace
+	void AppendChunk(QueryResults &&chunk);
+	size_t ReleasedItemsCount() const noexcept { return releasedItems_; }
 	size_t Count() const noexcept { return items_.size(); }
 	size_t TotalCount() const noexcept { return totalCount; }
 	const std::string &GetExplainResults() const & noexcept { return explainResults; }
@@ -182,6 +188,7 @@ public:
 	};
 
 	bool isWalQuery_ = false;
+	size_t releasedItems_ = 0;
 	h_vector<NsDataHolder, 1> nsData_;
 	std::vector<key_string> stringsHolder_;
 };
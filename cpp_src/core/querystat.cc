@@ -7,11 +7,12 @@
 namespace reindexer {
 
 template <void (PerfStatCounterST::*hitFunc)(std::chrono::microseconds)>
-void QueriesStatTracer::hit(const QuerySQL &sql, std::chrono::microseconds time) {
+void QueriesStatTracer::hit(const QuerySQL &sql, std::chrono::microseconds time, size_t peakMemory) {
 	std::unique_lock<std::mutex> lck(mtx_);
-	const auto it = stat_.find(sql.normalized);
+	auto it = stat_.find(sql.normalized);
 	if (it == stat_.end()) {
-		(stat_.emplace(std::string(sql.normalized), Stat(sql.nonNormalized)).first->second.*hitFunc)(time);
+		it = stat_.emplace(std::string(sql.normalized), Stat(sql.nonNormalized)).first;
+		(it->second.*hitFunc)(time);
 	} else {
 		const auto maxTime = it->second.MaxTime();
 		(it->second.*hitFunc)(time);
@@ -19,16 +20,23 @@ void QueriesStatTracer::hit(const QuerySQL &sql, std::chrono::microseconds time)
 			it->second.longestQuery = std::string(sql.nonNormalized);
 		}
 	}
+	if constexpr (hitFunc == &PerfStatCounterST::Hit) {
+		it->second.HitPeakMemory(peakMemory);
+	}
 }
-template void QueriesStatTracer::hit<&PerfStatCounterST::Hit>(const QuerySQL &, std::chrono::microseconds);
-template void QueriesStatTracer::hit<&PerfStatCounterST::LockHit>(const QuerySQL &, std::chrono::microseconds);
+template void QueriesStatTracer::hit<&PerfStatCounterST::Hit>(const QuerySQL &, std::chrono::microseconds, size_t);
+template void QueriesStatTracer::hit<&PerfStatCounterST::LockHit>(const QuerySQL &, std::chrono::microseconds, size_t);
 
 const std::vector<QueryPerfStat> QueriesStatTracer::Data() {
 	std::unique_lock<std::mutex> lck(mtx_);
 
 	std::vector<QueryPerfStat> ret;
 	ret.reserve(stat_.size());
-	for (auto &stat : stat_) ret.push_back({stat.first, stat.second.Get<PerfStat>(), stat.second.longestQuery});
+	for (auto &stat : stat_) {
+		auto &s = stat.second;
+		ret.push_back({stat.first, s.Get<PerfStat>(), s.longestQuery, s.maxPeakMemory,
+					   s.peakMemoryHits ? s.totalPeakMemory / s.peakMemoryHits : 0});
+	}
 	return ret;
 }
 
@@ -46,6 +54,8 @@ void QueryPerfStat::GetJSON(WrSerializer &ser) const {
 	builder.Put("min_latency_us", perf.minTimeUs);
 	builder.Put("max_latency_us", perf.maxTimeUs);
 	builder.Put("longest_query", longestQuery);
+	builder.Put("max_peak_memory_bytes", maxPeakMemory);
+	builder.Put("avg_peak_memory_bytes", avgPeakMemory);
 }
 
 }  // namespace reindexer
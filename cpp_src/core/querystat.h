@@ -17,6 +17,8 @@ struct QueryPerfStat {
 	std::string query;
 	PerfStat perf;
 	std::string longestQuery;
+	size_t maxPeakMemory = 0;
+	size_t avgPeakMemory = 0;
 };
 
 class QueriesStatTracer {
@@ -26,8 +28,10 @@ public:
 		std::string_view nonNormalized;
 	};
 
-	void Hit(const QuerySQL& sql, std::chrono::microseconds time) { hit<&PerfStatCounterST::Hit>(sql, time); }
-	void LockHit(const QuerySQL& sql, std::chrono::microseconds time) { hit<&PerfStatCounterST::LockHit>(sql, time); }
+	void Hit(const QuerySQL& sql, std::chrono::microseconds time, size_t peakMemory = 0) {
+		hit<&PerfStatCounterST::Hit>(sql, time, peakMemory);
+	}
+	void LockHit(const QuerySQL& sql, std::chrono::microseconds time) { hit<&PerfStatCounterST::LockHit>(sql, time, 0); }
 	const std::vector<QueryPerfStat> Data();
 	void Reset() {
 		std::unique_lock<std::mutex> lck(mtx_);
@@ -37,17 +41,25 @@ public:
 protected:
 	struct Stat : public PerfStatCounterST {
 		Stat(std::string_view q) : longestQuery(q) {}
+		void HitPeakMemory(size_t peakMemory) noexcept {
+			maxPeakMemory = std::max(maxPeakMemory, peakMemory);
+			totalPeakMemory += peakMemory;
+			++peakMemoryHits;
+		}
 		std::string longestQuery;
+		size_t maxPeakMemory = 0;
+		size_t totalPeakMemory = 0;
+		size_t peakMemoryHits = 0;
 	};
 
 	template <void (PerfStatCounterST::*hitFunc)(std::chrono::microseconds)>
-	void hit(const QuerySQL&, std::chrono::microseconds);
+	void hit(const QuerySQL&, std::chrono::microseconds, size_t peakMemory);
 
 	std::mutex mtx_;
 	fast_hash_map<std::string, Stat, hash_str, equal_str, less_str> stat_;
 };
-extern template void QueriesStatTracer::hit<&PerfStatCounterST::Hit>(const QuerySQL&, std::chrono::microseconds);
-extern template void QueriesStatTracer::hit<&PerfStatCounterST::LockHit>(const QuerySQL&, std::chrono::microseconds);
+extern template void QueriesStatTracer::hit<&PerfStatCounterST::Hit>(const QuerySQL&, std::chrono::microseconds, size_t);
+extern template void QueriesStatTracer::hit<&PerfStatCounterST::LockHit>(const QuerySQL&, std::chrono::microseconds, size_t);
 
 template <typename T = void, template <typename> class Logger = long_actions::Logger>
 class QueryStatCalculator {
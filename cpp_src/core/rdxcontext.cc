@@ -9,7 +9,8 @@ RdxContext::RdxContext(RdxContext&& other) noexcept
 	  holdStatus_(other.holdStatus_),
 	  activityPtr_(nullptr),
 	  cancelCtx_(other.cancelCtx_),
-	  cmpl_(other.cmpl_) {
+	  cmpl_(other.cmpl_),
+	  memoryTracker_(other.memoryTracker_) {
 	if (holdStatus_ == kHold) {
 		new (&activityCtx_) RdxActivityContext(std::move(other.activityCtx_));
 		other.activityCtx_.~RdxActivityContext();
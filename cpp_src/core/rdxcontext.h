@@ -9,6 +9,8 @@ namespace reindexer {
 
 using std::chrono::milliseconds;
 
+class QueryMemoryTracker;
+
 enum class CancelType : uint8_t { None = 0, Explicit, Timeout };
 
 struct IRdxCancelContext {
@@ -113,6 +115,9 @@ public:
 	RdxContext OnlyActivity() const { return RdxContext{Activity()}; }
 	RdxActivityContext* Activity() const noexcept;
 	Completion Compl() const { return cmpl_; }
+	/// Memory tracker of the select query (may be null)
+	QueryMemoryTracker* MemoryTracker() const noexcept { return memoryTracker_; }
+	void SetMemoryTracker(QueryMemoryTracker* tracker) noexcept { memoryTracker_ = tracker; }
 
 	const bool fromReplication_;
 	LSNPair LSNs_;
@@ -125,6 +130,7 @@ private:
 	};
 	const IRdxCancelContext* cancelCtx_;
 	Completion cmpl_;
+	QueryMemoryTracker* memoryTracker_ = nullptr;
 };
 
 class QueryResults;
@@ -59,6 +59,9 @@ Error Reindexer::DeleteMeta(std::string_view nsName, const std::string& key) {
 }
 Error Reindexer::Delete(const Query& q, QueryResults& result) { return impl_->Delete(q, result, ctx_); }
 Error Reindexer::Select(std::string_view query, QueryResults& result) { return impl_->Select(query, result, ctx_); }
+Error Reindexer::Select(std::string_view query, const VariantArray& params, QueryResults& result) {
+	return impl_->Select(query, params, result, ctx_);
+}
 Error Reindexer::Select(const Query& q, QueryResults& result) { return impl_->Select(q, result, ctx_); }
 Error Reindexer::Update(const Query& query, QueryResults& result) { return impl_->Update(query, result, ctx_); }
 Error Reindexer::Commit(std::string_view nsName) { return impl_->Commit(nsName); }
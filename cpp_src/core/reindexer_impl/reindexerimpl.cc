@@ -11,6 +11,8 @@
 #include "core/itemimpl.h"
 #include "core/nsselecter/nsselecter.h"
 #include "core/nsselecter/querypreprocessor.h"
+#include "core/query/preparedquery.h"
+#include "core/querymemorytracker.h"
 #include "core/query/sql/sqlsuggester.h"
 #include "core/queryresults/joinresults.h"
 #include "core/selectfunc/selectfunc.h"
@@ -98,6 +100,7 @@ ReindexerImpl::StatsLocker::StatsLocker() {
 	// kQueriesPerfStatsNamespace - lock is not required
 	// kActivityStatsNamespace - lock is not required
 	// kClientsStatsNamespace - lock is not required
+	// kSchedulerStatsNamespace - lock is not required
 }
 
 ReindexerImpl::StatsLocker::StatsLockT ReindexerImpl::StatsLocker::LockIfRequired(std::string_view sysNsName, const RdxContext& ctx) {
@@ -242,42 +245,38 @@ Error ReindexerImpl::Connect(const std::string& dsn, ConnectOpts opts) {
 			return ld.internalFilesCount > rd.internalFilesCount;
 		});
 		const size_t maxLoadWorkers = ConcurrentNamespaceLoaders();
-		std::unique_ptr<std::thread[]> thrs(new std::thread[maxLoadWorkers]);
 		std::atomic_flag hasNsErrors = ATOMIC_FLAG_INIT;
 		std::atomic<unsigned> nsIdx = {0};
-		for (size_t i = 0; i < maxLoadWorkers; i++) {
-			thrs[i] = std::thread([&] {
-				for (unsigned idx = nsIdx.fetch_add(1, std::memory_order_relaxed); idx < foundNs.size();
-					 idx = nsIdx.fetch_add(1, std::memory_order_relaxed)) {
-					auto& de = foundNs[idx];
-					if (de.isDir && validateObjectName(de.name, true)) {
-						if (de.name[0] == kTmpNsPrefix) {
-							const std::string tmpPath = fs::JoinPath(storagePath_, de.name);
-							logPrintf(LogWarning, "Dropping tmp namespace '%s'", de.name);
-							if (fs::RmDirAll(tmpPath) < 0) {
-								logPrintf(LogWarning, "Failed to remove '%s' temporary namespace from filesystem, path: %s", de.name,
-										  tmpPath);
-								hasNsErrors.test_and_set(std::memory_order_relaxed);
-							}
-							continue;
-						}
-						const RdxContext dummyCtx;
-						auto status = openNamespace(de.name, StorageOpts().Enabled(), dummyCtx);
-						if (status.ok()) {
-							if (getNamespace(de.name, dummyCtx)->IsTemporary(dummyCtx)) {
-								logPrintf(LogWarning, "Dropping tmp namespace '%s'", de.name);
-								status = closeNamespace(de.name, dummyCtx, true, true);
-							}
-						}
-						if (!status.ok()) {
-							logPrintf(LogError, "Failed to open namespace '%s' - %s", de.name, status.what());
+		TaskScheduler::Instance().ParallelFor(TaskScheduler::Priority::Foreground, maxLoadWorkers, [&](size_t) {
+			for (unsigned idx = nsIdx.fetch_add(1, std::memory_order_relaxed); idx < foundNs.size();
+				 idx = nsIdx.fetch_add(1, std::memory_order_relaxed)) {
+				auto& de = foundNs[idx];
+				if (de.isDir && validateObjectName(de.name, true)) {
+					if (de.name[0] == kTmpNsPrefix) {
+						const std::string tmpPath = fs::JoinPath(storagePath_, de.name);
+						logPrintf(LogWarning, "Dropping tmp namespace '%s'", de.name);
+						if (fs::RmDirAll(tmpPath) < 0) {
+							logPrintf(LogWarning, "Failed to remove '%s' temporary namespace from filesystem, path: %s", de.name,
+									  tmpPath);
 							hasNsErrors.test_and_set(std::memory_order_relaxed);
 						}
+						continue;
+					}
+					const RdxContext dummyCtx;
+					auto status = openNamespace(de.name, StorageOpts().Enabled(), dummyCtx);
+					if (status.ok()) {
+						if (getNamespace(de.name, dummyCtx)->IsTemporary(dummyCtx)) {
+							logPrintf(LogWarning, "Dropping tmp namespace '%s'", de.name);
+							status = closeNamespace(de.name, dummyCtx, true, true);
+						}
+					}
+					if (!status.ok()) {
+						logPrintf(LogError, "Failed to open namespace '%s' - %s", de.name, status.what());
+						hasNsErrors.test_and_set(std::memory_order_relaxed);
 					}
 				}
-			});
-		}
-		for (size_t i = 0; i < maxLoadWorkers; ++i) thrs[i].join();
+			}
+		});
 
 		if (!opts.IsAllowNamespaceErrors() && hasNsErrors.test_and_set(std::memory_order_relaxed)) {
 			return Error(errNotValid, "Namespaces load error");
@@ -827,23 +826,7 @@ Error ReindexerImpl::Delete(const Query& q, QueryResults& result, const Internal
 Error ReindexerImpl::Select(std::string_view query, QueryResults& result, const InternalRdxContext& ctx) {
 	Error err;
 	try {
-		Query q = Query::FromSQL(query);
-		switch (q.type_) {
-			case QuerySelect:
-				err = Select(q, result, ctx);
-				break;
-			case QueryDelete:
-				err = Delete(q, result, ctx);
-				break;
-			case QueryUpdate:
-				err = Update(q, result, ctx);
-				break;
-			case QueryTruncate:
-				err = TruncateNamespace(q.NsName(), ctx);
-				break;
-			default:
-				err = Error(errParams, "Error unsupported query type %d", q.type_);
-		}
+		err = execQuery(Query::FromSQL(query), result, ctx);
 	} catch (const Error& e) {
 		err = e;
 	}
@@ -852,11 +835,40 @@ Error ReindexerImpl::Select(std::string_view query, QueryResults& result, const
 	return err;
 }
 
+Error ReindexerImpl::Select(std::string_view query, const VariantArray& params, QueryResults& result, const InternalRdxContext& ctx) {
+	Error err;
+	try {
+		err = execQuery(PreparedQueriesCache::Instance().Prepare(query)->Bind(params), result, ctx);
+	} catch (const Error& e) {
+		err = e;
+	}
+
+	if (ctx.Compl()) ctx.Compl()(err);
+	return err;
+}
+
+Error ReindexerImpl::execQuery(const Query& q, QueryResults& result, const InternalRdxContext& ctx) {
+	switch (q.type_) {
+		case QuerySelect:
+			return Select(q, result, ctx);
+		case QueryDelete:
+			return Delete(q, result, ctx);
+		case QueryUpdate:
+			return Update(q, result, ctx);
+		case QueryTruncate:
+			return TruncateNamespace(q.NsName(), ctx);
+		default:
+			return Error(errParams, "Error unsupported query type %d", q.type_);
+	}
+}
+
 Error ReindexerImpl::Select(const Query& q, QueryResults& result, const InternalRdxContext& ctx) {
 	try {
 		WrSerializer normalizedSQL, nonNormalizedSQL;
 		if (ctx.NeedTraceActivity()) q.GetSQL(nonNormalizedSQL, false);
-		const auto rdxCtx = ctx.CreateRdxContext(ctx.NeedTraceActivity() ? nonNormalizedSQL.Slice() : "", activities_, result);
+		QueryMemoryTracker memoryTracker(configProvider_.QueryMemoryLimit(), configProvider_.TotalQueriesMemoryLimit(), queriesMemoryUsed_);
+		auto rdxCtx = ctx.CreateRdxContext(ctx.NeedTraceActivity() ? nonNormalizedSQL.Slice() : "", activities_, result);
+		rdxCtx.SetMemoryTracker(&memoryTracker);
 		RxSelector::NsLocker<const RdxContext> locks(rdxCtx);
 
 		auto mainNsWrp = getNamespace(q.NsName(), rdxCtx);
@@ -873,11 +885,11 @@ Error ReindexerImpl::Select(const Query& q, QueryResults& result, const Internal
 		const QueriesStatTracer::QuerySQL sql{normalizedSQL.Slice(), nonNormalizedSQL.Slice()};
 
 		auto hitter = queriesPerfStatsEnabled
-		? [&sql, &tracker](bool lockHit, std::chrono::microseconds time) {
+		? [&sql, &tracker, &memoryTracker](bool lockHit, std::chrono::microseconds time) {
 			if (lockHit)
 				tracker.LockHit(sql, time);
 			else
-				tracker.Hit(sql, time);
+				tracker.Hit(sql, time, memoryTracker.Peak());
 		}
 		: std::function<void(bool, std::chrono::microseconds)>{};
 
@@ -1054,13 +1066,19 @@ Error ReindexerImpl::EnumNamespaces(std::vector<NamespaceDef>& defs, EnumNamespa
 
 void ReindexerImpl::backgroundRoutine(net::ev::dynamic_loop& loop) {
 	static const RdxContext dummyCtx;
-	auto nsBackground = [&]() {
+	// Namespaces' routines are executed by the shared task scheduler, so the large namespaces do not delay the others.
+	// Last call (on shutdown) is synchronous
+	auto nsBackground = [&](bool sync) {
 		bgDeleter_.DeleteUnique();
 		auto nsarray = getNamespacesNames(dummyCtx);
 		for (const auto& name : nsarray) {
 			try {
 				auto ns = getNamespace(name, dummyCtx);
-				ns->BackgroundRoutine(nullptr);
+				if (sync) {
+					ns->BackgroundRoutine(nullptr);
+				} else {
+					ns->ScheduleBackgroundRoutines(bgTasks_, dbDestroyed_);
+				}
 			} catch (Error err) {
 				logPrintf(LogWarning, "backgroundRoutine() failed: %s", err.what());
 			} catch (...) {
@@ -1083,7 +1101,7 @@ void ReindexerImpl::backgroundRoutine(net::ev::dynamic_loop& loop) {
 	t.set(loop);
 	t.set([&nsBackground](net::ev::timer&, int) noexcept {
 		try {
-			nsBackground();
+			nsBackground(false);
 		} catch (Error err) {
 			logPrintf(LogError, "Unexpected exception in background thread: %s", err.what());
 		} catch (std::exception& e) {
@@ -1097,7 +1115,8 @@ void ReindexerImpl::backgroundRoutine(net::ev::dynamic_loop& loop) {
 	while (!dbDestroyed_.load(std::memory_order_relaxed)) {
 		loop.run();
 	}
-	nsBackground();
+	bgTasks_.Wait();
+	nsBackground(true);
 }
 
 void ReindexerImpl::storageFlushingRoutine(net::ev::dynamic_loop& loop) {
@@ -1488,6 +1507,23 @@ ReindexerImpl::FilterNsNamesT ReindexerImpl::detectFilterNsNames(const Query& q)
 			if (!err.ok()) throw err;
 		}
 		activityNs->Refill(items, ctx);
+	} else if (sysNsName == kSchedulerStatsNamespace) {
+		// Task scheduler is shared by all the namespaces and databases of the process, so its stats are reported once
+		WrSerializer ser;
+		{
+			JsonBuilder jb(ser);
+			jb.Put(kNsNameField, "task_scheduler");
+			TaskScheduler::Instance().GetStats().GetJSON(jb);
+		}
+		auto schedulerNs = getNamespace(kSchedulerStatsNamespace, ctx);
+		std::vector<Item> items;
+		auto& item = items.emplace_back(schedulerNs->NewItem(ctx));
+		if (!item.Status().ok()) {
+			throw item.Status();
+		}
+		auto err = item.FromJSON(ser.Slice());
+		if (!err.ok()) throw err;
+		schedulerNs->Refill(items, ctx);
 	} else if (sysNsName == kClientsStatsNamespace) {
 		if (clientsStats_) {
 			std::vector<ClientStat> clientInf;
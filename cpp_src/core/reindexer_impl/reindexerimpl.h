@@ -66,6 +66,8 @@ public:
 	Error Delete(std::string_view nsName, Item &item, QueryResults &, const InternalRdxContext &ctx = InternalRdxContext());
 	Error Delete(const Query &query, QueryResults &result, const InternalRdxContext &ctx = InternalRdxContext());
 	Error Select(std::string_view query, QueryResults &result, const InternalRdxContext &ctx = InternalRdxContext());
+	Error Select(std::string_view query, const VariantArray &params, QueryResults &result,
+				 const InternalRdxContext &ctx = InternalRdxContext());
 	Error Select(const Query &query, QueryResults &result, const InternalRdxContext &ctx = InternalRdxContext());
 	Error Commit(std::string_view nsName);
 	Item NewItem(std::string_view nsName, const InternalRdxContext &ctx = InternalRdxContext());
@@ -137,6 +139,7 @@ private:
 		std::unordered_map<std::string_view, StatsSelectMutex, nocase_hash_str, nocase_equal_str> mtxMap_;
 	};
 
+	Error execQuery(const Query &q, QueryResults &result, const InternalRdxContext &ctx);
 	FilterNsNamesT detectFilterNsNames(const Query &q);
 	[[nodiscard]] StatsLocker::StatsLockT syncSystemNamespaces(std::string_view sysNsName, const FilterNsNamesT &, const RdxContext &);
 	void createSystemNamespaces();
@@ -175,8 +178,11 @@ private:
 	BackgroundThread storageFlushingThread_;
 	std::atomic<bool> dbDestroyed_ = {false};
 	BackgroundNamespaceDeleter bgDeleter_;
+	TaskScheduler::Group bgTasks_;
 
 	QueriesStatTracer queriesStatTracker_;
+	// Memory, used by the currently executing selects
+	std::atomic<size_t> queriesMemoryUsed_ = {0};
 	UpdatesObservers observers_;
 	std::unique_ptr<Replicator> replicator_;
 	DBConfigProvider configProvider_;
@@ -0,0 +1,201 @@
+#include "taskscheduler.h"
+#include <algorithm>
+#include "core/cjson/jsonbuilder.h"
+#include "core/type_consts.h"
+#include "tools/assertrx.h"
+#include "tools/logger.h"
+
+namespace reindexer {
+
+constexpr size_t kMinSchedulerThreads = 4;
+constexpr size_t kMaxDefaultSchedulerThreads = 16;
+
+constexpr std::string_view kPrioritiesNames[TaskScheduler::kPrioritiesCount] = {"foreground", "index_optimization", "ft_rebuild", "gc"};
+
+void TaskScheduler::Stats::GetJSON(JsonBuilder &builder) const {
+	builder.Put("threads_count", threadsCount);
+	builder.Put("busy_threads", busyThreads);
+	auto arr = builder.Array("priorities");
+	for (unsigned i = 0; i < kPrioritiesCount; ++i) {
+		auto obj = arr.Object();
+		obj.Put("priority", kPrioritiesNames[i]);
+		obj.Put("queued", priorities[i].queued);
+		obj.Put("total_tasks", priorities[i].totalTasks);
+		obj.Put("avg_queue_wait_us", priorities[i].avgQueueWaitUs);
+		obj.Put("max_queue_wait_us", priorities[i].maxQueueWaitUs);
+	}
+}
+
+void TaskScheduler::Group::Wait() {
+	std::unique_lock lck(mtx_);
+	cv_.wait(lck, [this] { return pending_.load(std::memory_order_acquire) == 0; });
+}
+
+void TaskScheduler::Group::done() {
+	std::lock_guard lck(mtx_);
+	if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+		cv_.notify_all();
+	}
+}
+
+void TaskScheduler::parallelState::Run() noexcept {
+	for (size_t i = next.fetch_add(1, std::memory_order_relaxed); i < count; i = next.fetch_add(1, std::memory_order_relaxed)) {
+		try {
+			// Skip the rest of the work after the first error
+			if (!failed.load(std::memory_order_relaxed)) {
+				(*func)(i);
+			}
+		} catch (...) {
+			std::lock_guard lck(mtx);
+			if (!ex) ex = std::current_exception();
+			failed.store(true, std::memory_order_relaxed);
+		}
+		if (done.fetch_add(1, std::memory_order_acq_rel) + 1 == count) {
+			std::lock_guard lck(mtx);
+			cv.notify_all();
+		}
+	}
+}
+
+void TaskScheduler::parallelState::Wait() {
+	std::unique_lock lck(mtx);
+	cv.wait(lck, [this] { return done.load(std::memory_order_acquire) == count; });
+	if (ex) {
+		std::rethrow_exception(ex);
+	}
+}
+
+TaskScheduler::TaskScheduler(size_t threadsCount) : threadsCount_(std::max(threadsCount, size_t(1))) {}
+
+TaskScheduler::~TaskScheduler() {
+	std::unique_lock lck(mtx_);
+	stopWorkers(lck);
+}
+
+TaskScheduler &TaskScheduler::Instance() {
+	static TaskScheduler scheduler;
+	return scheduler;
+}
+
+size_t TaskScheduler::DefaultThreadsCount() noexcept {
+	return std::clamp(size_t(std::thread::hardware_concurrency() / 2), kMinSchedulerThreads, kMaxDefaultSchedulerThreads);
+}
+
+bool TaskScheduler::Configure(size_t threadsCount) {
+	auto &scheduler = Instance();
+	threadsCount = std::max(threadsCount, size_t(1));
+	std::lock_guard lck(scheduler.mtx_);
+	if (!scheduler.workers_.empty()) {
+		logPrintf(LogWarning, "Task scheduler is already running with %d threads. Unable to set %d threads", scheduler.threadsCount_,
+				  threadsCount);
+		return false;
+	}
+	logPrintf(LogInfo, "Task scheduler threads count: %d", threadsCount);
+	scheduler.threadsCount_ = threadsCount;
+	return true;
+}
+
+void TaskScheduler::SetThreadsCount(size_t threadsCount) {
+	threadsCount = std::max(threadsCount, size_t(1));
+	std::unique_lock lck(mtx_);
+	if (threadsCount_ == threadsCount) {
+		return;
+	}
+	logPrintf(LogInfo, "Task scheduler threads count: %d->%d", threadsCount_, threadsCount);
+	threadsCount_ = threadsCount;
+	if (!workers_.empty()) {
+		stopWorkers(lck);
+		// Workers may be already restarted by the concurrent Schedule() call
+		if (workers_.empty()) {
+			startWorkers();
+		}
+	}
+}
+
+size_t TaskScheduler::ThreadsCount() const {
+	std::lock_guard lck(mtx_);
+	return threadsCount_;
+}
+
+void TaskScheduler::Schedule(Priority priority, std::function<void()> task, Group *group) {
+	const auto prio = static_cast<unsigned>(priority);
+	assertrx(prio < kPrioritiesCount);
+	std::lock_guard lck(mtx_);
+	if (workers_.empty()) {
+		startWorkers();
+	}
+	queues_[prio].emplace_back(TaskScheduler::task{std::move(task), group, steady_clock_w::now()});
+	if (group) group->add();
+	cv_.notify_one();
+}
+
+TaskScheduler::Stats TaskScheduler::GetStats() const {
+	Stats stats;
+	std::lock_guard lck(mtx_);
+	stats.threadsCount = threadsCount_;
+	stats.busyThreads = busyThreads_;
+	for (unsigned i = 0; i < kPrioritiesCount; ++i) {
+		auto &st = stats.priorities[i];
+		st.queued = queues_[i].size();
+		st.totalTasks = counters_[i].totalTasks;
+		st.avgQueueWaitUs = counters_[i].totalQueueWaitUs / (counters_[i].totalTasks ? counters_[i].totalTasks : 1);
+		st.maxQueueWaitUs = counters_[i].maxQueueWaitUs;
+	}
+	return stats;
+}
+
+void TaskScheduler::workerRoutine(uint64_t generation) {
+	std::unique_lock lck(mtx_);
+	while (true) {
+		if (generation != generation_) {
+			return;
+		}
+		auto queue = std::find_if(queues_.begin(), queues_.end(), [](const std::deque<task> &q) noexcept { return !q.empty(); });
+		if (queue == queues_.end()) {
+			cv_.wait(lck);
+			continue;
+		}
+		task t = std::move(queue->front());
+		queue->pop_front();
+		auto &counters = counters_[queue - queues_.begin()];
+		const size_t queueWaitUs =
+			std::chrono::duration_cast<std::chrono::microseconds>(steady_clock_w::now() - t.queuedAt).count();
+		++counters.totalTasks;
+		counters.totalQueueWaitUs += queueWaitUs;
+		counters.maxQueueWaitUs = std::max(counters.maxQueueWaitUs, queueWaitUs);
+		++busyThreads_;
+		lck.unlock();
+		try {
+			t.func();
+		} catch (std::exception &e) {
+			logPrintf(LogError, "Unexpected exception in the scheduled task: %s", e.what());
+		} catch (...) {
+			logPrintf(LogError, "Unexpected exception in the scheduled task: ???");
+		}
+		t.func = nullptr;
+		if (t.group) t.group->done();
+		lck.lock();
+		--busyThreads_;
+	}
+}
+
+void TaskScheduler::startWorkers() {
+	workers_.reserve(threadsCount_);
+	for (size_t i = 0; i < threadsCount_; ++i) {
+		workers_.emplace_back([this, generation = generation_] { workerRoutine(generation); });
+	}
+}
+
+void TaskScheduler::stopWorkers(std::unique_lock<std::mutex> &lck) {
+	++generation_;
+	cv_.notify_all();
+	auto workers = std::move(workers_);
+	workers_.clear();
+	lck.unlock();
+	for (auto &w : workers) {
+		w.join();
+	}
+	lck.lock();
+}
+
+}  // namespace reindexer
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "tools/clock.h"
+
+namespace reindexer {
+
+class JsonBuilder;
+
+// Shared pool of the worker threads for the background and auxiliary tasks (index optimization, fulltext build, GC, etc).
+// Tasks are executed in the order of their priorities and FIFO within the single priority.
+class TaskScheduler {
+public:
+	// Lower value - higher priority
+	enum class Priority : unsigned { Foreground = 0, IndexOptimization = 1, FtRebuild = 2, GC = 3 };
+	constexpr static unsigned kPrioritiesCount = 4;
+
+	struct PriorityStats {
+		size_t queued = 0;
+		size_t totalTasks = 0;
+		// Time from the task's scheduling till the start of its execution
+		size_t avgQueueWaitUs = 0;
+		size_t maxQueueWaitUs = 0;
+	};
+	struct Stats {
+		void GetJSON(JsonBuilder &builder) const;
+
+		size_t threadsCount = 0;
+		size_t busyThreads = 0;
+		std::array<PriorityStats, kPrioritiesCount> priorities;
+	};
+
+	// Tracks completion of the group of tasks
+	class Group {
+	public:
+		void Wait();
+		size_t Pending() const noexcept { return pending_.load(std::memory_order_acquire); }
+
+	private:
+		friend class TaskScheduler;
+		void add() noexcept { pending_.fetch_add(1, std::memory_order_acq_rel); }
+		void done();
+
+		std::atomic<size_t> pending_ = {0};
+		std::mutex mtx_;
+		std::condition_variable cv_;
+	};
+
+	TaskScheduler(size_t threadsCount = DefaultThreadsCount());
+	~TaskScheduler();
+	TaskScheduler(const TaskScheduler &) = delete;
+	TaskScheduler &operator=(const TaskScheduler &) = delete;
+
+	// Process-wide scheduler instance, shared by all the databases
+	static TaskScheduler &Instance();
+	static size_t DefaultThreadsCount() noexcept;
+	// Sets threads count of the process-wide instance. Has to be called on the process startup (e.g. by the server), before the first
+	// task is scheduled. Returns false, if the instance is already running
+	static bool Configure(size_t threadsCount);
+
+	// Restarts the workers, so it waits for the running tasks. Must not be called from the scheduler's tasks
+	void SetThreadsCount(size_t threadsCount);
+	size_t ThreadsCount() const;
+	void Schedule(Priority priority, std::function<void()> task, Group *group = nullptr);
+	// Executes f(0)...f(count - 1) in parallel and waits for the completion. Calling thread takes part in the execution, so this method
+	// never waits for the free workers and may be called from the scheduler's tasks. First exception is rethrown to the caller
+	template <typename F>
+	void ParallelFor(Priority priority, size_t count, F &&f) {
+		if (count <= 1) {
+			if (count) f(size_t(0));
+			return;
+		}
+		auto state = std::make_shared<parallelState>(count);
+		const std::function<void(size_t)> func = std::forward<F>(f);
+		state->func = &func;
+		for (size_t i = 1; i < count; ++i) {
+			Schedule(priority, [state] { state->Run(); });
+		}
+		state->Run();
+		state->Wait();
+	}
+	Stats GetStats() const;
+
+private:
+	struct task {
+		std::function<void()> func;
+		Group *group;
+		steady_clock_w::time_point queuedAt;
+	};
+	struct parallelState {
+		explicit parallelState(size_t cnt) noexcept : count(cnt) {}
+		void Run() noexcept;
+		void Wait();
+
+		const size_t count;
+		const std::function<void(size_t)> *func = nullptr;
+		std::atomic<size_t> next = {0};
+		std::atomic<size_t> done = {0};
+		std::atomic<bool> failed = {false};
+		std::exception_ptr ex;
+		std::mutex mtx;
+		std::condition_variable cv;
+	};
+	struct priorityCounters {
+		size_t totalTasks = 0;
+		size_t totalQueueWaitUs = 0;
+		size_t maxQueueWaitUs = 0;
+	};
+
+	void workerRoutine(uint64_t generation);
+	void startWorkers();
+	void stopWorkers(std::unique_lock<std::mutex> &lck);
+
+	mutable std::mutex mtx_;
+	std::condition_variable cv_;
+	std::array<std::deque<task>, kPrioritiesCount> queues_;
+	std::array<priorityCounters, kPrioritiesCount> counters_;
+	std::vector<std::thread> workers_;
+	size_t threadsCount_;
+	size_t busyThreads_ = 0;
+	// Workers of the previous generations have to exit
+	uint64_t generation_ = 0;
+};
+
+}  // namespace reindexer
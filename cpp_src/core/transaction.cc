@@ -3,8 +3,8 @@
 namespace reindexer {
 
 Transaction::Transaction(const std::string &nsName, const PayloadType &pt, const TagsMatcher &tm, const FieldsSet &pf,
-						 std::shared_ptr<const Schema> schema)
-	: impl_(new TransactionImpl(nsName, pt, tm, pf, std::move(schema))) {}
+						 std::shared_ptr<const Schema> schema, size_t itemsSpillThreshold)
+	: impl_(new TransactionImpl(nsName, pt, tm, pf, std::move(schema), itemsSpillThreshold)) {}
 
 Transaction::Transaction(const Error &err) : status_(err) {}
 
@@ -16,7 +16,7 @@ public:
 	using time_point = system_clock_w::time_point;
 
 	Transaction(const std::string &nsName, const PayloadType &pt, const TagsMatcher &tm, const FieldsSet &pf,
-				std::shared_ptr<const Schema> schema);
+				std::shared_ptr<const Schema> schema, size_t itemsSpillThreshold = 0);
 	Transaction(const Error &err);
 	~Transaction();
 	Transaction() = default;
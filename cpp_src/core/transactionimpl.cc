@@ -39,8 +39,29 @@ Item TransactionImpl::NewItem() {
 Item TransactionImpl::GetItem(TransactionStep &&st) {
 	std::unique_lock<std::mutex> lock(mtx_);
 	auto &data = std::get<TransactionItemStep>(st.data_);
-	auto item = Item(new ItemImpl(payloadType_, tagsMatcher_, pkFields_, schema_, std::move(data.data)));
-	data.hadTmUpdate ? item.impl_->tagsMatcher().setUpdated() : item.impl_->tagsMatcher().clearUpdated();
+	auto item = Item(new ItemImpl(payloadType_, tagsMatcher_, pkFields_, schema_));
+	ItemImpl &impl = *item.impl_;
+	Serializer rdser(itemsBuffer_.Read(data.record));
+	const int64_t lsn = rdser.GetVarint();
+
+	std::vector<std::string> precepts(rdser.GetVarUint());
+	for (auto &p : precepts) p = rdser.GetVString();
+	impl.SetPrecepts(precepts);
+
+	WrSerializer tupleSer;
+	tupleSer.PutUInt32(0);
+	tupleSer.Write(rdser.GetVString());
+	impl.tupleData_ = tupleSer.DetachLStr();
+	impl.GetPayload().Set(0, Variant(p_string(reinterpret_cast<l_string_hdr *>(impl.tupleData_.get())), Variant::no_hold_t{}));
+
+	VariantArray krefs;
+	for (int field = 1, numFields = payloadType_.NumFields(); field < numFields; ++field) {
+		krefs.Clear();
+		for (size_t i = 0, cnt = rdser.GetVarUint(); i < cnt; ++i) krefs.emplace_back(rdser.GetVariant());
+		impl.SetField(field, krefs);
+	}
+	impl.Value().SetLSN(lsn);
+	data.hadTmUpdate ? impl.tagsMatcher().setUpdated() : impl.tagsMatcher().clearUpdated();
 	return item;
 }
 
@@ -53,31 +74,56 @@ void TransactionImpl::ValidatePK(const FieldsSet &pkFields) {
 	}
 }
 
+void TransactionImpl::addItemStep(Item &&item, ItemModifyMode mode) {
+	// The item's object is released right after the serialization
+	Item stepItem(std::move(item));
+	checkTagsMatcher(stepItem);
+	ItemImpl &impl = *stepItem.impl_;
+	if (impl.Type().NumFields() != payloadType_.NumFields()) {
+		throw Error(errParams, "Item's payload type doesn't match transaction's one (%d fields vs %d)", impl.Type().NumFields(),
+					payloadType_.NumFields());
+	}
+
+	// Record's format: LSN, precepts, tuple and values of the indexed fields
+	ser_.Reset();
+	ser_.PutVarint(impl.Value().GetLSN());
+	const auto &precepts = impl.GetPrecepts();
+	ser_.PutVarUint(precepts.size());
+	for (const auto &p : precepts) ser_.PutVString(p);
+
+	ConstPayload pl = impl.GetConstPayload();
+	VariantArray krefs;
+	pl.Get(0, krefs);
+	ser_.PutVString(krefs.empty() ? std::string_view() : std::string_view(krefs[0]));
+	for (int field = 1, numFields = pl.NumFields(); field < numFields; ++field) {
+		pl.Get(field, krefs);
+		ser_.PutVarUint(krefs.size());
+		for (const auto &kref : krefs) ser_.PutVariant(kref);
+	}
+
+	steps_.emplace_back(mode, stepItem.IsTagsUpdated(), itemsBuffer_.Append(ser_.Slice()));
+}
+
 void TransactionImpl::Insert(Item &&item) {
 	std::unique_lock<std::mutex> lock(mtx_);
-	checkTagsMatcher(item);
-	steps_.emplace_back(std::move(item), ModeInsert);
+	addItemStep(std::move(item), ModeInsert);
 }
 void TransactionImpl::Update(Item &&item) {
 	std::unique_lock<std::mutex> lock(mtx_);
-	checkTagsMatcher(item);
-	steps_.emplace_back(std::move(item), ModeUpdate);
+	addItemStep(std::move(item), ModeUpdate);
 }
 void TransactionImpl::Upsert(Item &&item) {
 	std::unique_lock<std::mutex> lock(mtx_);
-	checkTagsMatcher(item);
-	steps_.emplace_back(std::move(item), ModeUpsert);
+	addItemStep(std::move(item), ModeUpsert);
 }
 void TransactionImpl::Delete(Item &&item) {
 	std::unique_lock<std::mutex> lock(mtx_);
-	checkTagsMatcher(item);
-	steps_.emplace_back(std::move(item), ModeDelete);
+	addItemStep(std::move(item), ModeDelete);
 }
 void TransactionImpl::Modify(Item &&item, ItemModifyMode mode) {
 	std::unique_lock<std::mutex> lock(mtx_);
-	checkTagsMatcher(item);
 	hasDeleteItemSteps_ = hasDeleteItemSteps_ || (mode == ModeDelete);
-	steps_.emplace_back(std::move(item), mode);
+	addItemStep(std::move(item), mode);
 }
 
 void TransactionImpl::Modify(Query &&query) {
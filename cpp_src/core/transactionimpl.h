@@ -2,13 +2,14 @@
 #include "core/itemimpl.h"
 #include "payload/fieldsset.h"
 #include "transaction.h"
+#include "txitemsbuffer.h"
 
 namespace reindexer {
 
 struct TransactionItemStep {
 	ItemModifyMode mode;
 	bool hadTmUpdate;
-	ItemImplRawData data;
+	TxItemsBuffer::Record record;
 };
 
 struct TransactionQueryStep {
@@ -28,11 +29,8 @@ class TransactionStep {
 public:
 	enum class Type : uint8_t { Nop, ModifyItem, Query, PutMeta, DeleteMeta, SetTM };
 
-	TransactionStep(Item &&item, ItemModifyMode modifyMode)
-		: data_(TransactionItemStep{modifyMode, item.IsTagsUpdated(), std::move(*item.impl_)}), type_(Type::ModifyItem) {
-		delete item.impl_;
-		item.impl_ = nullptr;
-	}
+	TransactionStep(ItemModifyMode modifyMode, bool hadTmUpdate, TxItemsBuffer::Record record)
+		: data_(TransactionItemStep{modifyMode, hadTmUpdate, record}), type_(Type::ModifyItem) {}
 	TransactionStep(TagsMatcher &&tm) : data_(TransactionTmStep{std::move(tm)}), type_(Type::SetTM) {}
 	TransactionStep(Query &&query) : data_(TransactionQueryStep{std::make_unique<Query>(std::move(query))}), type_(Type::Query) {}
 	TransactionStep(std::string_view key, std::string_view value)
@@ -50,7 +48,7 @@ public:
 class TransactionImpl {
 public:
 	TransactionImpl(const std::string &nsName, const PayloadType &pt, const TagsMatcher &tm, const FieldsSet &pf,
-					std::shared_ptr<const Schema> schema)
+					std::shared_ptr<const Schema> schema, size_t itemsSpillThreshold)
 		: payloadType_(pt),
 		  tagsMatcher_(tm),
 		  pkFields_(pf),
@@ -58,7 +56,8 @@ public:
 		  nsName_(nsName),
 		  tagsUpdated_(false),
 		  hasDeleteItemSteps_(false),
-		  startTime_(system_clock_w::now()) {
+		  startTime_(system_clock_w::now()),
+		  itemsBuffer_(itemsSpillThreshold) {
 		tagsMatcher_.clearUpdated();
 	}
 
@@ -78,6 +77,7 @@ public:
 	const std::string &GetName() { return nsName_; }
 
 	void checkTagsMatcher(Item &item);
+	void addItemStep(Item &&item, ItemModifyMode mode);
 
 	PayloadType payloadType_;
 	TagsMatcher tagsMatcher_;
@@ -90,6 +90,9 @@ public:
 	bool hasDeleteItemSteps_;
 	std::mutex mtx_;
 	Transaction::time_point startTime_;
+	// Items are kept serialized and are reconstructed on commit
+	TxItemsBuffer itemsBuffer_;
+	WrSerializer ser_;
 };
 
 }  // namespace reindexer
@@ -0,0 +1,77 @@
+#include "txitemsbuffer.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include "tools/errors.h"
+
+namespace reindexer {
+
+static int seekFile(std::FILE *f, uint64_t offset) noexcept {
+#ifdef _WIN32
+	return _fseeki64(f, int64_t(offset), SEEK_SET);
+#else
+	return fseeko(f, off_t(offset), SEEK_SET);
+#endif
+}
+
+TxItemsBuffer::~TxItemsBuffer() {
+	if (file_) std::fclose(file_);
+}
+
+TxItemsBuffer::Record TxItemsBuffer::Append(std::string_view data) {
+	if (data.size() > UINT32_MAX) {
+		throw Error(errParams, "Transaction's item is too large: %d bytes", data.size());
+	}
+	if (chunks_.empty() || chunks_.back().cap - chunks_.back().len < data.size()) {
+		const size_t nextCap = chunks_.empty() ? kMinChunkSize : std::min(kMaxChunkSize, chunks_.back().cap * 2);
+		const size_t cap = std::max(nextCap, data.size());
+		if (file_ || (spillThreshold_ && memSize_ + cap > spillThreshold_)) {
+			return spill(data);
+		}
+		chunks_.emplace_back(Chunk{std::make_unique<char[]>(cap), 0, cap});
+		memSize_ += cap;
+	}
+	auto &chunk = chunks_.back();
+	const Record rec{chunk.len, uint32_t(data.size()), uint32_t(chunks_.size() - 1)};
+	std::memcpy(chunk.data.get() + chunk.len, data.data(), data.size());
+	chunk.len += data.size();
+	return rec;
+}
+
+std::string_view TxItemsBuffer::Read(const Record &rec) {
+	if (rec.chunk != kSpilledChunk) {
+		return std::string_view(chunks_[rec.chunk].data.get() + rec.offset, rec.size);
+	}
+	if (!flushed_) {
+		if (std::fflush(file_) != 0) throw Error(errSystem, "Unable to flush transaction's temporary file: %s", std::strerror(errno));
+		flushed_ = true;
+	}
+	if (readBufCap_ < rec.size) {
+		readBuf_ = std::make_unique<char[]>(rec.size);
+		readBufCap_ = rec.size;
+	}
+	if (seekFile(file_, rec.offset) != 0 || std::fread(readBuf_.get(), 1, rec.size, file_) != rec.size) {
+		throw Error(errSystem, "Unable to read transaction's item from the temporary file: %s", std::strerror(errno));
+	}
+	return std::string_view(readBuf_.get(), rec.size);
+}
+
+TxItemsBuffer::Record TxItemsBuffer::spill(std::string_view data) {
+	if (!file_) {
+		file_ = std::tmpfile();
+		if (!file_) throw Error(errSystem, "Unable to create temporary file for the transaction's items: %s", std::strerror(errno));
+	}
+	// Reads and writes of the same stream have to be separated by the positioning call
+	if (flushed_ && seekFile(file_, diskSize_) != 0) {
+		throw Error(errSystem, "Unable to seek transaction's temporary file: %s", std::strerror(errno));
+	}
+	if (std::fwrite(data.data(), 1, data.size(), file_) != data.size()) {
+		throw Error(errSystem, "Unable to write transaction's item into the temporary file: %s", std::strerror(errno));
+	}
+	flushed_ = false;
+	const Record rec{diskSize_, uint32_t(data.size()), kSpilledChunk};
+	diskSize_ += data.size();
+	return rec;
+}
+
+}  // namespace reindexer
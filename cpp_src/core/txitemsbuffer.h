@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdio>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace reindexer {
+
+/// Append-only storage of the serialized transaction's items. Records are packed into the memory chunks, which grow geometrically, so
+/// small transactions stay small. When the size of the chunks reaches the threshold, the following records are written into the
+/// anonymous temporary file
+class TxItemsBuffer {
+public:
+	struct Record {
+		uint64_t offset;
+		uint32_t size;
+		uint32_t chunk;
+	};
+
+	/// @param spillThreshold - size of the in-memory records in bytes, after which the records are spilled to the disk (0 - never spill)
+	explicit TxItemsBuffer(size_t spillThreshold) noexcept : spillThreshold_(spillThreshold) {}
+	~TxItemsBuffer();
+	TxItemsBuffer(const TxItemsBuffer &) = delete;
+	TxItemsBuffer &operator=(const TxItemsBuffer &) = delete;
+
+	Record Append(std::string_view data);
+	/// Data of the in-memory record is valid until the buffer's destruction, data of the spilled record - until the next Read() call
+	std::string_view Read(const Record &rec);
+	size_t MemSize() const noexcept { return memSize_; }
+	size_t DiskSize() const noexcept { return diskSize_; }
+
+private:
+	struct Chunk {
+		std::unique_ptr<char[]> data;
+		size_t len;
+		size_t cap;
+	};
+
+	static constexpr size_t kMinChunkSize = 16 << 10;
+	static constexpr size_t kMaxChunkSize = 1 << 20;
+	static constexpr uint32_t kSpilledChunk = UINT32_MAX;
+
+	Record spill(std::string_view data);
+
+	const size_t spillThreshold_;
+	std::vector<Chunk> chunks_;
+	size_t memSize_ = 0;
+	size_t diskSize_ = 0;
+	std::FILE *file_ = nullptr;
+	bool flushed_ = true;
+	std::unique_ptr<char[]> readBuf_;
+	size_t readBufCap_ = 0;
+};
+
+}  // namespace reindexer
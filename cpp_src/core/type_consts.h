@@ -71,6 +71,7 @@ typedef enum QueryItemType {
 	QueryAlwaysTrueCondition = 28,
 	QuerySubQueryCondition = 29,
 	QueryFieldSubQueryCondition = 30,
+	QueryIndexOnly = 31,
 } QueryItemType;
 
 typedef enum QuerySerializeMode {
@@ -140,6 +141,7 @@ enum ErrorCode {
 	errQrUIDMissmatch = 36,
 	errSystem = 37,
 	errAssert = 38,
+	errQueryMemoryLimit = 39,
 };
 
 enum SchemaType { JsonSchemaType, ProtobufSchemaType };
@@ -190,6 +192,9 @@ enum {
 	// kResultsWithShardId = 0x800, // v4.x.x
 	// kResultsNeedOutputShardId = 0x1000, // v4.x.x
 	kResultsSupportIdleTimeout = 0x2000,
+	// Client reads results strictly forward, so server drops payload references of the already sent items. Does not change the
+	// delivery itself (pages are still fetched by request), but reduces the amount of items versions, pinned by the long fetches
+	kResultsReleaseFetched = 0x4000,
 
 	kResultsFlagMaxValue
 };
@@ -199,6 +204,8 @@ typedef enum IndexOpt {
 	kIndexOptArray = 1 << 6,
 	kIndexOptDense = 1 << 5,
 	kIndexOptSparse = 1 << 3,
+	kIndexOptDictionary = 1 << 2,
+	kIndexOptColumn = 1 << 1,
 } IndexOpt;
 
 typedef enum StotageOpt {
@@ -12,11 +12,17 @@ public:
 	counter_t alloced_cnt;
 	counter_t alloced_cnt_total;
 	counter_t alloced_sz_total;
+	counter_t alloced_large_cnt_total;
+	counter_t alloced_large_sz_total;
 	void traced_new(size_t size) {
 		alloced_cnt++;
 		alloced_cnt_total++;
 		alloced_sz += size;
 		alloced_sz_total += size;
+		if (size >= kLargeAllocSize) {
+			alloced_large_cnt_total++;
+			alloced_large_sz_total += size;
+		}
 	}
 	void traced_delete(size_t size) {
 		alloced_sz -= size;
@@ -81,6 +87,8 @@ size_t get_alloc_size() { return ismt ? tracer_mt.alloced_sz.load() : tracer.all
 size_t get_alloc_cnt() { return ismt ? tracer_mt.alloced_cnt.load() : tracer.alloced_cnt; }
 size_t get_alloc_size_total() { return ismt ? tracer_mt.alloced_sz_total.load() : tracer.alloced_sz_total; }
 size_t get_alloc_cnt_total() { return ismt ? tracer_mt.alloced_cnt_total.load() : tracer.alloced_cnt_total; }
+size_t get_large_alloc_size_total() { return ismt ? tracer_mt.alloced_large_sz_total.load() : tracer.alloced_large_sz_total; }
+size_t get_large_alloc_cnt_total() { return ismt ? tracer_mt.alloced_large_cnt_total.load() : tracer.alloced_large_cnt_total; }
 
 void allocdebug_show() {
 	reindexer::logPrintf(LogInfo, "meminfo (alloced %dM, %d total allocs, %d remain)", get_alloc_size() / (1024 * 1024),
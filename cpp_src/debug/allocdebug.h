@@ -1,6 +1,9 @@
 #pragma once
 #include <cstddef>
 
+// Allocations of this size and larger are additionally counted by get_large_alloc_* functions
+constexpr size_t kLargeAllocSize = 0x10000;
+
 void allocdebug_show();
 void allocdebug_init();
 void allocdebug_init_mt();
@@ -8,3 +11,5 @@ size_t get_alloc_size();
 size_t get_alloc_size_total();
 size_t get_alloc_cnt();
 size_t get_alloc_cnt_total();
+size_t get_large_alloc_size_total();
+size_t get_large_alloc_cnt_total();
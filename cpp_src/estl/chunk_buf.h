@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <mutex>
 #include <string_view>
@@ -11,10 +12,41 @@
 
 namespace reindexer {
 
+// Max capacity of the regular chunk, which may be reused after write
+constexpr size_t kChainBufMaxFreeChunkCap = 0x10000;
+// Max capacity of the spare chunk. Single large chunk is kept for the large responses to avoid reallocations on each of them
+constexpr size_t kChainBufMaxSpareChunkCap = 0x400000;
+// Max total capacity of the spare chunks of all the chain buffers
+constexpr size_t kChainBufMaxSpareChunksTotalCap = 0x4000000;
+
+// Accounting of the memory, which is kept by the spare chunks of all the chain buffers
+class chain_buf_spares {
+public:
+	static bool acquire(size_t cap) noexcept {
+		auto &total = total_ref();
+		size_t cur = total.load(std::memory_order_relaxed);
+		do {
+			if (cur + cap > kChainBufMaxSpareChunksTotalCap) return false;
+		} while (!total.compare_exchange_weak(cur, cur + cap, std::memory_order_relaxed));
+		return true;
+	}
+	static void release(size_t cap) noexcept { total_ref().fetch_sub(cap, std::memory_order_relaxed); }
+	static size_t total() noexcept { return total_ref().load(std::memory_order_relaxed); }
+
+private:
+	static std::atomic<size_t> &total_ref() noexcept {
+		static std::atomic<size_t> total{0};
+		return total;
+	}
+};
+
 template <typename Mutex>
 class chain_buf {
 public:
 	chain_buf(size_t cap) : ring_(cap) {}
+	chain_buf(const chain_buf &) = delete;
+	chain_buf &operator=(const chain_buf &) = delete;
+	~chain_buf() { chain_buf_spares::release(spare_.capacity()); }
 	void write(chunk &&ch) {
 		if (ch.size()) {
 			std::lock_guard lck(mtx_);
@@ -49,22 +81,27 @@ public:
 				break;
 			}
 			nread -= cur.size();
-			cur.clear();
-			if (free_.size() < ring_.size() && cur.capacity() < 0x10000)
-				free_.push_back(std::move(cur));
-			else
-				cur = chunk();
+			recycle_impl(cur);
 			tail_ = (tail_ + 1) % ring_.size();
 		}
 	}
 	chunk get_chunk() {
 		std::lock_guard lck(mtx_);
-		chunk ret;
-		if (free_.size()) {
-			ret = std::move(free_.back());
-			free_.pop_back();
+		return get_chunk_impl();
+	}
+	// Returns spare chunk (if exists) with the large capacity, if the expected size of the data is large. Regular chunk otherwise
+	chunk get_chunk(size_t expectedSize) {
+		std::lock_guard lck(mtx_);
+		if (expectedSize >= kChainBufMaxFreeChunkCap && spare_.capacity()) {
+			chain_buf_spares::release(spare_.capacity());
+			return std::move(spare_);
 		}
-		return ret;
+		return get_chunk_impl();
+	}
+	// Returns chunk, which was not passed to write(), into the pool
+	void recycle(chunk &&ch) {
+		std::lock_guard lck(mtx_);
+		recycle_impl(ch);
 	}
 
 	size_t size() {
@@ -84,11 +121,35 @@ public:
 	void clear() {
 		std::lock_guard lck(mtx_);
 		head_ = tail_ = data_size_ = 0;
+		chain_buf_spares::release(spare_.capacity());
+		spare_ = chunk();
 	}
 
 protected:
+	chunk get_chunk_impl() noexcept {
+		chunk ret;
+		if (free_.size()) {
+			ret = std::move(free_.back());
+			free_.pop_back();
+		}
+		return ret;
+	}
+	void recycle_impl(chunk &ch) {
+		ch.clear();
+		const size_t cap = ch.capacity();
+		if (cap < kChainBufMaxFreeChunkCap) {
+			if (free_.size() < ring_.size()) {
+				free_.push_back(std::move(ch));
+			}
+		} else if (cap <= kChainBufMaxSpareChunkCap && cap > spare_.capacity() && chain_buf_spares::acquire(cap - spare_.capacity())) {
+			spare_ = std::move(ch);
+		}
+		ch = chunk();
+	}
+
 	size_t head_ = 0, tail_ = 0, data_size_ = 0;
 	std::vector<chunk> ring_, free_;
+	chunk spare_;
 	Mutex mtx_;
 };
 
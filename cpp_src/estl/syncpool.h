@@ -1,45 +1,222 @@
 #pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <vector>
+#include "estl/mutex.h"
 
 namespace reindexer {
+
+/// Pool of the reusable objects. Released objects are kept in the small cache of the releasing thread first, overflowed objects are
+/// stored in the shared lock-free array of slots. maxPoolSize limits the total count of the pooled objects, including the objects in
+/// the threads' caches. Each thread holds at most kThreadCacheSize objects for each of kThreadCacheEntries recently used pools of the
+/// same type. Threads' caches are drained on the pool's clear and destruction
 template <typename T, size_t maxPoolSize, size_t maxAllocSize = std::numeric_limits<size_t>::max()>
 class sync_pool {
 public:
+	static constexpr size_t kThreadCacheSize = 8;
+	static constexpr size_t kThreadCacheEntries = 4;
+
+	sync_pool() noexcept = default;
+	~sync_pool() {
+		drainThreadCaches();
+		clearSlots();
+	}
+	sync_pool(const sync_pool&) = delete;
+	sync_pool& operator=(const sync_pool&) = delete;
+
 	void put(std::unique_ptr<T> obj) {
-		std::lock_guard lck(lck_);
-		if (pool_.size() < maxPoolSize) {
-			pool_.emplace_back(std::move(obj));
-		}
 		alloced_.fetch_sub(1, std::memory_order_relaxed);
+		size_t pooled = pooled_.load(std::memory_order_relaxed);
+		do {
+			if (pooled >= maxPoolSize) {
+				return;
+			}
+		} while (!pooled_.compare_exchange_weak(pooled, pooled + 1, std::memory_order_relaxed));
+
+		if (threadCache().Put(this, obj)) {
+			return;
+		}
+		pushShared(std::move(obj));
 	}
 
 	template <typename... Args>
 	std::unique_ptr<T> get(int usedCount, Args&&... args) {
-		std::unique_lock lck(lck_);
-		if (alloced_.load(std::memory_order_relaxed) > maxAllocSize + usedCount) {
-			return nullptr;
+		size_t alloced = alloced_.load(std::memory_order_relaxed);
+		do {
+			if (alloced > maxAllocSize + usedCount) {
+				return nullptr;
+			}
+		} while (!alloced_.compare_exchange_weak(alloced, alloced + 1, std::memory_order_relaxed));
+
+		if (auto obj = threadCache().Get(this)) {
+			return obj;
 		}
-		alloced_.fetch_add(1, std::memory_order_relaxed);
-		if (pool_.empty()) {
-			lck.unlock();
-			return std::unique_ptr<T>{new T(std::forward<Args>(args)...)};
-		} else {
-			auto res = std::move(pool_.back());
-			pool_.pop_back();
-			return res;
+		if (auto obj = popShared()) {
+			return obj;
 		}
+		return std::unique_ptr<T>{new T(std::forward<Args>(args)...)};
 	}
+	// Pooled objects are dropped, including the objects in the threads' caches
 	void clear() {
-		std::lock_guard lck(lck_);
-		pool_.clear();
+		drainThreadCaches();
+		clearSlots();
 	}
 	size_t Alloced() const noexcept { return alloced_.load(std::memory_order_relaxed); }
+	// Count of the objects in the shared slots and in the threads' caches
+	size_t Pooled() const noexcept { return pooled_.load(std::memory_order_relaxed); }
+
+private:
+	class ThreadCache;
+	// Registry of the threads' caches. It is never destroyed, because the threads' caches may outlive the static objects
+	struct CachesRegistry {
+		std::mutex mtx;
+		std::vector<ThreadCache*> caches;
+	};
+
+	class ThreadCache {
+	public:
+		ThreadCache() {
+			auto& reg = registry();
+			std::lock_guard lck(reg.mtx);
+			reg.caches.emplace_back(this);
+		}
+		~ThreadCache() {
+			auto& reg = registry();
+			std::lock_guard lck(reg.mtx);
+			{
+				std::lock_guard cacheLck(mtx_);
+				for (auto& e : entries_) e.Reset(nullptr);
+			}
+			reg.caches.erase(std::find(reg.caches.begin(), reg.caches.end(), this));
+		}
+		ThreadCache(const ThreadCache&) = delete;
+		ThreadCache& operator=(const ThreadCache&) = delete;
+
+		std::unique_ptr<T> Get(sync_pool* pool) noexcept {
+			std::lock_guard lck(mtx_);
+			for (auto& e : entries_) {
+				if (e.pool == pool) {
+					e.lastUse = ++tick_;
+					if (!e.count) return nullptr;
+					pool->pooled_.fetch_sub(1, std::memory_order_relaxed);
+					return std::unique_ptr<T>{e.objs[--e.count]};
+				}
+			}
+			return nullptr;
+		}
+		bool Put(sync_pool* pool, std::unique_ptr<T>& obj) {
+			std::lock_guard lck(mtx_);
+			Entry* victim = &entries_[0];
+			for (auto& e : entries_) {
+				if (e.pool == pool) {
+					victim = &e;
+					break;
+				}
+				if (e.lastUse < victim->lastUse) victim = &e;
+			}
+			if (victim->pool != pool) victim->Reset(pool);
+			victim->lastUse = ++tick_;
+			if (victim->count == kThreadCacheSize) return false;
+			victim->objs[victim->count++] = obj.release();
+			return true;
+		}
+		// Releases the objects of the pool. Called by the pool (possibly from the other thread) on its clear and destruction
+		void Drain(sync_pool* pool) noexcept {
+			std::lock_guard lck(mtx_);
+			for (auto& e : entries_) {
+				if (e.pool == pool) e.Reset(nullptr);
+			}
+		}
+
+	private:
+		struct Entry {
+			void Reset(sync_pool* newPool) noexcept {
+				for (size_t i = 0; i < count; ++i) delete objs[i];
+				if (pool) pool->pooled_.fetch_sub(count, std::memory_order_relaxed);
+				count = 0;
+				pool = newPool;
+			}
+
+			// Pool is always alive, while its entry exists: pool drains all the caches before the destruction
+			sync_pool* pool = nullptr;
+			uint64_t lastUse = 0;
+			size_t count = 0;
+			std::array<T*, kThreadCacheSize> objs;
+		};
+
+		// Lock is contended only on the pool's clear and destruction
+		spinlock mtx_;
+		std::array<Entry, kThreadCacheEntries> entries_;
+		uint64_t tick_ = 0;
+	};
+
+	static ThreadCache& threadCache() {
+		thread_local ThreadCache cache;
+		return cache;
+	}
+	static CachesRegistry& registry() {
+		static CachesRegistry* reg = new CachesRegistry;
+		return *reg;
+	}
+	void drainThreadCaches() noexcept {
+		auto& reg = registry();
+		std::lock_guard lck(reg.mtx);
+		for (auto cache : reg.caches) cache->Drain(this);
+	}
+
+	void pushShared(std::unique_ptr<T> obj) {
+		if (size_.load(std::memory_order_relaxed) >= maxPoolSize) {
+			pooled_.fetch_sub(1, std::memory_order_relaxed);
+			return;
+		}
+		size_t idx = hint_.load(std::memory_order_relaxed) % maxPoolSize;
+		for (size_t i = 0; i < maxPoolSize; ++i, idx = (idx + 1) % maxPoolSize) {
+			T* expected = nullptr;
+			if (!slots_[idx].load(std::memory_order_relaxed) &&
+				slots_[idx].compare_exchange_strong(expected, obj.get(), std::memory_order_release, std::memory_order_relaxed)) {
+				obj.release();
+				size_.fetch_add(1, std::memory_order_relaxed);
+				hint_.store(idx + 1, std::memory_order_relaxed);
+				return;
+			}
+		}
+		pooled_.fetch_sub(1, std::memory_order_relaxed);
+	}
+	std::unique_ptr<T> popShared() noexcept {
+		if (size_.load(std::memory_order_relaxed) == 0) {
+			return nullptr;
+		}
+		size_t idx = (hint_.load(std::memory_order_relaxed) + maxPoolSize - 1) % maxPoolSize;
+		for (size_t i = 0; i < maxPoolSize; ++i, idx = (idx + maxPoolSize - 1) % maxPoolSize) {
+			if (slots_[idx].load(std::memory_order_relaxed)) {
+				if (T* obj = slots_[idx].exchange(nullptr, std::memory_order_acquire)) {
+					size_.fetch_sub(1, std::memory_order_relaxed);
+					pooled_.fetch_sub(1, std::memory_order_relaxed);
+					hint_.store(idx, std::memory_order_relaxed);
+					return std::unique_ptr<T>{obj};
+				}
+			}
+		}
+		return nullptr;
+	}
+	void clearSlots() noexcept {
+		for (auto& slot : slots_) {
+			if (T* obj = slot.exchange(nullptr, std::memory_order_acquire)) {
+				size_.fetch_sub(1, std::memory_order_relaxed);
+				pooled_.fetch_sub(1, std::memory_order_relaxed);
+				delete obj;
+			}
+		}
+	}
 
-protected:
 	std::atomic<size_t> alloced_ = 0;
-	std::vector<std::unique_ptr<T>> pool_;
-	std::mutex lck_;
+	std::atomic<size_t> pooled_ = 0;
+	std::atomic<size_t> size_ = 0;
+	std::atomic<size_t> hint_ = 0;
+	std::array<std::atomic<T*>, maxPoolSize> slots_{};
 };
 }  // namespace reindexer
@@ -1,9 +1,15 @@
 #include "api_tv_simple.h"
 #include <thread>
 #include "allocs_tracker.h"
+#include "core/cbinding/resultserializer.h"
+#include "core/cjson/baseencoder.h"
+#include "core/cjson/fieldextractor.h"
 #include "core/cjson/jsonbuilder.h"
 #include "core/nsselecter/joinedselector.h"
 #include "core/reindexer.h"
+#include "estl/chunk_buf.h"
+#include "estl/mutex.h"
+#include "gason/gason.h"
 #include "gtests/tools.h"
 #include "tools/string_regexp_functions.h"
 
@@ -147,14 +153,22 @@ void ApiTvSimple::RegisterAllCases() {
 	Register("FromCJSONPKOnly", &ApiTvSimple::FromCJSONPKOnly, this);
 	Register("GetCJSON", &ApiTvSimple::GetCJSON, this);
 	Register("ExtractField", &ApiTvSimple::ExtractField, this);
+	Register("ExtractFieldByEncoder", &ApiTvSimple::ExtractFieldByEncoder, this);
+	Register("ExtractFieldBySkipScan", &ApiTvSimple::ExtractFieldBySkipScan, this);
+	Register("SerializeResultsCopy", &ApiTvSimple::SerializeResultsCopy, this);
+	Register("SerializeResultsToChunk", &ApiTvSimple::SerializeResultsToChunk, this);
 	Register("SubQueryEq", &ApiTvSimple::SubQueryEq, this);
 	Register("SubQuerySet", &ApiTvSimple::SubQuerySet, this);
 	Register("SubQueryAggregate", &ApiTvSimple::SubQueryAggregate, this);
+	Register("UpdateByExpression", &ApiTvSimple::UpdateByExpression, this);
+	Register("SelectColumnsPayload", &ApiTvSimple::SelectColumnsPayload, this);
+	Register("SelectColumnsIndexOnly", &ApiTvSimple::SelectColumnsIndexOnly, this);
 
 	// Those benches should be last, because they are recreating indexes cache
 	Register("Query4CondRangeDropCache", &ApiTvSimple::Query4CondRangeDropCache, this)->Iterations(kQuery4CondIters);
 	Register("Query4CondRangeDropCacheTotal", &ApiTvSimple::Query4CondRangeDropCacheTotal, this)->Iterations(kQuery4CondIters);
 	Register("Query4CondRangeDropCacheCachedTotal", &ApiTvSimple::Query4CondRangeDropCacheCachedTotal, this)->Iterations(kQuery4CondIters);
+	Register("IdSetCacheSkewedWorkload", &ApiTvSimple::IdSetCacheSkewedWorkload, this);
 	//  NOLINTEND(*cplusplus.NewDeleteLeaks)
 }
 
@@ -463,6 +477,8 @@ reindexer::Item ApiTvSimple::MakeItem(benchmark::State&) {
 	item["end_time"] = startTime + random<int>(1, 5) * 1000;
 	item["uuid"] = reindexer::Uuid{uuids_[rand() % uuids_.size()]};
 	item["uuid_str"] = uuids_[rand() % uuids_.size()];
+	item["rating"] = random<int>(0, 100);
+	item["views"] = random<int64_t>(0, 1000000);
 
 	return item;
 }
@@ -544,6 +560,78 @@ void ApiTvSimple::ExtractField(benchmark::State& state) {
 	}
 }
 
+void ApiTvSimple::ExtractFieldByEncoder(benchmark::State& state) { extractFieldFromPayload(state, false); }
+void ApiTvSimple::ExtractFieldBySkipScan(benchmark::State& state) { extractFieldFromPayload(state, true); }
+
+// Extraction of the non-indexed fields by the full tuple's encoding vs the tuple's tags skip-scan
+void ApiTvSimple::extractFieldFromPayload(benchmark::State& state, bool skipScan) {
+	QueryResults qres;
+	auto err = db_->Select(Query(cjsonNsName_).Where("id", CondEq, kCjsonBenchItemID), qres);
+	if (!err.ok()) state.SkipWithError(err.what().c_str());
+	if (qres.Count() != 1) {
+		state.SkipWithError(fmt::sprintf("Unexpected results count: %d", qres.Count()).c_str());
+		return;
+	}
+	std::vector<reindexer::TagsPath> paths;
+	paths.reserve(fieldsToExtract_.size());
+	for (const auto& field : fieldsToExtract_) paths.emplace_back(qres.getTagsMatcher(0).path2tag(field));
+	reindexer::ConstPayload pl(qres.getPayloadType(0), qres.begin().GetItemRef().Value());
+	reindexer::VariantArray va;
+	AllocsTracker allocsTracker(state);
+	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
+		const auto& path = paths[rand() % paths.size()];
+		if (skipScan) {
+			pl.GetByJsonPath(path, va, reindexer::KeyValueType::Undefined{});
+		} else {
+			va.clear<false>();
+			const reindexer::FieldsSet filter{{path}};
+			reindexer::BaseEncoder<reindexer::FieldsExtractor> encoder(nullptr, &filter);
+			reindexer::FieldsExtractor extractor(&va, reindexer::KeyValueType::Undefined{}, path.size(), &filter);
+			encoder.Encode(pl, extractor);
+		}
+		if (va.size() != 1) state.SkipWithError(fmt::sprintf("Unexpected result size: %d", va.size()).c_str());
+	}
+}
+
+// Emulates the previous cproto responses path: serialization into the temporary buffer and copying into the connection's buffer
+void ApiTvSimple::SerializeResultsCopy(benchmark::State& state) {
+	QueryResults qres;
+	auto err = db_->Select(Query(nsdef_.name).Limit(2000), qres);
+	if (!err.ok()) state.SkipWithError(err.what().c_str());
+	const reindexer::ResultFetchOpts opts{
+		.flags = kResultsCJson | kResultsWithItemID, .ptVersions = {}, .fetchOffset = 0, .fetchLimit = 2000, .withAggregations = true};
+	reindexer::chain_buf<reindexer::dummy_mutex> wrBuf(0x800);
+	AllocsTracker allocsTracker(state, AllocsTracker::kPrintAllocs | AllocsTracker::kPrintLargeAllocs);
+	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
+		uint8_t serBuf[0x2000];
+		reindexer::WrResultSerializer rser(serBuf, opts);
+		rser.PutResults(&qres);
+		auto ch = wrBuf.get_chunk();
+		ch.append(rser.Slice());
+		wrBuf.write(std::move(ch));
+		wrBuf.erase(wrBuf.data_size());
+	}
+}
+
+// Serialization directly into the pooled chunk, which is passed to the connection's buffer as is
+void ApiTvSimple::SerializeResultsToChunk(benchmark::State& state) {
+	QueryResults qres;
+	auto err = db_->Select(Query(nsdef_.name).Limit(2000), qres);
+	if (!err.ok()) state.SkipWithError(err.what().c_str());
+	const reindexer::ResultFetchOpts opts{
+		.flags = kResultsCJson | kResultsWithItemID, .ptVersions = {}, .fetchOffset = 0, .fetchLimit = 2000, .withAggregations = true};
+	reindexer::chain_buf<reindexer::dummy_mutex> wrBuf(0x800);
+	AllocsTracker allocsTracker(state, AllocsTracker::kPrintAllocs | AllocsTracker::kPrintLargeAllocs);
+	size_t lastSize = 0;
+	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
+		reindexer::WrResultSerializer rser(wrBuf.get_chunk(lastSize), opts);
+		rser.PutResults(&qres);
+		lastSize = rser.Len();
+		wrBuf.write(rser.DetachChunk());
+		wrBuf.erase(wrBuf.data_size());
+	}
+}
+
 void ApiTvSimple::StringsSelect(benchmark::State& state) {
 	AllocsTracker allocsTracker(state);
 	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
@@ -987,6 +1075,24 @@ void ApiTvSimple::SubQueryAggregate(benchmark::State& state) {
 	}
 }
 
+void ApiTvSimple::UpdateByExpression(benchmark::State& state) {
+	AllocsTracker allocsTracker(state);
+	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
+		const int start = random<int>(id_seq_->Start(), id_seq_->End() - kUpdateByExpressionItems);
+		// Values are not changed to keep the dataset for the other cases
+		Query q(nsdef_.name);
+		q.Where("id", CondRange, {start, start + kUpdateByExpressionItems - 1})
+			.Set("end_time", "end_time * 2 - end_time", true)
+			.Set("age", "(age + 10) * 3 / 3 - 10", true);
+
+		QueryResults qres;
+		auto err = db_->Update(q, qres);
+		if (!err.ok()) state.SkipWithError(err.what().c_str());
+
+		if (qres.Count() != kUpdateByExpressionItems) state.SkipWithError("Unexpected count of the updated items");
+	}
+}
+
 void ApiTvSimple::Query2CondInnerJoin2Cond(benchmark::State& state) {
 	AllocsTracker allocsTracker(state);
 	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
@@ -1476,6 +1582,70 @@ void ApiTvSimple::Query4CondRangeDropCacheCachedTotal(benchmark::State& state) {
 	}
 }
 
+void ApiTvSimple::IdSetCacheSkewedWorkload(benchmark::State& state) {
+	// Cache is unable to hold all the idsets: few hot and expensive ranges are mixed with the flow of the cheap unique IN-lookups
+	constexpr int64_t kCacheSize = 2 * 1024 * 1024;
+	IndexCacheSetter cacheSetter(*db_, 1, kCacheSize);
+
+	AllocsTracker allocsTracker(state);
+	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
+		Query q(nsdef_.name);
+		if (random<int>(0, 4) == 0) {
+			const int startYear = 2000 + 10 * random<int>(0, 3);
+			q.Where("year", CondRange, {startYear, startYear + 4});
+		} else {
+			q.Where("id", CondSet, randomNumArray<int>(10, id_seq_->Start(), id_seq_->Count()));
+		}
+		q.Limit(20);
+
+		QueryResults qres;
+		auto err = db_->Select(q, qres);
+		if (!err.ok()) state.SkipWithError(err.what().c_str());
+	}
+
+	QueryResults qres;
+	auto err = db_->Select(Query("#memstats").Where("name", CondEq, nsdef_.name), qres);
+	if (!err.ok()) state.SkipWithError(err.what().c_str());
+	if (qres.Count() != 1) state.SkipWithError("Unexpected results count");
+	reindexer::WrSerializer ser;
+	err = qres.begin().GetJSON(ser, false);
+	if (!err.ok()) state.SkipWithError(err.what().c_str());
+	gason::JsonParser parser;
+	auto root = parser.Parse(ser.Slice());
+	for (const auto& index : root["indexes"]) {
+		const auto name = index["name"].As<std::string_view>();
+		if (name != "year" && name != "id") continue;
+		const auto& cache = index["idset_cache"];
+		const double hits = cache["hits_count"].As<int64_t>();
+		const double lookups = hits + cache["misses_count"].As<int64_t>();
+		state.counters[std::string(name) + "_hit_rate"] = lookups > 0 ? hits / lookups : 0.0;
+		state.counters[std::string(name) + "_rejected"] = cache["rejected_count"].As<int64_t>();
+	}
+}
+
+void ApiTvSimple::SelectColumnsPayload(benchmark::State& state) { selectColumns(state, false); }
+void ApiTvSimple::SelectColumnsIndexOnly(benchmark::State& state) { selectColumns(state, true); }
+
+void ApiTvSimple::selectColumns(benchmark::State& state, bool indexOnly) {
+	AllocsTracker allocsTracker(state);
+	reindexer::WrSerializer ser;
+	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
+		const int startYear = random<int>(2000, 2040);
+		Query q(nsdef_.name);
+		q.Select({"rating", "views"}).Where("year", CondRange, {startYear, startYear + 5}).Limit(1000);
+		if (indexOnly) q.IndexOnly();
+
+		QueryResults qres;
+		auto err = db_->Select(q, qres);
+		if (!err.ok()) state.SkipWithError(err.what().c_str());
+		for (auto& it : qres) {
+			ser.Reset();
+			err = it.GetJSON(ser, false);
+			if (!err.ok()) state.SkipWithError(err.what().c_str());
+		}
+	}
+}
+
 void ApiTvSimple::query2CondIdSet(benchmark::State& state, const std::vector<std::vector<int>>& idsets) {
 	AllocsTracker allocsTracker(state);
 	unsigned counter = 0;
@@ -21,7 +21,9 @@ public:
 			.AddIndex("end_time", "hash", "int", IndexOpts())
 			.AddIndex("start_time", "tree", "int", IndexOpts())
 			.AddIndex("uuid", "hash", "uuid", IndexOpts())
-			.AddIndex("uuid_str", "hash", "string", IndexOpts());
+			.AddIndex("uuid_str", "hash", "string", IndexOpts())
+			.AddIndex("rating", "-", "int", IndexOpts().Column())
+			.AddIndex("views", "-", "int64", IndexOpts().Column());
 	}
 
 	void RegisterAllCases();
@@ -32,11 +34,12 @@ private:
 	public:
 		constexpr static unsigned kVeryLargeHitsValue = 1000000;
 
-		IndexCacheSetter(reindexer::Reindexer& db, unsigned hitsCount = kVeryLargeHitsValue) : db_(db) {
+		IndexCacheSetter(reindexer::Reindexer& db, unsigned hitsCount = kVeryLargeHitsValue, int64_t cacheSize = kDefaultCacheSize)
+			: db_(db) {
 			shrinkCache();
-			setHitsCount(hitsCount);
+			setHitsCount(hitsCount, cacheSize);
 		}
-		~IndexCacheSetter() { setHitsCount(kDefaultCacheHits); }
+		~IndexCacheSetter() { setHitsCount(kDefaultCacheHits, kDefaultCacheSize); }
 
 	private:
 		constexpr static int64_t kDefaultCacheSize = 134217728;
@@ -50,10 +53,10 @@ private:
 			assertrx(err.ok());
 			assertrx(qr.Count() == 1);
 		}
-		void setHitsCount(unsigned hitsCount) {
-			// Set required hits count and default cache size
+		void setHitsCount(unsigned hitsCount, int64_t cacheSize) {
+			// Set required hits count and cache size
 			auto q = reindexer::Query("#config")
-						 .Set("namespaces.cache.index_idset_cache_size", kDefaultCacheSize)
+						 .Set("namespaces.cache.index_idset_cache_size", cacheSize)
 						 .Set("namespaces.cache.index_idset_hits_to_cache", int64_t(hitsCount))
 						 .Where("type", CondEq, "namespaces");
 			reindexer::QueryResults qr;
@@ -128,14 +131,24 @@ private:
 	void FromCJSONPKOnly(State&);
 	void GetCJSON(State&);
 	void ExtractField(State&);
+	void ExtractFieldByEncoder(State&);
+	void ExtractFieldBySkipScan(State&);
+	void SerializeResultsCopy(State&);
+	void SerializeResultsToChunk(State&);
 	void Query4CondRangeDropCache(State& state);
 	void Query4CondRangeDropCacheTotal(State& state);
 	void Query4CondRangeDropCacheCachedTotal(State& state);
+	void IdSetCacheSkewedWorkload(State& state);
 	void SubQueryEq(State&);
 	void SubQuerySet(State&);
 	void SubQueryAggregate(State&);
+	void UpdateByExpression(State&);
+	void SelectColumnsPayload(State&);
+	void SelectColumnsIndexOnly(State&);
 
 	void query2CondIdSet(State& state, const std::vector<std::vector<int>>& idsets);
+	void extractFieldFromPayload(State& state, bool skipScan);
+	void selectColumns(State& state, bool indexOnly);
 	reindexer::Error prepareCJsonBench();
 
 	std::vector<std::string> countries_;
@@ -164,5 +177,6 @@ private:
 	std::unique_ptr<reindexer::Item> itemForCjsonBench_;
 	std::vector<std::string> fieldsToExtract_;
 	constexpr static int kCjsonBenchItemID = 9973;
+	constexpr static int kUpdateByExpressionItems = 1000;
 	std::string cjsonOfItem_;
 };
@@ -0,0 +1,175 @@
+#include "tuples_compression.h"
+#include "core/cjson/jsonbuilder.h"
+#include "core/payload/tuplescompressor.h"
+#include "gason/gason.h"
+
+using reindexer::Query;
+using reindexer::QueryResults;
+
+constexpr int kHotItemsCount = 500;
+
+void TuplesCompression::RegisterAllCases() {
+	// NOLINTBEGIN(*cplusplus.NewDeleteLeaks)
+	Register("Insert" + std::to_string(id_seq_->Count()), &TuplesCompression::Insert, this)->Iterations(1);
+	Register("GetByIDRange", &TuplesCompression::GetByIDRange, this);
+	Register("GetHotByID", &TuplesCompression::GetHotByID, this);
+	Register("FullScanNonIndexed", &TuplesCompression::FullScanNonIndexed, this)->Iterations(10);
+	Register("MemStat", &TuplesCompression::MemStat, this)->Iterations(1);
+	if (!compressed_) {
+		// Tuples of the different sizes: from the small ones with the attributes only to the ones with the long description
+		Register("CompressionRatio", &TuplesCompression::CompressionRatio, this)
+			->Arg(0)
+			->Arg(10)
+			->Arg(30)
+			->Arg(100)
+			->Arg(300)
+			->Iterations(1000);
+	}
+	// NOLINTEND(*cplusplus.NewDeleteLeaks)
+}
+
+reindexer::Error TuplesCompression::Initialize() {
+	assertrx(db_);
+	words_.reserve(200);
+	for (int i = 0; i < 200; ++i) {
+		words_.emplace_back(RandString());
+	}
+	return db_->AddNamespace(nsdef_);
+}
+
+reindexer::Item TuplesCompression::MakeItem(benchmark::State& state) { return makeItem(state, 100); }
+
+reindexer::Item TuplesCompression::makeItem(benchmark::State& state, int descriptionWords) {
+	reindexer::Item item = db_->NewItem(nsdef_.name);
+	// All strings passed to item must be holded by app
+	item.Unsafe();
+
+	wrSer_.Reset();
+	reindexer::JsonBuilder bld(wrSer_);
+	bld.Put("id", id_seq_->Next());
+	bld.Put("year", rand() % 50 + 2000);
+	bld.Put("category", rand() % 50);
+	std::string description;
+	for (int i = 0; i < descriptionWords; ++i) {
+		description += words_[rand() % words_.size()];
+		description += ' ';
+	}
+	bld.Put("description", description);
+	{
+		auto attrs = bld.Object("attributes");
+		attrs.Put("color", words_[rand() % 10]);
+		attrs.Put("size", words_[rand() % 10]);
+		attrs.Put("vendor", words_[rand() % words_.size()]);
+	}
+	auto tags = bld.Array("tags");
+	for (int i = 0, s = rand() % 10 + 5; i < s; ++i) {
+		tags.Put({}, words_[rand() % 30]);
+	}
+	tags.End();
+	bld.End();
+	const auto err = item.FromJSON(wrSer_.Slice());
+	if (!err.ok()) state.SkipWithError(err.what().c_str());
+	return item;
+}
+
+reindexer::Error TuplesCompression::setCompression(const std::string& mode) {
+	auto q = Query("#config").Set("namespaces.tuples_compression", mode).Where("type", CondEq, "namespaces");
+	QueryResults qr;
+	return db_->Update(q, qr);
+}
+
+// FIXTURES
+
+void TuplesCompression::Insert(State& state) {
+	// Compression mode affects only inserted tuples, so it's enabled for this namespace's insertion only
+	if (compressed_) {
+		auto err = setCompression("snappy");
+		if (!err.ok()) state.SkipWithError(err.what().c_str());
+	}
+	BaseFixture::Insert(state);
+	if (compressed_) {
+		auto err = setCompression("none");
+		if (!err.ok()) state.SkipWithError(err.what().c_str());
+	}
+}
+
+void TuplesCompression::GetByIDRange(State& state) {
+	benchmark::AllocsTracker allocsTracker(state);
+	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
+		auto idRange = id_seq_->GetRandomIdRange(100);
+		Query q(nsdef_.name);
+		q.Where("id", CondRange, {idRange.first, idRange.second});
+		QueryResults qres;
+		auto err = db_->Select(q, qres);
+		if (!err.ok()) state.SkipWithError(err.what().c_str());
+		for (auto& it : qres) {
+			wrSer_.Reset();
+			err = it.GetJSON(wrSer_, false);
+			if (!err.ok()) state.SkipWithError(err.what().c_str());
+		}
+	}
+}
+
+void TuplesCompression::GetHotByID(State& state) {
+	benchmark::AllocsTracker allocsTracker(state);
+	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
+		Query q(nsdef_.name);
+		q.Where("id", CondEq, rand() % kHotItemsCount + 1);
+		QueryResults qres;
+		auto err = db_->Select(q, qres);
+		if (!err.ok()) state.SkipWithError(err.what().c_str());
+		if (qres.Count() != 1) state.SkipWithError("Unexpected results count");
+		wrSer_.Reset();
+		err = qres.begin().GetJSON(wrSer_, false);
+		if (!err.ok()) state.SkipWithError(err.what().c_str());
+	}
+}
+
+void TuplesCompression::FullScanNonIndexed(State& state) {
+	benchmark::AllocsTracker allocsTracker(state);
+	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
+		Query q(nsdef_.name);
+		q.Where("category", CondEq, rand() % 50).Where("attributes.color", CondEq, words_[rand() % 10]).Limit(20);
+		QueryResults qres;
+		auto err = db_->Select(q, qres);
+		if (!err.ok()) state.SkipWithError(err.what().c_str());
+	}
+}
+
+void TuplesCompression::MemStat(State& state) {
+	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
+		QueryResults qres;
+		auto err = db_->Select(Query("#memstats").Where("name", CondEq, nsdef_.name), qres);
+		if (!err.ok()) state.SkipWithError(err.what().c_str());
+		if (qres.Count() != 1) state.SkipWithError("Unexpected results count");
+		wrSer_.Reset();
+		err = qres.begin().GetJSON(wrSer_, false);
+		if (!err.ok()) state.SkipWithError(err.what().c_str());
+		gason::JsonParser parser;
+		auto total = parser.Parse(wrSer_.Slice())["total"];
+		state.counters["data_size"] = total["data_size"].As<int64_t>();
+		state.counters["cache_size"] = total["cache_size"].As<int64_t>();
+	}
+}
+
+void TuplesCompression::CompressionRatio(State& state) {
+	reindexer::TuplesCompressor compressor;
+	compressor.Configure(true, 0, 0);
+	size_t rawSize = 0, storedSize = 0, compressedCount = 0;
+	std::string compressed;
+	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
+		auto item = makeItem(state, state.range(0));
+		const std::string_view tuple = item.GetCJSON();
+		rawSize += tuple.size();
+		if (compressor.Compress(tuple, compressed)) {
+			storedSize += compressed.size();
+			++compressedCount;
+		} else {
+			storedSize += tuple.size();
+		}
+	}
+	state.counters["avg_raw_size"] = double(rawSize) / state.iterations();
+	state.counters["avg_stored_size"] = double(storedSize) / state.iterations();
+	state.counters["ratio"] = double(rawSize) / storedSize;
+	state.counters["compressed_share"] = double(compressedCount) / state.iterations();
+}
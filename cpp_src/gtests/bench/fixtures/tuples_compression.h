@@ -0,0 +1,36 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "base_fixture.h"
+
+// Compares selects from the namespaces with raw and compressed (snappy) tuples
+class TuplesCompression : private BaseFixture {
+public:
+	~TuplesCompression() override = default;
+	TuplesCompression(Reindexer* db, const std::string& name, size_t maxItems, bool compressed)
+		: BaseFixture(db, name, maxItems), compressed_(compressed) {
+		nsdef_.AddIndex("id", "hash", "int", IndexOpts().PK()).AddIndex("year", "tree", "int", IndexOpts());
+	}
+
+	void RegisterAllCases();
+	reindexer::Error Initialize() override;
+
+private:
+	reindexer::Item MakeItem(benchmark::State&) override;
+	reindexer::Item makeItem(benchmark::State&, int descriptionWords);
+
+	void Insert(State& state);
+	void GetByIDRange(State& state);
+	void GetHotByID(State& state);
+	void FullScanNonIndexed(State& state);
+	void MemStat(State& state);
+	void CompressionRatio(State& state);
+
+	reindexer::Error setCompression(const std::string& mode);
+
+	const bool compressed_;
+	std::vector<std::string> words_;
+	reindexer::WrSerializer wrSer_;
+};
@@ -9,6 +9,7 @@
 #include "api_tv_simple_sparse.h"
 #include "geometry.h"
 #include "join_items.h"
+#include "tuples_compression.h"
 #include "tools/reporter.h"
 
 #include "tools/fsops.h"
@@ -50,6 +51,8 @@ int main(int argc, char** argv) {
 	ApiTvComposite apiTvComposite(DB.get(), "ApiTvComposite", kItemsInBenchDataset);
 	Geometry geometry(DB.get(), "Geometry", kItemsInBenchDataset);
 	Aggregation aggregation(DB.get(), "Aggregation", kItemsInBenchDataset);
+	TuplesCompression tuplesRaw(DB.get(), "TuplesRaw", kItemsInComparatorsBenchDataset, false);
+	TuplesCompression tuplesCompressed(DB.get(), "TuplesCompressed", kItemsInComparatorsBenchDataset, true);
 
 	err = apiTvSimple.Initialize();
 	if (!err.ok()) return err.code();
@@ -72,6 +75,12 @@ int main(int argc, char** argv) {
 	err = aggregation.Initialize();
 	if (!err.ok()) return err.code();
 
+	err = tuplesRaw.Initialize();
+	if (!err.ok()) return err.code();
+
+	err = tuplesCompressed.Initialize();
+	if (!err.ok()) return err.code();
+
 	::benchmark::Initialize(&argc, argv);
 	if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
 
@@ -82,6 +91,8 @@ int main(int argc, char** argv) {
 	apiTvComposite.RegisterAllCases();
 	geometry.RegisterAllCases();
 	aggregation.RegisterAllCases();
+	tuplesRaw.RegisterAllCases();
+	tuplesCompressed.RegisterAllCases();
 
 	::benchmark::RunSpecifiedBenchmarks();
 }
@@ -14,13 +14,15 @@
 namespace benchmark {
 
 struct AllocsTracker {
-	enum PrintOpts { kNoPrint = 1 << 0, kPrintAllocs = 1 << 1, kPrintHold = 1 << 2 };
+	enum PrintOpts { kNoPrint = 1 << 0, kPrintAllocs = 1 << 1, kPrintHold = 1 << 2, kPrintLargeAllocs = 1 << 3 };
 
 	AllocsTracker(State& state, uint8_t printFlags = kPrintAllocs)
 		: total_sz(get_alloc_size_total()),
 		  total_cnt(get_alloc_cnt_total()),
 		  held_mem(get_alloc_size()),
 		  held_allocs(get_alloc_cnt()),
+		  large_sz(get_large_alloc_size_total()),
+		  large_cnt(get_large_alloc_cnt_total()),
 		  state(state),
 		  flags(printFlags) {
 		init();
@@ -39,6 +41,12 @@ struct AllocsTracker {
 			state.counters["HeldMem/Op"] = (get_alloc_size() - held_mem) / state.iterations();
 			state.counters["HeldA/Op"] = (diff < 0 ? 0 : diff) / state.iterations();
 		}
+
+		// Allocations of kLargeAllocSize and larger (large buffers reallocations)
+		if (flags & kPrintLargeAllocs) {
+			state.counters["LargeBytes/Op"] = (get_large_alloc_size_total() - large_sz) / state.iterations();
+			state.counters["LargeA/Op"] = double(get_large_alloc_cnt_total() - large_cnt) / state.iterations();
+		}
 	}
 
 	size_t GetCurrentMemoryConsumption() { return get_alloc_size_total() - total_sz; }
@@ -47,6 +55,7 @@ struct AllocsTracker {
 protected:
 	size_t total_sz, total_cnt;
 	size_t held_mem, held_allocs;
+	size_t large_sz, large_cnt;
 	State& state;
 	uint8_t flags;
 
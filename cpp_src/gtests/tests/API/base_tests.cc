@@ -1614,7 +1614,7 @@ TEST_F(ReindexerApi, SchemaSuggestions) {
 		{"select * f", {"from"}},
 		{"select * from ",
 		 {"test_namespace", "second_ns", "#memstats", "#activitystats", "#config", "#queriesperfstats", "#namespaces", "#perfstats",
-		  "#clientsstats"}},
+		  "#schedulerstats", "#clientsstats"}},
 		{"select * from te", {"test_namespace"}},
 		{"select * from test_namespace ",
 		 {"where", ";", "equal_position", "inner", "join", "left", "limit", "merge", "offset", "or", "order"}},
@@ -1638,7 +1638,7 @@ TEST_F(ReindexerApi, SchemaSuggestions) {
 		{"select * from test_namespace where Countries == (select second_field f", {"from"}},
 		{"select * from test_namespace where Countries == (select second_field from ",
 		 {"test_namespace", "second_ns", "#memstats", "#activitystats", "#config", "#queriesperfstats", "#namespaces", "#perfstats",
-		  "#clientsstats"}},
+		  "#schedulerstats", "#clientsstats"}},
 		{"select * from test_namespace where Countries == (select second_field from s", {"second_ns"}},
 		{"select * from test_namespace where i", {"inner"}},
 		{"select * from test_namespace where inner j", {"join"}},
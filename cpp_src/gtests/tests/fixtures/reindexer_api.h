@@ -1,5 +1,7 @@
 #pragma once
 
+#include "core/cjson/jsonbuilder.h"
+#include "core/defnsconfigs.h"
 #include "core/reindexer.h"
 #include "reindexertestapi.h"
 #include "servercontrol.h"
@@ -48,6 +50,23 @@ public:
 	std::string RandLikePattern() { return rt.RandLikePattern(); }
 	std::string RuRandString() { return rt.RuRandString(); }
 	std::vector<int> RandIntVector(size_t size, int start, int range) { return rt.RandIntVector(size, start, range); }
+	// Upserts the namespace's config into #config. Config's options are put by the callback
+	void SetNamespaceConfig(std::string_view ns, const std::function<void(reindexer::JsonBuilder &)> &putOptions) {
+		reindexer::WrSerializer ser;
+		{
+			reindexer::JsonBuilder jb(ser);
+			jb.Put("type", "namespaces");
+			auto nsArray = jb.Array("namespaces");
+			auto nsConfig = nsArray.Object();
+			nsConfig.Put("namespace", ns);
+			putOptions(nsConfig);
+		}
+		Item item = NewItem(reindexer::kConfigNamespace);
+		ASSERT_TRUE(item.Status().ok()) << item.Status().what();
+		auto err = item.FromJSON(ser.Slice());
+		ASSERT_TRUE(err.ok()) << err.what();
+		Upsert(reindexer::kConfigNamespace, item);
+	}
 	void AwaitIndexOptimization(const std::string &nsName) {
 		bool optimization_completed = false;
 		unsigned waitForIndexOptimizationCompleteIterations = 0;
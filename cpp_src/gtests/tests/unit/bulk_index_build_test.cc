@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+#include "reindexer_api.h"
+#include "tools/fsops.h"
+
+// Ordered sparse and composite indexes, created over the existing data, are filled by the bulk insertion
+TEST_F(ReindexerApi, BulkIndexBuildOnIndexCreation) {
+	constexpr int kItemsCount = 5000;
+	DefineNamespaceDataset(default_namespace, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+											   IndexDeclaration{"value", "tree", "int", IndexOpts(), 0}});
+	for (int i = 0; i < kItemsCount; ++i) {
+		std::string json = "{\"id\":" + std::to_string(i) + ",\"value\":" + std::to_string(i % 100) + ",\"name\":\"name_" +
+						   std::to_string((i * 7) % 300) + "\"";
+		if (i % 5 == 0) {
+			json += ",\"arr\":[" + std::to_string(i % 11) + ',' + std::to_string(i % 13) + ']';
+		} else if (i % 5 == 1) {
+			json += ",\"arr\":[]";
+		} else if (i % 5 != 2) {
+			json += ",\"arr\":" + std::to_string(i % 17);
+		}
+		Item item = NewItem(default_namespace);
+		auto err = item.FromJSON(json + '}');
+		ASSERT_TRUE(err.ok()) << err.what();
+		Upsert(default_namespace, item);
+	}
+	// Deleted items leave free rowIds in the namespace
+	QueryResults qrDel;
+	auto err = rt.reindexer->Delete(Query(default_namespace).Where("id", CondRange, {Variant{1000}, Variant{1999}}), qrDel);
+	ASSERT_TRUE(err.ok()) << err.what();
+
+	err = rt.reindexer->AddIndex(default_namespace, reindexer::IndexDef{"name", "tree", "string", IndexOpts().Sparse()});
+	ASSERT_TRUE(err.ok()) << err.what();
+	err = rt.reindexer->AddIndex(default_namespace, reindexer::IndexDef{"arr", "tree", "int", IndexOpts().Sparse().Array()});
+	ASSERT_TRUE(err.ok()) << err.what();
+	err = rt.reindexer->AddIndex(default_namespace, reindexer::IndexDef{"value+id", {"value", "id"}, "tree", "composite", IndexOpts()});
+	ASSERT_TRUE(err.ok()) << err.what();
+
+	const auto check = [&](const Query &q, auto &&pred) {
+		QueryResults qr;
+		auto err = rt.reindexer->Select(q, qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		int expected = 0;
+		for (int i = 0; i < kItemsCount; ++i) {
+			if ((i < 1000 || i >= 2000) && pred(i)) ++expected;
+		}
+		ASSERT_EQ(qr.Count(), expected) << q.GetSQL();
+		int prevId = -1;
+		for (auto &it : qr) {
+			Item item = it.GetItem(false);
+			const int id = item["id"].As<int>();
+			ASSERT_TRUE(pred(id)) << q.GetSQL() << "; id = " << id;
+			ASSERT_GT(id, prevId) << q.GetSQL();
+			prevId = id;
+		}
+	};
+	check(Query(default_namespace).Where("name", CondEq, "name_7").Sort("id", false), [](int i) { return (i * 7) % 300 == 7; });
+	check(Query(default_namespace).Where("name", CondLt, "name_2").Sort("id", false),
+		  [](int i) { return "name_" + std::to_string((i * 7) % 300) < "name_2"; });
+	check(Query(default_namespace).Where("arr", CondEq, 3).Sort("id", false), [](int i) {
+		return (i % 5 == 0 && (i % 11 == 3 || i % 13 == 3)) || (i % 5 > 2 && i % 17 == 3);
+	});
+	check(Query(default_namespace).Where("arr", CondEmpty, VariantArray{}).Sort("id", false), [](int i) { return i % 5 == 1 || i % 5 == 2; });
+	check(Query(default_namespace)
+			  .WhereComposite("value+id", CondGe, {{Variant{50}, Variant{4000}}})
+			  .WhereComposite("value+id", CondLt, {{Variant{60}, Variant{0}}})
+			  .Sort("id", false),
+		  [](int i) { return (i % 100 == 50 && i >= 4000) || (i % 100 > 50 && i % 100 < 60); });
+
+	// Sort by the new indexes
+	QueryResults qr;
+	err = rt.reindexer->Select(Query(default_namespace).Where("arr", CondGt, 15).Sort("arr", false), qr);
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_GT(qr.Count(), 0);
+	for (auto &it : qr) {
+		Item item = it.GetItem(false);
+		ASSERT_EQ(item["arr"].As<int>(), 16);
+	}
+}
+
+// Payload values of the non-sparse numeric ordered indexes are set directly from the keys, when those indexes are filled by the bulk
+// insertion. This happens on the index creation and on the loading from the storage
+TEST_F(ReindexerApi, BulkIndexBuildForNumericIndexes) {
+	using reindexer::fs::GetTempDir;
+	using reindexer::fs::JoinPath;
+	constexpr int kItemsCount = 5000;
+	const std::string kDir = JoinPath(GetTempDir(), "ReindexerApi/BulkIndexBuildForNumericIndexes");
+	reindexer::fs::RmDirAll(kDir);
+	auto rx = std::make_unique<Reindexer>();
+	auto err = rx->Connect("builtin://" + kDir);
+	ASSERT_TRUE(err.ok()) << err.what();
+	err = rx->OpenNamespace(default_namespace, StorageOpts().Enabled().CreateIfMissing());
+	ASSERT_TRUE(err.ok()) << err.what();
+	err = rx->AddIndex(default_namespace, reindexer::IndexDef{"id", "hash", "int", IndexOpts().PK()});
+	ASSERT_TRUE(err.ok()) << err.what();
+	const auto upsert = [&](int from, int to) {
+		for (int i = from; i < to; ++i) {
+			std::string json = "{\"id\":" + std::to_string(i) + ",\"value\":" + std::to_string((i * 7) % 100) +
+							   ",\"dvalue\":" + std::to_string(i % 10) + ".5";
+			if (i % 3 == 0) {
+				json += ",\"arr\":[" + std::to_string(i % 11) + ',' + std::to_string(i % 13) + ']';
+			} else if (i % 3 == 1) {
+				json += ",\"arr\":[]";
+			}
+			Item item = rx->NewItem(default_namespace);
+			ASSERT_TRUE(item.Status().ok()) << item.Status().what();
+			auto err = item.FromJSON(json + '}');
+			ASSERT_TRUE(err.ok()) << err.what();
+			err = rx->Upsert(default_namespace, item);
+			ASSERT_TRUE(err.ok()) << err.what();
+		}
+	};
+	upsert(0, kItemsCount);
+	// Deleted items leave free rowIds in the namespace
+	QueryResults qrDel;
+	err = rx->Delete(Query(default_namespace).Where("id", CondRange, {Variant{1000}, Variant{1999}}), qrDel);
+	ASSERT_TRUE(err.ok()) << err.what();
+
+	err = rx->AddIndex(default_namespace, reindexer::IndexDef{"value", "tree", "int", IndexOpts()});
+	ASSERT_TRUE(err.ok()) << err.what();
+	err = rx->AddIndex(default_namespace, reindexer::IndexDef{"dvalue", "tree", "double", IndexOpts()});
+	ASSERT_TRUE(err.ok()) << err.what();
+	err = rx->AddIndex(default_namespace, reindexer::IndexDef{"arr", "tree", "int", IndexOpts().Array()});
+	ASSERT_TRUE(err.ok()) << err.what();
+
+	const auto check = [&](const Query &q, auto &&pred) {
+		QueryResults qr;
+		auto err = rx->Select(q, qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		int expected = 0;
+		for (int i = 0; i < kItemsCount; ++i) {
+			if ((i < 1000 || i >= 2000) && pred(i)) ++expected;
+		}
+		ASSERT_EQ(qr.Count(), expected) << q.GetSQL();
+		int prevId = -1;
+		for (auto &it : qr) {
+			Item item = it.GetItem(false);
+			const int id = item["id"].As<int>();
+			ASSERT_TRUE(pred(id)) << q.GetSQL() << "; id = " << id;
+			ASSERT_EQ(item["value"].As<int>(), (id * 7) % 100) << q.GetSQL() << "; id = " << id;
+			ASSERT_EQ(item["dvalue"].As<double>(), id % 10 + 0.5) << q.GetSQL() << "; id = " << id;
+			ASSERT_GT(id, prevId) << q.GetSQL();
+			prevId = id;
+		}
+	};
+	const auto checkAll = [&] {
+		check(Query(default_namespace).Where("value", CondEq, 14).Sort("id", false), [](int i) { return (i * 7) % 100 == 14; });
+		check(Query(default_namespace).Where("value", CondLt, 10).Sort("id", false), [](int i) { return (i * 7) % 100 < 10; });
+		check(Query(default_namespace).Where("dvalue", CondGt, 8.0).Sort("id", false), [](int i) { return i % 10 > 8; });
+		check(Query(default_namespace).Where("arr", CondEq, 3).Sort("id", false),
+			  [](int i) { return i % 3 == 0 && (i % 11 == 3 || i % 13 == 3); });
+		check(Query(default_namespace).Where("arr", CondEmpty, VariantArray{}).Sort("id", false), [](int i) { return i % 3 != 0; });
+
+		// Sort by the numeric indexes
+		QueryResults qr;
+		auto err = rx->Select(Query(default_namespace).Where("value", CondGe, 95).Sort("value", true).Sort("dvalue", false), qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		ASSERT_GT(qr.Count(), 0);
+		int prevValue = 100;
+		for (auto &it : qr) {
+			Item item = it.GetItem(false);
+			const int value = item["value"].As<int>();
+			ASSERT_LE(value, prevValue);
+			ASSERT_GE(value, 95);
+			prevValue = value;
+		}
+	};
+	checkAll();
+
+	// Index keys are still consistent with the payloads after the updates
+	QueryResults qrUpd;
+	err = rx->Update(Query(default_namespace).Where("id", CondLt, 100).Set("value", {Variant{1000}}), qrUpd);
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_EQ(qrUpd.Count(), 100);
+	QueryResults qrUpdated;
+	err = rx->Select(Query(default_namespace).Where("value", CondEq, 1000), qrUpdated);
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_EQ(qrUpdated.Count(), 100);
+	upsert(0, 100);
+	checkAll();
+
+	// Items loader uses the same bulk insertion
+	rx = std::make_unique<Reindexer>();
+	err = rx->Connect("builtin://" + kDir);
+	ASSERT_TRUE(err.ok()) << err.what();
+	err = rx->OpenNamespace(default_namespace);
+	ASSERT_TRUE(err.ok()) << err.what();
+	checkAll();
+}
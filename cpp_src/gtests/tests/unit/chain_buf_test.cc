@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include "estl/chunk_buf.h"
+#include "estl/mutex.h"
+
+using reindexer::chain_buf;
+using reindexer::chain_buf_spares;
+using reindexer::chunk;
+using reindexer::dummy_mutex;
+
+static chunk makeChunk(size_t cap) { return chunk(new uint8_t[cap], 0, cap); }
+
+TEST(ChainBufTest, SpareChunkIsUsedForLargeDataOnly) {
+	constexpr size_t kSpareCap = reindexer::kChainBufMaxSpareChunkCap;
+	chain_buf<dummy_mutex> buf(16);
+	buf.recycle(makeChunk(kSpareCap));
+
+	// Small data must not take the spare chunk
+	chunk small = buf.get_chunk(100);
+	ASSERT_NE(small.capacity(), kSpareCap);
+	chunk large = buf.get_chunk(reindexer::kChainBufMaxFreeChunkCap);
+	ASSERT_EQ(large.capacity(), kSpareCap);
+	// There is no spare chunk, until the large one is recycled
+	ASSERT_NE(buf.get_chunk(reindexer::kChainBufMaxFreeChunkCap).capacity(), kSpareCap);
+
+	large.append(std::string_view("data"));
+	buf.write(std::move(large));
+	buf.erase(buf.data_size());
+	ASSERT_EQ(buf.get_chunk(kSpareCap).capacity(), kSpareCap);
+}
+
+TEST(ChainBufTest, SpareChunksTotalSizeIsBounded) {
+	constexpr size_t kSpareCap = reindexer::kChainBufMaxSpareChunkCap;
+	constexpr size_t kBuffersCount = 2 * reindexer::kChainBufMaxSpareChunksTotalCap / kSpareCap;
+	const size_t initialTotal = chain_buf_spares::total();
+	{
+		std::vector<std::unique_ptr<chain_buf<dummy_mutex>>> buffers;
+		size_t sparesCount = 0;
+		for (size_t i = 0; i < kBuffersCount; ++i) {
+			buffers.emplace_back(std::make_unique<chain_buf<dummy_mutex>>(16));
+			buffers.back()->recycle(makeChunk(kSpareCap));
+			if (buffers.back()->get_chunk(kSpareCap).capacity() == kSpareCap) {
+				++sparesCount;
+				buffers.back()->recycle(makeChunk(kSpareCap));
+			}
+			ASSERT_LE(chain_buf_spares::total(), reindexer::kChainBufMaxSpareChunksTotalCap);
+		}
+		ASSERT_GT(sparesCount, 0);
+		ASSERT_LT(sparesCount, kBuffersCount);
+
+		// Spare chunk is released on clear
+		const size_t total = chain_buf_spares::total();
+		buffers.front()->clear();
+		ASSERT_EQ(chain_buf_spares::total(), total - kSpareCap);
+	}
+	// And on destruction
+	ASSERT_EQ(chain_buf_spares::total(), initialTotal);
+}
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include <set>
+#include "core/cjson/jsonbuilder.h"
+#include "reindexer_api.h"
+
+TEST_F(ReindexerApi, ChunkedUpdateDeleteQueries) {
+	constexpr int kItemsCount = 2000;
+	constexpr int kChunkSize = 150;
+	DefineNamespaceDataset(default_namespace, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+											   IndexDeclaration{"value", "tree", "int", IndexOpts(), 0}});
+	SetNamespaceConfig(default_namespace, [&](reindexer::JsonBuilder &cfg) { cfg.Put("upd_del_chunk_size", kChunkSize); });
+	for (int i = 0; i < kItemsCount; ++i) {
+		Item item = NewItem(default_namespace);
+		auto err = item.FromJSON("{\"id\":" + std::to_string(i) + ",\"value\":" + std::to_string(i % 100) + ",\"data\":\"initial\"}");
+		ASSERT_TRUE(err.ok()) << err.what();
+		Upsert(default_namespace, item);
+	}
+
+	// Condition on the modified field has to be re-validated for each chunk
+	QueryResults qrUpd;
+	auto err = rt.reindexer->Update(Query(default_namespace).Where("value", CondLt, 50).Set("value", 500).Set("data", "updated"), qrUpd);
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_EQ(qrUpd.Count(), kItemsCount / 2);
+	std::set<int> ids;
+	for (auto &it : qrUpd) {
+		Item item = it.GetItem(false);
+		ASSERT_EQ(item["value"].As<int>(), 500);
+		ASSERT_EQ(item["data"].As<std::string>(), "updated");
+		ASSERT_TRUE(ids.emplace(item["id"].As<int>()).second);
+	}
+
+	// Query with top-level OR is executed at once
+	QueryResults qrOr;
+	err = rt.reindexer->Update(
+		Query(default_namespace).Where("value", CondEq, 500).Or().Where("id", CondRange, {Variant{50}, Variant{59}}).Set("data", "or"),
+		qrOr);
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_EQ(qrOr.Count(), kItemsCount / 2 + 10);
+
+	QueryResults qrDel;
+	err = rt.reindexer->Delete(Query(default_namespace).Where("value", CondGe, 75), qrDel);
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_EQ(qrDel.Count(), kItemsCount / 2 + kItemsCount / 4);
+	for (auto &it : qrDel) {
+		Item item = it.GetItem(false);
+		ASSERT_GE(item["value"].As<int>(), 75);
+	}
+
+	QueryResults qr;
+	err = rt.reindexer->Select(Query(default_namespace).Sort("id", false), qr);
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_EQ(qr.Count(), kItemsCount / 4);
+	for (auto &it : qr) {
+		Item item = it.GetItem(false);
+		const int value = item["value"].As<int>();
+		ASSERT_GE(value, 50);
+		ASSERT_LT(value, 75);
+		const int id = item["id"].As<int>();
+		ASSERT_EQ(item["data"].As<std::string>(), (id >= 50 && id < 60) ? "or" : "initial") << id;
+	}
+}
@@ -240,6 +240,34 @@ TEST_F(CompositeIndexesApi, SelectsBySubIndexes) {
 	}
 }
 
+TEST_F(CompositeIndexesApi, SubstitutionPlanCacheInvalidation) {
+	// Substitution plans are cached per query shape, so the indexes changes have to invalidate them
+	fillNamespace(0, 100);
+	const std::string compositeName = getCompositeIndexName({kFieldNamePrice, kFieldNamePages});
+	const std::string compositeSelector = "\"field\":\"" + compositeName + "\"";
+	auto checkSubstitution = [&](bool expectComposite) {
+		// More executions, than required to put the plan into the cache
+		for (int i = 0; i < 5; ++i) {
+			const int price = rand() % 1000 + 100, pages = rand() % 1000 + 10;
+			auto qr = execAndCompareQuery(
+				Query(default_namespace).Explain().Where(kFieldNamePrice, CondEq, price).Where(kFieldNamePages, CondEq, pages));
+			for (auto& it : qr) {
+				auto item = it.GetItem();
+				EXPECT_EQ(item[kFieldNamePrice].As<int>(), price);
+				EXPECT_EQ(item[kFieldNamePages].As<int>(), pages);
+			}
+			const auto explain = qr.GetExplainResults();
+			EXPECT_EQ(explain.find(compositeSelector) != std::string::npos, expectComposite) << explain;
+		}
+	};
+
+	checkSubstitution(false);
+	addCompositeIndex({kFieldNamePrice, kFieldNamePages}, CompositeIndexHash, IndexOpts());
+	checkSubstitution(true);
+	dropIndex(compositeName);
+	checkSubstitution(false);
+}
+
 TEST_F(CompositeIndexesApi, CompositeOverCompositeTest) {
 	constexpr char kExpectedErrorPattern[] = "Cannot create composite index '%s' over the other composite '%s'";
 	constexpr size_t stepSize = 10;
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include "gason/gason.h"
+#include "reindexer_api.h"
+
+TEST_F(ReindexerApi, FtBackgroundCommit) {
+	DefineNamespaceDataset(default_namespace, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+											   IndexDeclaration{"ft1", "text", "string", IndexOpts(), 0},
+											   IndexDeclaration{"ft2", "text", "string", IndexOpts(), 0}});
+	auto fill = [&](int from, int to, std::string_view word) {
+		for (int i = from; i < to; ++i) {
+			Item item = NewItem(default_namespace);
+			ASSERT_TRUE(item.Status().ok()) << item.Status().what();
+			auto err = item.FromJSON(fmt::sprintf(R"({"id":%d,"ft1":"%s text","ft2":"%s value"})", i, word, word));
+			ASSERT_TRUE(err.ok()) << err.what();
+			Upsert(default_namespace, item);
+		}
+	};
+	auto ftSizes = [&] {
+		Item memstat = getMemStat(*rt.reindexer, default_namespace);
+		EXPECT_TRUE(memstat.Status().ok()) << memstat.Status().what();
+		const std::string json(memstat.GetJSON());
+		gason::JsonParser parser;
+		std::vector<int64_t> sizes;
+		for (const auto &idx : parser.Parse(std::string_view(json))["indexes"]) {
+			if (idx["name"].As<std::string>().rfind("ft", 0) == 0) sizes.emplace_back(idx["fulltext_size"].As<int64_t>());
+		}
+		EXPECT_EQ(sizes.size(), 2) << json;
+		return sizes;
+	};
+	auto awaitSizes = [&](const std::vector<int64_t> &prevSizes) {
+		std::vector<int64_t> sizes;
+		for (int i = 0; i < 500; ++i) {
+			sizes = ftSizes();
+			if (sizes.size() == 2 && sizes[0] > prevSizes[0] && sizes[1] > prevSizes[1]) break;
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		}
+		return sizes;
+	};
+	auto checkSelect = [&](const std::string &index, const std::string &word, size_t expected) {
+		QueryResults qr;
+		auto err = rt.reindexer->Select(Query(default_namespace).Where(index, CondEq, word), qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		EXPECT_EQ(qr.Count(), expected) << index << ' ' << word;
+	};
+
+	fill(0, 1000, "first");
+	// Fulltext indexes are built by the first query by default
+	std::this_thread::sleep_for(std::chrono::milliseconds(300));
+	auto sizes = ftSizes();
+	ASSERT_EQ(sizes.size(), 2);
+	EXPECT_EQ(sizes[0], 0);
+	EXPECT_EQ(sizes[1], 0);
+
+	SetNamespaceConfig(default_namespace, [](reindexer::JsonBuilder &cfg) { cfg.Put("ft_commit_debounce_ms", 20); });
+	// Both of the indexes are built in background after the next update
+	fill(1000, 1001, "first");
+	sizes = awaitSizes({0, 0});
+	ASSERT_EQ(sizes.size(), 2);
+	ASSERT_GT(sizes[0], 0);
+	ASSERT_GT(sizes[1], 0);
+
+	// Incremental updates are committed in background too
+	fill(1001, 3000, "second");
+	auto updatedSizes = awaitSizes(sizes);
+	ASSERT_EQ(updatedSizes.size(), 2);
+	EXPECT_GT(updatedSizes[0], sizes[0]);
+	EXPECT_GT(updatedSizes[1], sizes[1]);
+
+	checkSelect("ft1", "first", 1001);
+	checkSelect("ft2", "second", 1999);
+	checkSelect("ft1", "text", 3000);
+
+	// Updates, which are done during the background build, are not lost, when the built indexes are swapped in
+	for (int i = 0; i < 10; ++i) {
+		fill(3000 + i * 100, 3000 + (i + 1) * 100, "third");
+		std::this_thread::sleep_for(std::chrono::milliseconds(15 + i * 3));
+	}
+	awaitSizes(updatedSizes);
+	checkSelect("ft1", "third", 1000);
+	checkSelect("ft2", "value", 4000);
+
+	// Queries, which arrive during the background build, wait for it and get its data. Following deletions are applied to this data
+	fill(4000, 4500, "fourth");
+	std::this_thread::sleep_for(std::chrono::milliseconds(25));
+	checkSelect("ft1", "fourth", 500);
+	QueryResults qr;
+	auto err = rt.reindexer->Delete(Query(default_namespace).Where("id", CondGe, 4000).Where("id", CondLt, 4100), qr);
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_EQ(qr.Count(), 100);
+	checkSelect("ft1", "fourth", 400);
+	checkSelect("ft2", "value", 4400);
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "core/idsetcache.h"
+
+using reindexer::IdSet;
+using reindexer::IdSetCache;
+using reindexer::IdSetCacheKey;
+using reindexer::IdSetCacheVal;
+using reindexer::make_intrusive;
+using reindexer::Variant;
+using reindexer::VariantArray;
+
+static IdSet::Ptr makeIdSet(int count) {
+	auto ids = make_intrusive<reindexer::intrusive_atomic_rc_wrapper<IdSet>>();
+	for (int i = 0; i < count; ++i) ids->Add(i, IdSet::Unordered, 0);
+	return ids;
+}
+
+// Returns true, if the expensive entry has survived the flood of the cheap ones
+static bool expensiveEntrySurvives(uint64_t expensiveCost) {
+	constexpr size_t kCacheSize = 16 * 1024;
+	constexpr int kCheapEntries = 500;
+	IdSetCache cache(kCacheSize, 1);
+
+	const VariantArray expensiveKeys{Variant{-1}, Variant{-2}};
+	const IdSetCacheKey expensiveKey(expensiveKeys, CondRange, 0);
+	// Frequently requested entry has to stay visible regardless of the adaptive hits count
+	for (int i = 0; i < 1100; ++i) cache.Get(expensiveKey);
+	cache.Put(expensiveKey, IdSetCacheVal(makeIdSet(100)), expensiveCost);
+
+	for (int i = 0; i < kCheapEntries; ++i) {
+		const VariantArray keys{Variant{i}};
+		const IdSetCacheKey key(keys, CondEq, 0);
+		auto it = cache.Get(key);
+		if (it.valid && !it.val.ids) cache.Put(key, IdSetCacheVal(makeIdSet(10)), expensiveCost ? 1000 : 0);
+	}
+
+	const auto stat = cache.GetMemStat();
+	EXPECT_GT(stat.evictedCount, 0);
+	EXPECT_GT(stat.evictedBytes, 0);
+	EXPECT_LE(stat.totalSize, kCacheSize);
+
+	auto it = cache.Get(expensiveKey);
+	return it.valid && it.val.ids && it.val.ids->size() == 100;
+}
+
+TEST(IdSetCacheTest, CostAwareEviction) {
+	// Without costs cache is plain LRU
+	EXPECT_FALSE(expensiveEntrySurvives(0));
+	// Entry, which is 10000 times more expensive to build, is preferred over the recently used cheap ones
+	EXPECT_TRUE(expensiveEntrySurvives(10'000'000));
+}
+
+TEST(IdSetCacheTest, CheapEntriesAreRejected) {
+	constexpr size_t kCacheSize = 8 * 1024;
+	IdSetCache cache(kCacheSize, 1);
+
+	for (int i = 0; i < 100; ++i) {
+		const VariantArray keys{Variant{i}};
+		const IdSetCacheKey key(keys, CondEq, 0);
+		for (int j = 0; j < 1100; ++j) cache.Get(key);
+		cache.Put(key, IdSetCacheVal(makeIdSet(10)), 10'000'000);
+	}
+	const VariantArray lastKeys{Variant{99}};
+	auto lastIt = cache.Get(IdSetCacheKey(lastKeys, CondEq, 0));
+	ASSERT_TRUE(lastIt.valid && lastIt.val.ids);
+	auto stat = cache.GetMemStat();
+	ASSERT_EQ(stat.rejectedCount, 0);
+	ASSERT_EQ(stat.hitsCount, 1);
+	ASSERT_GT(stat.hitBytes, 0);
+
+	// Cheap and large value does not displace the expensive ones
+	const VariantArray keys{Variant{"cheap"}};
+	const IdSetCacheKey key(keys, CondEq, 0);
+	for (int j = 0; j < 1100; ++j) cache.Get(key);
+	cache.Put(key, IdSetCacheVal(makeIdSet(1000)), 1000);
+	stat = cache.GetMemStat();
+	EXPECT_EQ(stat.rejectedCount, 1);
+	auto it = cache.Get(key);
+	EXPECT_TRUE(it.valid);
+	EXPECT_FALSE(it.val.ids);
+}
@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include "gason/gason.h"
+#include "reindexer_api.h"
+
+TEST_F(ReindexerApi, IndexOnlyScan) {
+	constexpr int kItemsCount = 5000;
+	DefineNamespaceDataset(default_namespace, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK().Column(), 0},
+											   IndexDeclaration{"price", "tree", "double", IndexOpts().Column(), 0},
+											   IndexDeclaration{"stock", "-", "int64", IndexOpts().Column(), 0},
+											   IndexDeclaration{"count", "tree", "int", IndexOpts(), 0},
+											   IndexDeclaration{"name", "hash", "string", IndexOpts(), 0}});
+	auto upsertItem = [&](int id, double price) {
+		Item item = NewItem(default_namespace);
+		ASSERT_TRUE(item.Status().ok()) << item.Status().what();
+		auto err = item.FromJSON(fmt::sprintf(R"({"id":%d,"price":%g,"stock":%d,"count":%d,"name":"name_%d","nested":{"v":%d}})", id, price,
+											  int64_t(id) * 3, id % 100, id, id));
+		ASSERT_TRUE(err.ok()) << err.what();
+		Upsert(default_namespace, item);
+	};
+	for (int i = 0; i < kItemsCount; ++i) upsertItem(i, (i * 7) % 1000 + 0.5);
+	// Updated and deleted items have to be reflected in the columns
+	for (int i = 0; i < kItemsCount; i += 7) upsertItem(i, 2000.5 + i);
+	{
+		VariantArray deleted;
+		for (int i = 1; i < kItemsCount; i += 11) deleted.emplace_back(i);
+		QueryResults qr;
+		auto err = rt.reindexer->Delete(Query(default_namespace).Where("id", CondSet, deleted), qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+	}
+	// Sorting by the tree index uses its sort orders
+	AwaitIndexOptimization(default_namespace);
+
+	auto check = [&](Query &&q, bool expectIndexOnly) {
+		QueryResults expected, qr;
+		Query fullQuery = q;
+		auto err = rt.reindexer->Select(fullQuery.Select({"id", "price", "stock", "name"}), expected);
+		ASSERT_TRUE(err.ok()) << err.what();
+		err = rt.reindexer->Select(q.Explain().IndexOnly(), qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+
+		gason::JsonParser parser;
+		auto explain = parser.Parse(reindexer::giftStr(qr.GetExplainResults()));
+		EXPECT_EQ(explain["index_only"].As<bool>(), expectIndexOnly) << q.GetSQL();
+		ASSERT_EQ(qr.Count(), expected.Count()) << q.GetSQL();
+		reindexer::WrSerializer ser;
+		for (auto it1 = qr.begin(), it2 = expected.begin(); it1 != qr.end(); ++it1, ++it2) {
+			ser.Reset();
+			err = it1.GetJSON(ser, false);
+			ASSERT_TRUE(err.ok()) << err.what();
+			auto json = parser.Parse(reindexer::giftStr(ser.Slice()));
+			Item expectedItem = it2.GetItem(false);
+			for (const auto &field : q.SelectFilters()) {
+				ASSERT_EQ(json[field].As<double>(), expectedItem[field].As<double>()) << q.GetSQL() << ' ' << field;
+			}
+			for (const auto &node : json) {
+				const auto &filters = q.SelectFilters();
+				ASSERT_NE(std::find(filters.begin(), filters.end(), std::string_view(node.key)), filters.end())
+					<< q.GetSQL() << ' ' << ser.Slice();
+			}
+			// Projected payloads are valid items
+			Item item = it1.GetItem();
+			ASSERT_TRUE(item.Status().ok()) << item.Status().what();
+			ASSERT_EQ(item["id"].As<int>(), expectedItem["id"].As<int>());
+		}
+	};
+
+	check(Query(default_namespace).Select({"id", "price"}).Where("price", CondGt, 10).Sort("price", false), true);
+	check(Query(default_namespace).Select({"id", "price"}).Where("price", CondGt, 10).Sort("price", true).Limit(100).Offset(10), true);
+	check(Query(default_namespace).Select({"price", "id", "stock"}).Where("id", CondSet, {Variant{7}, Variant{12}, Variant{3003}}), true);
+	check(Query(default_namespace).Select({"id", "stock"}).Where("count", CondLt, 10), true);
+	// Comparator reads the values from the column
+	check(Query(default_namespace).Select({"id"}).Where("stock", CondGe, 3000).Sort("price", false), true);
+	check(Query(default_namespace).Select({"id"}).Where("price", CondRange, {Variant{100}, Variant{900}}), true);
+
+	// Not all of the selected fields are stored in the columns
+	check(Query(default_namespace).Select({"id", "count"}).Where("price", CondGt, 10), false);
+	// Filter reads payloads
+	check(Query(default_namespace).Select({"id", "price"}).Where("name", CondLike, "name_1%"), false);
+	// Sorting reads payloads
+	check(Query(default_namespace).Select({"id", "price"}).Where("price", CondGt, 10).Sort("name", false), false);
+	check(Query(default_namespace).Select({"id", "price"}).Sort("price", false).Sort("id", false), false);
+
+	// Column option is not allowed for the indexes without scalar numeric values
+	auto err = rt.reindexer->AddIndex(default_namespace, {"name_col", "hash", "string", IndexOpts().Column()});
+	ASSERT_FALSE(err.ok());
+	err = rt.reindexer->AddIndex(default_namespace, {"arr_col", "tree", "int", IndexOpts().Array().Column()});
+	ASSERT_FALSE(err.ok());
+	err = rt.reindexer->AddIndex(default_namespace, {"dense_col", "hash", "int", IndexOpts().Dense().Column()});
+	ASSERT_FALSE(err.ok());
+	err = rt.reindexer->AddIndex(default_namespace, {"sparse_col", "tree", "int", IndexOpts().Sparse().Column()});
+	ASSERT_FALSE(err.ok());
+	// Column of the updated index is filled by the existing items
+	err = rt.reindexer->UpdateIndex(default_namespace, {"count", "tree", "int", IndexOpts().Column()});
+	ASSERT_TRUE(err.ok()) << err.what();
+	AwaitIndexOptimization(default_namespace);
+	check(Query(default_namespace).Select({"id", "count"}).Where("price", CondGt, 10).Sort("price", false), true);
+}
+
+TEST_F(ReindexerApi, IndexOnlyScanRequiresExplicitFlag) {
+	DefineNamespaceDataset(default_namespace, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK().Column(), 0},
+											   IndexDeclaration{"price", "tree", "double", IndexOpts().Column(), 0}});
+	for (int i = 0; i < 100; ++i) {
+		Item item = NewItem(default_namespace);
+		ASSERT_TRUE(item.Status().ok()) << item.Status().what();
+		// Odd documents do not have 'price' field
+		auto err = item.FromJSON(i % 2 ? fmt::sprintf(R"({"id":%d})", i) : fmt::sprintf(R"({"id":%d,"price":%d.5})", i, i));
+		ASSERT_TRUE(err.ok()) << err.what();
+		Upsert(default_namespace, item);
+	}
+
+	auto select = [&](Query &&q, bool expectIndexOnly) {
+		QueryResults qr;
+		auto err = rt.reindexer->Select(q.Explain(), qr);
+		EXPECT_TRUE(err.ok()) << err.what();
+		gason::JsonParser parser;
+		auto explain = parser.Parse(reindexer::giftStr(qr.GetExplainResults()));
+		EXPECT_EQ(explain["index_only"].As<bool>(), expectIndexOnly) << q.GetSQL();
+		std::vector<std::string> jsons;
+		reindexer::WrSerializer ser;
+		for (auto &it : qr) {
+			ser.Reset();
+			err = it.GetJSON(ser, false);
+			EXPECT_TRUE(err.ok()) << err.what();
+			jsons.emplace_back(ser.Slice());
+		}
+		return jsons;
+	};
+
+	// Documents are read without the flag, so the missing fields are preserved
+	auto jsons = select(Query(default_namespace).Select({"id", "price"}).Where("id", CondLt, 2).Sort("id", false), false);
+	ASSERT_EQ(jsons.size(), 2);
+	EXPECT_EQ(jsons[0], R"({"id":0,"price":0.5})");
+	EXPECT_EQ(jsons[1], R"({"id":1})");
+
+	// Index-only results contain the index values for the missing fields
+	jsons = select(Query(default_namespace).Select({"id", "price"}).Where("id", CondLt, 2).Sort("id", false).IndexOnly(), true);
+	ASSERT_EQ(jsons.size(), 2);
+	EXPECT_EQ(jsons[0], R"({"id":0,"price":0.5})");
+	gason::JsonParser parser;
+	auto json = parser.Parse(std::string_view(jsons[1]));
+	EXPECT_EQ(json["id"].As<int>(), 1) << jsons[1];
+	EXPECT_FALSE(json["price"].empty()) << jsons[1];
+	EXPECT_EQ(json["price"].As<double>(), 0.0) << jsons[1];
+
+	// Flag is passed through the DSL and the binary query serialization
+	Query dslQuery;
+	auto err = dslQuery.FromJSON(R"({"namespace":")" + default_namespace + R"(","select_filter":["id"],"select_index_only":true})");
+	ASSERT_TRUE(err.ok()) << err.what();
+	EXPECT_TRUE(dslQuery.IsIndexOnly());
+	Query fromDsl;
+	err = fromDsl.FromJSON(dslQuery.GetJSON());
+	ASSERT_TRUE(err.ok()) << err.what();
+	EXPECT_TRUE(fromDsl.IsIndexOnly());
+	reindexer::WrSerializer ser;
+	dslQuery.Serialize(ser);
+	reindexer::Serializer rdser(ser.Slice());
+	EXPECT_TRUE(Query::Deserialize(rdser).IsIndexOnly());
+}
@@ -1,4 +1,5 @@
 #include <chrono>
+#include <set>
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
@@ -499,6 +500,168 @@ TEST_F(JoinSelectsApi, JoinPreResultStoreValuesOptimizationStressTest) {
 	for (auto& th : threads) th.join();
 }
 
+TEST_F(JoinSelectsApi, JoinPreResultValuesHashJoin) {
+	static const std::string leftNs = "hashJoinLeftNs";
+	static const std::string rightNs = "hashJoinRightNs";
+	static constexpr char const* data = "data";
+	static constexpr char const* tags = "tags";
+	static constexpr int kRightNsRowCount = 150;
+	static constexpr int kLeftNsRowCount = 500;
+	static constexpr int kMaxDataValue = 50;
+	struct Row {
+		int data;
+		std::vector<int> tags;
+	};
+	std::vector<Row> rightRows, leftRows;
+	const auto createNs = [this](const std::string& ns, std::vector<Row>& rows, int count) {
+		Error err = rt.reindexer->OpenNamespace(ns);
+		ASSERT_TRUE(err.ok()) << err.what();
+		DefineNamespaceDataset(ns, {IndexDeclaration{id, "hash", "int", IndexOpts().PK(), 0},
+									IndexDeclaration{data, "hash", "int", IndexOpts(), 0},
+									IndexDeclaration{tags, "hash", "int", IndexOpts().Array(), 0}});
+		for (int i = 0; i < count; ++i) {
+			Row row{rand() % kMaxDataValue, {}};
+			for (int j = 0, s = rand() % 4; j < s; ++j) row.tags.emplace_back(rand() % kMaxDataValue);
+			Item item = NewItem(ns);
+			item[id] = i;
+			item[data] = row.data;
+			item[tags] = row.tags;
+			Upsert(ns, item);
+			rows.emplace_back(std::move(row));
+		}
+		err = Commit(ns);
+		ASSERT_TRUE(err.ok()) << err.what();
+	};
+	createNs(rightNs, rightRows, kRightNsRowCount);
+	createNs(leftNs, leftRows, kLeftNsRowCount);
+
+	const auto anyOf = [](const std::vector<int>& lhs, const std::vector<int>& rhs) {
+		return std::find_first_of(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()) != lhs.end();
+	};
+	const std::vector<std::pair<const char*, std::function<bool(const Row&, const Row&)>>> joinFields = {
+		{data, [](const Row& l, const Row& r) { return l.data == r.data; }},
+		{tags, [&anyOf](const Row& l, const Row& r) { return anyOf(l.tags, r.tags); }}};
+	for (const auto& [field, matches] : joinFields) {
+		for (bool explain : {true, false}) {
+			Query q = Query(leftNs).InnerJoin(field, field, CondEq, Query(rightNs));
+			if (explain) q.Explain();
+			QueryResults qr;
+			Error err = rt.reindexer->Select(q, qr);
+			ASSERT_TRUE(err.ok()) << err.what();
+			if (explain) {
+				ASSERT_NE(qr.GetExplainResults().find("\"hash_join\":true"), std::string::npos) << qr.GetExplainResults();
+			}
+			size_t expectedCount = 0;
+			for (const auto& l : leftRows) {
+				expectedCount += std::any_of(rightRows.begin(), rightRows.end(), [&](const Row& r) { return matches(l, r); });
+			}
+			ASSERT_EQ(qr.Count(), expectedCount) << field;
+			for (auto it : qr) {
+				Item item = it.GetItem(false);
+				const Row& l = leftRows[item[id].Get<int>()];
+				std::set<int> expectedIds;
+				for (size_t i = 0; i < rightRows.size(); ++i) {
+					if (matches(l, rightRows[i])) expectedIds.insert(i);
+				}
+				std::set<int> joinedIds;
+				auto joinedFieldIt = it.GetJoined().begin();
+				for (int i = 0; i < joinedFieldIt.ItemsCount(); ++i) {
+					reindexer::ItemImpl joinedItem(joinedFieldIt.GetItem(i, qr.getPayloadType(1), qr.getTagsMatcher(1)));
+					joinedIds.insert(joinedItem.GetField(qr.getPayloadType(1).FieldByName(id)).As<int>());
+				}
+				ASSERT_EQ(joinedIds, expectedIds) << field;
+			}
+		}
+	}
+}
+
+TEST_F(JoinSelectsApi, BatchedLeftJoin) {
+	static const std::string leftNs = "batchJoinLeftNs";
+	static const std::string rightNs = "batchJoinRightNs";
+	static constexpr char const* data = "data";
+	static constexpr char const* value = "value";
+	static constexpr int kRightNsRowCount = 2000;
+	static constexpr int kLeftNsRowCount = 2500;
+	static constexpr int kMaxDataValue = 500;
+	std::vector<std::pair<int, int>> rightRows, leftRows;
+	const auto createNs = [this](const std::string& ns, std::vector<std::pair<int, int>>& rows, int count) {
+		Error err = rt.reindexer->OpenNamespace(ns);
+		ASSERT_TRUE(err.ok()) << err.what();
+		DefineNamespaceDataset(ns, {IndexDeclaration{id, "hash", "int", IndexOpts().PK(), 0},
+									IndexDeclaration{data, "hash", "int", IndexOpts(), 0},
+									IndexDeclaration{value, "tree", "int", IndexOpts(), 0}});
+		for (int i = 0; i < count; ++i) {
+			rows.emplace_back(rand() % kMaxDataValue, rand() % 10);
+			Item item = NewItem(ns);
+			item[id] = i;
+			item[data] = rows.back().first;
+			item[value] = rows.back().second;
+			Upsert(ns, item);
+		}
+		err = Commit(ns);
+		ASSERT_TRUE(err.ok()) << err.what();
+	};
+	createNs(rightNs, rightRows, kRightNsRowCount);
+	createNs(leftNs, leftRows, kLeftNsRowCount);
+
+	const auto checkJoin = [&](unsigned limit) {
+		// Two join conditions: the second one has to be checked while distributing results between the rows
+		Query q = Query::FromSQL(fmt::sprintf(
+			"SELECT * FROM %s LEFT JOIN (SELECT * FROM %s WHERE %s < 8 %s) ON (%s.%s = %s.%s AND %s.%s = %s.%s)", leftNs, rightNs, value,
+			limit == QueryEntry::kDefaultLimit ? "" : fmt::sprintf("LIMIT %d", limit), leftNs, data, rightNs, data, leftNs, value, rightNs,
+			value));
+		q.Explain();
+		QueryResults qr;
+		Error err = rt.reindexer->Select(q, qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		ASSERT_EQ(qr.Count(), kLeftNsRowCount);
+		if (limit == QueryEntry::kDefaultLimit) {
+			ASSERT_NE(qr.GetExplainResults().find("\"batch_selects_count\":3"), std::string::npos) << qr.GetExplainResults();
+		} else {
+			// Limited join is processed row by row
+			ASSERT_EQ(qr.GetExplainResults().find("\"batch_selects_count\""), std::string::npos) << qr.GetExplainResults();
+		}
+		for (auto it : qr) {
+			Item item = it.GetItem(false);
+			const auto& l = leftRows[item[id].Get<int>()];
+			std::set<int> expectedIds;
+			for (size_t i = 0; i < rightRows.size(); ++i) {
+				if (rightRows[i] == l && rightRows[i].second < 8) expectedIds.insert(i);
+			}
+			std::set<int> joinedIds;
+			auto joined = it.GetJoined();
+			if (joined.getJoinedItemsCount()) {
+				auto joinedFieldIt = joined.begin();
+				for (int i = 0; i < joinedFieldIt.ItemsCount(); ++i) {
+					reindexer::ItemImpl joinedItem(joinedFieldIt.GetItem(i, qr.getPayloadType(1), qr.getTagsMatcher(1)));
+					joinedIds.insert(joinedItem.GetField(qr.getPayloadType(1).FieldByName(id)).As<int>());
+				}
+			}
+			if (limit == QueryEntry::kDefaultLimit) {
+				ASSERT_EQ(joinedIds, expectedIds);
+			} else {
+				ASSERT_EQ(joinedIds.size(), std::min<size_t>(limit, expectedIds.size()));
+				ASSERT_TRUE(std::includes(expectedIds.begin(), expectedIds.end(), joinedIds.begin(), joinedIds.end()));
+			}
+		}
+	};
+	for (unsigned limit : {QueryEntry::kDefaultLimit, 2u}) {
+		checkJoin(limit);
+	}
+
+	// Batch selects are taken from the join cache
+	TurnOnJoinCache(rightNs);
+	AwaitIndexOptimization(rightNs);
+	for (int i = 0; i < 5; ++i) {
+		checkJoin(QueryEntry::kDefaultLimit);
+	}
+	Item memstat = getMemStat(*rt.reindexer, rightNs);
+	ASSERT_TRUE(memstat.Status().ok()) << memstat.Status().what();
+	gason::JsonParser parser;
+	const std::string json(memstat.GetJSON());
+	ASSERT_GT(parser.Parse(std::string_view(json))["join_cache"]["hits_count"].As<int64_t>(), 0) << json;
+}
+
 static void checkForAllowedJsonTags(const std::vector<std::string>& tags, gason::JsonValue jsonValue) {
 	size_t count = 0;
 	for (const auto& elem : jsonValue) {
@@ -2974,6 +2974,51 @@ TEST_F(NsApi, TestUpdateFieldWithExpressions) {
 	}
 }
 
+TEST_F(NsApi, TestUpdateFieldWithCompiledExpressions) {
+	DefineDefaultNamespace();
+	FillDefaultNamespace();
+
+	std::unordered_map<int, double> doubleValues;
+	{
+		QueryResults qr;
+		Error err = rt.reindexer->Select(Query(default_namespace), qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		for (auto &it : qr) {
+			Item item = it.GetItem(false);
+			doubleValues[item[idIdxName].As<int>()] = item[doubleField].As<double>();
+		}
+	}
+
+	// Indexed, sparse and non-indexed fields are read by the compiled expressions
+	QueryResults qr;
+	Error err = rt.reindexer->Select(
+		"update test_namespace set int_field = int_field * 2 + id - 1, extra = sparse_field + double_field * 0.5, "
+		"nested.value = sparse_field - (int_field - 2 * 3) / 4 where id < 500",
+		qr);
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_EQ(qr.Count(), 500);
+	for (auto &it : qr) {
+		Item item = it.GetItem(false);
+		const int id = item[idIdxName].As<int>();
+		const int intValue = 3 * id - 1;
+		const double extra = id * 3 + doubleValues[id] * 0.5;
+		ASSERT_EQ(item[intField].As<int>(), intValue) << id;
+		ASSERT_DOUBLE_EQ(item["extra"].As<double>(), extra) << id;
+		ASSERT_DOUBLE_EQ(item["nested.value"].As<double>(), id * 3 - (intValue - 6) / 4.0) << id;
+	}
+
+	// Values, which are not numbers, are handled by the general evaluator
+	qr.Clear();
+	err = rt.reindexer->Select("update test_namespace set int_field = extra + 1 where id >= 990", qr);
+	ASSERT_EQ(err.code(), errParams) << err.what();
+	qr.Clear();
+	err = rt.reindexer->Select("update test_namespace set int_field = bool_field + 1 where id = 1", qr);
+	ASSERT_EQ(err.code(), errParams) << err.what();
+	qr.Clear();
+	err = rt.reindexer->Select("update test_namespace set int_field = 1 / (id - id) where id = 1", qr);
+	ASSERT_EQ(err.code(), errLogic) << err.what();
+}
+
 static void checkQueryDsl(const Query &src) {
 	Query dst;
 	const std::string dsl = src.GetJSON();
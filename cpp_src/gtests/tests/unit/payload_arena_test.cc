@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include "core/payload/payloadarena.h"
+#include "core/payload/payloadvalue.h"
+#include "gason/gason.h"
+#include "reindexer_api.h"
+
+using reindexer::PayloadArena;
+using reindexer::PayloadValue;
+
+TEST(PayloadArenaTest, CompactionKeepsData) {
+	constexpr size_t kValues = 5000;
+	constexpr size_t kSize = 100;
+	auto arena = PayloadArena::Create();
+	std::vector<PayloadValue> values;
+	values.reserve(kValues);
+	for (size_t i = 0; i < kValues; ++i) {
+		values.emplace_back(kSize, nullptr, 0, arena.get());
+		memset(values.back().Ptr(), int(i % 251), kSize);
+		values.back().SetLSN(int64_t(i));
+	}
+	auto stats = arena->GetStats();
+	EXPECT_EQ(stats.blocksCount, kValues);
+	EXPECT_GE(stats.usedSize, kValues * (kSize + sizeof(PayloadValue::dataHeader)));
+
+	// Too large payloads are placed into the heap
+	PayloadValue large(PayloadArena::kMaxBlockSize, nullptr, 0, arena.get());
+	EXPECT_EQ(arena->GetStats().blocksCount, kValues);
+
+	for (size_t i = 0; i < kValues; ++i) {
+		if (i % 4) values[i].Free();
+	}
+	const auto sparseStats = arena->GetStats();
+	EXPECT_EQ(sparseStats.blocksCount, kValues / 4);
+	EXPECT_EQ(sparseStats.slabsCount, stats.slabsCount);
+
+	// Shared payload is not moved
+	PayloadValue shared = values[0];
+	ASSERT_TRUE(arena->BeginCompaction());
+	size_t relocated = 0;
+	for (auto &v : values) {
+		if (!v.IsFree()) relocated += v.Compact();
+	}
+	arena->EndCompaction();
+	EXPECT_EQ(values[0].get(), shared.get());
+	EXPECT_GT(relocated, 0);
+
+	stats = arena->GetStats();
+	EXPECT_EQ(stats.blocksCount, kValues / 4);
+	EXPECT_EQ(stats.relocatedCount, relocated);
+	EXPECT_EQ(stats.compactionsCount, 1);
+	EXPECT_LT(stats.slabsCount, sparseStats.slabsCount);
+	for (size_t i = 0; i < kValues; i += 4) {
+		ASSERT_EQ(values[i].GetCapacity(), kSize);
+		ASSERT_EQ(values[i].GetLSN(), int64_t(i));
+		for (size_t j = 0; j < kSize; ++j) {
+			ASSERT_EQ(values[i].Ptr()[j], i % 251) << i;
+		}
+	}
+}
+
+TEST(PayloadArenaTest, PayloadsOutliveArenaOwner) {
+	PayloadValue value;
+	{
+		auto arena = PayloadArena::Create();
+		value = PayloadValue(64, nullptr, 0, arena.get());
+	}
+	// Arena without owners is still used for the copies of its payloads and is destroyed with the last payload
+	PayloadValue copy = value;
+	copy.Clone();
+	EXPECT_NE(copy.get(), value.get());
+	EXPECT_EQ(PayloadArena::Of(copy.get()), PayloadArena::Of(value.get()));
+	copy.Resize(64, 128);
+	EXPECT_EQ(copy.GetCapacity(), 128);
+	value.Free();
+	copy.Free();
+}
+
+TEST_F(ReindexerApi, PayloadArenaCompaction) {
+	constexpr int kItems = 20000;
+	DefineNamespaceDataset(default_namespace, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+											   IndexDeclaration{"value", "tree", "string", IndexOpts(), 0}});
+	SetNamespaceConfig(default_namespace, [](reindexer::JsonBuilder &cfg) {
+		cfg.Put("payload_arena", true);
+		cfg.Put("optimization_timeout_ms", 10);
+	});
+	for (int i = 0; i < kItems; ++i) {
+		Item item = NewItem(default_namespace);
+		ASSERT_TRUE(item.Status().ok()) << item.Status().what();
+		auto err = item.FromJSON(fmt::sprintf(R"({"id":%d,"value":"value_%d","data":"data_%d"})", i, i % 100, i));
+		ASSERT_TRUE(err.ok()) << err.what();
+		Upsert(default_namespace, item);
+	}
+	{
+		// Every slab loses 3/4 of its payloads
+		std::vector<Variant> deleted;
+		for (int i = 0; i < 100; ++i) {
+			if (i % 4) deleted.emplace_back("value_" + std::to_string(i));
+		}
+		QueryResults qr;
+		auto err = rt.reindexer->Delete(Query(default_namespace).Where("value", CondSet, deleted), qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		ASSERT_EQ(qr.Count(), kItems - kItems / 4);
+	}
+
+	gason::JsonParser parser;
+	std::string json;
+	gason::JsonNode arenaStat;
+	for (int i = 0; i < 200; ++i) {
+		Item memstat = getMemStat(*rt.reindexer, default_namespace);
+		ASSERT_TRUE(memstat.Status().ok()) << memstat.Status().what();
+		json = std::string(memstat.GetJSON());
+		arenaStat = parser.Parse(std::string_view(json))["payload_arena"];
+		ASSERT_FALSE(arenaStat.empty()) << json;
+		if (arenaStat["relocated_count"].As<int>() > 0) break;
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	}
+	EXPECT_GT(arenaStat["compactions_count"].As<int>(), 0) << json;
+	EXPECT_GT(arenaStat["relocated_count"].As<int>(), 0) << json;
+	EXPECT_EQ(arenaStat["payloads_count"].As<int>(), kItems / 4) << json;
+
+	QueryResults qr;
+	auto err = rt.reindexer->Select(Query(default_namespace).Sort("id", false), qr);
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_EQ(qr.Count(), kItems / 4);
+	int id = 0;
+	for (auto &it : qr) {
+		Item item = it.GetItem(false);
+		ASSERT_EQ(item["id"].As<int>(), id);
+		ASSERT_EQ(item["value"].As<std::string>(), "value_" + std::to_string(id % 100));
+		ASSERT_EQ(item["data"].As<std::string>(), "data_" + std::to_string(id));
+		id += 4;
+	}
+}
+
+TEST_F(ReindexerApi, PayloadArenaCompactionWithCompositeIndex) {
+	constexpr int kItems = 20000;
+	DefineNamespaceDataset(default_namespace, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+											   IndexDeclaration{"value", "tree", "string", IndexOpts(), 0},
+											   IndexDeclaration{"value+id", "tree", "composite", IndexOpts(), 0}});
+	SetNamespaceConfig(default_namespace, [](reindexer::JsonBuilder &cfg) {
+		cfg.Put("payload_arena", true);
+		cfg.Put("optimization_timeout_ms", 10);
+	});
+	for (int i = 0; i < kItems; ++i) {
+		Item item = NewItem(default_namespace);
+		ASSERT_TRUE(item.Status().ok()) << item.Status().what();
+		auto err = item.FromJSON(fmt::sprintf(R"({"id":%d,"value":"value_%d","data":"data_%d"})", i, i % 100, i));
+		ASSERT_TRUE(err.ok()) << err.what();
+		Upsert(default_namespace, item);
+	}
+	{
+		std::vector<Variant> deleted;
+		for (int i = 0; i < 100; ++i) {
+			if (i % 4) deleted.emplace_back("value_" + std::to_string(i));
+		}
+		QueryResults qr;
+		auto err = rt.reindexer->Delete(Query(default_namespace).Where("value", CondSet, deleted), qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		ASSERT_EQ(qr.Count(), kItems - kItems / 4);
+	}
+	AwaitIndexOptimization(default_namespace);
+	// Give the background optimization a few more chances to run the compaction
+	std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+	// Composite index's keys reference the items' payloads, so the payloads are not moved
+	Item memstat = getMemStat(*rt.reindexer, default_namespace);
+	ASSERT_TRUE(memstat.Status().ok()) << memstat.Status().what();
+	const std::string json(memstat.GetJSON());
+	gason::JsonParser parser;
+	const auto arenaStat = parser.Parse(std::string_view(json))["payload_arena"];
+	ASSERT_FALSE(arenaStat.empty()) << json;
+	EXPECT_TRUE(arenaStat["compaction_disabled"].As<bool>()) << json;
+	EXPECT_EQ(arenaStat["compactions_count"].As<int>(), 0) << json;
+	EXPECT_EQ(arenaStat["relocated_count"].As<int>(), 0) << json;
+	EXPECT_EQ(arenaStat["payloads_count"].As<int>(), kItems / 4) << json;
+
+	for (int id = 0; id < kItems; id += 4 * 97) {
+		QueryResults qr;
+		auto err = rt.reindexer->Select(
+			Query(default_namespace).WhereComposite("value+id", CondEq, {{Variant{"value_" + std::to_string(id % 100)}, Variant{id}}}), qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		ASSERT_EQ(qr.Count(), 1) << id;
+		Item item = qr.begin().GetItem(false);
+		ASSERT_EQ(item["id"].As<int>(), id);
+		ASSERT_EQ(item["data"].As<std::string>(), "data_" + std::to_string(id));
+	}
+}
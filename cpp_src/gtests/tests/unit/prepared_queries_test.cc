@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "core/query/preparedquery.h"
+#include "reindexer_api.h"
+
+TEST_F(ReindexerApi, PreparedQueryBind) {
+	using reindexer::PreparedQuery;
+	const auto prepared =
+		PreparedQuery::FromSQL("SELECT * FROM ns WHERE id = ? AND (value IN (1, ?, 3) OR name LIKE ?) AND count RANGE (?, ?) ORDER BY id");
+	ASSERT_EQ(prepared.ParamsCount(), 5);
+
+	const Query q = prepared.Bind({Variant{10}, Variant{20}, Variant{"na%"}, Variant{5}, Variant{15}});
+	const Query expected = Query("ns")
+							   .Where("id", CondEq, 10)
+							   .OpenBracket()
+							   .Where("value", CondSet, {Variant{1}, Variant{20}, Variant{3}})
+							   .Or()
+							   .Where("name", CondLike, "na%")
+							   .CloseBracket()
+							   .Where("count", CondRange, {Variant{5}, Variant{15}})
+							   .Sort("id", false);
+	EXPECT_EQ(q.GetSQL(), expected.GetSQL());
+	// Prepared query is not changed by the binding
+	EXPECT_EQ(prepared.Bind({Variant{10}, Variant{20}, Variant{"na%"}, Variant{5}, Variant{15}}).GetSQL(), expected.GetSQL());
+	EXPECT_NE(prepared.Bind({Variant{1}, Variant{2}, Variant{"a"}, Variant{3}, Variant{4}}).GetSQL(), expected.GetSQL());
+
+	// Wrong parameters count
+	EXPECT_THROW(prepared.Bind({Variant{1}}), Error);
+	// LIKE condition requires string parameter
+	EXPECT_THROW(prepared.Bind({Variant{1}, Variant{2}, Variant{3}, Variant{3}, Variant{4}}), Error);
+	// Placeholders are not allowed outside of the prepared queries and in the subqueries
+	EXPECT_THROW(Query::FromSQL("SELECT * FROM ns WHERE id = ?"), Error);
+	EXPECT_THROW(PreparedQuery::FromSQL("SELECT * FROM ns WHERE id IN (SELECT id FROM ns2 WHERE value = ?)"), Error);
+	EXPECT_THROW(PreparedQuery::FromSQL("SELECT * FROM ns WHERE id = {?, 1}"), Error);
+}
+
+TEST_F(ReindexerApi, PreparedQuerySize) {
+	using reindexer::PreparedQuery;
+	// Size of the prepared query accounts the parsed query, so the cache limit is applied to the real memory consumption
+	const auto small = PreparedQuery::FromSQL("SELECT * FROM ns WHERE id = ?");
+	EXPECT_GT(small.Size(), sizeof(PreparedQuery) + sizeof(Query));
+
+	const std::string longString(10000, 'a');
+	const auto large = PreparedQuery::FromSQL("SELECT * FROM ns WHERE id = ? AND name IN ('" + longString + "', '" + longString +
+											  "') AND INNER JOIN ns2 ON ns.id = ns2.id ORDER BY id");
+	EXPECT_GT(large.Size(), small.Size() + 2 * longString.size() + sizeof(Query));
+}
+
+TEST_F(ReindexerApi, PreparedQueriesExecution) {
+	DefineNamespaceDataset(default_namespace, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+											   IndexDeclaration{"value", "tree", "int", IndexOpts(), 0}});
+	for (int i = 0; i < 100; ++i) {
+		Item item = NewItem(default_namespace);
+		auto err = item.FromJSON("{\"id\":" + std::to_string(i) + ",\"value\":" + std::to_string(i % 10) + ",\"name\":\"name_" +
+								 std::to_string(i % 3) + "\"}");
+		ASSERT_TRUE(err.ok()) << err.what();
+		Upsert(default_namespace, item);
+	}
+
+	const std::string sql = "SELECT * FROM " + default_namespace + " WHERE value = ? AND name = ?";
+	// The same query shape is executed with different parameters, parsed query is taken from the cache
+	for (int i = 0; i < 10; ++i) {
+		for (int j = 0; j < 3; ++j) {
+			QueryResults qr;
+			auto err = rt.reindexer->Select(sql, {Variant{i}, Variant{"name_" + std::to_string(j)}}, qr);
+			ASSERT_TRUE(err.ok()) << err.what();
+			QueryResults expected;
+			err = rt.reindexer->Select(
+				Query(default_namespace).Where("value", CondEq, i).Where("name", CondEq, "name_" + std::to_string(j)), expected);
+			ASSERT_TRUE(err.ok()) << err.what();
+			ASSERT_EQ(qr.Count(), expected.Count());
+			for (auto &it : qr) {
+				Item item = it.GetItem(false);
+				ASSERT_EQ(item["value"].As<int>(), i);
+				ASSERT_EQ(item["name"].As<std::string>(), "name_" + std::to_string(j));
+			}
+		}
+	}
+
+	// Modification queries are supported too
+	QueryResults qrUpd;
+	auto err = rt.reindexer->Select("UPDATE " + default_namespace + " SET name = 'updated' WHERE id IN (?, ?)", {Variant{1}, Variant{2}},
+									qrUpd);
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_EQ(qrUpd.Count(), 2);
+	QueryResults qrDel;
+	err = rt.reindexer->Select("DELETE FROM " + default_namespace + " WHERE id >= ?", {Variant{50}}, qrDel);
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_EQ(qrDel.Count(), 50);
+
+	QueryResults qr;
+	err = rt.reindexer->Select("SELECT * FROM " + default_namespace + " WHERE id = ?", {Variant{1}, Variant{2}}, qr);
+	EXPECT_EQ(err.code(), errParams) << err.what();
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include "core/cjson/jsonbuilder.h"
+#include "reindexer_api.h"
+
+TEST_F(ReindexerApi, UpdateDeleteQueriesCopyPolicy) {
+	constexpr int kItemsCount = 5000;
+	DefineNamespaceDataset(default_namespace, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+											   IndexDeclaration{"value", "tree", "int", IndexOpts(), 0}});
+	SetNamespaceConfig(default_namespace, [](reindexer::JsonBuilder &cfg) {
+		cfg.Put("start_copy_policy_tx_size", 1000);
+		cfg.Put("copy_policy_multiplier", 10);
+		cfg.Put("copy_policy_for_queries", true);
+	});
+	for (int i = 0; i < kItemsCount; ++i) {
+		Item item = NewItem(default_namespace);
+		auto err = item.FromJSON("{\"id\":" + std::to_string(i) + ",\"value\":" + std::to_string(i % 100) + ",\"data\":\"initial\"}");
+		ASSERT_TRUE(err.ok()) << err.what();
+		Upsert(default_namespace, item);
+	}
+	// Namespace copies are counted in the perfstats
+	QueryResults qrCfg;
+	auto err = rt.reindexer->Update(Query(reindexer::kConfigNamespace).Set("profiling.perfstats", true).Where("type", CondEq, "profiling"),
+									qrCfg);
+	ASSERT_TRUE(err.ok()) << err.what();
+	auto copiesCount = [&] {
+		QueryResults qr;
+		auto err = rt.reindexer->Select(Query(reindexer::kPerfStatsNamespace).Where("name", CondEq, default_namespace), qr);
+		EXPECT_TRUE(err.ok()) << err.what();
+		EXPECT_EQ(qr.Count(), 1);
+		return qr.Count() ? qr.begin().GetItem(false)["transactions.total_copy_count"].As<int64_t>() : -1;
+	};
+	ASSERT_EQ(copiesCount(), 0);
+
+	// Concurrent selects have to see either old or new version of the namespace
+	std::atomic<bool> done = {false};
+	std::atomic<int> partialResults = {0};
+	std::thread reader([&] {
+		while (!done.load()) {
+			QueryResults qr;
+			auto err = rt.reindexer->Select(Query(default_namespace).Where("value", CondEq, 1000), qr);
+			ASSERT_TRUE(err.ok()) << err.what();
+			if (qr.Count() != 0 && qr.Count() != kItemsCount) ++partialResults;
+		}
+	});
+
+	QueryResults qrUpd;
+	err = rt.reindexer->Update(Query(default_namespace).Set("value", 1000).Set("data", "updated"), qrUpd);
+	done = true;
+	reader.join();
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_EQ(qrUpd.Count(), kItemsCount);
+	EXPECT_EQ(partialResults.load(), 0);
+	EXPECT_EQ(copiesCount(), 1);
+	for (auto &it : qrUpd) {
+		Item item = it.GetItem(false);
+		ASSERT_EQ(item["value"].As<int>(), 1000);
+		ASSERT_EQ(item["data"].As<std::string>(), "updated");
+	}
+
+	// Query with limit modifies too few items to be applied to the copy
+	QueryResults qrSmallUpd;
+	err = rt.reindexer->Update(Query(default_namespace).Where("id", CondLt, 2000).Limit(10).Set("value", 5), qrSmallUpd);
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_EQ(qrSmallUpd.Count(), 10);
+	EXPECT_EQ(copiesCount(), 1);
+
+	QueryResults qrDel;
+	err = rt.reindexer->Delete(Query(default_namespace).Where("id", CondGe, 2000), qrDel);
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_EQ(qrDel.Count(), kItemsCount - 2000);
+	EXPECT_EQ(copiesCount(), 2);
+
+	QueryResults qr;
+	err = rt.reindexer->Select(Query(default_namespace).Where("value", CondEq, 1000).Where("data", CondEq, "updated"), qr);
+	ASSERT_TRUE(err.ok()) << err.what();
+	EXPECT_EQ(qr.Count(), 2000 - 10);
+	qr.Clear();
+	err = rt.reindexer->Select(Query(default_namespace).Where("value", CondEq, 5), qr);
+	ASSERT_TRUE(err.ok()) << err.what();
+	EXPECT_EQ(qr.Count(), 10);
+}
+
+TEST_F(ReindexerApi, UpdateQueryCopyPolicyWithConcurrentDeletes) {
+	constexpr int kItemsCount = 5000;
+	constexpr int kDeletedCount = 500;
+	DefineNamespaceDataset(default_namespace, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+											   IndexDeclaration{"value", "tree", "int", IndexOpts(), 0}});
+	SetNamespaceConfig(default_namespace, [](reindexer::JsonBuilder &cfg) {
+		cfg.Put("start_copy_policy_tx_size", 1000);
+		cfg.Put("copy_policy_multiplier", 10);
+		cfg.Put("copy_policy_for_queries", true);
+	});
+	for (int i = 0; i < kItemsCount; ++i) {
+		Item item = NewItem(default_namespace);
+		auto err = item.FromJSON("{\"id\":" + std::to_string(i) + ",\"value\":0}");
+		ASSERT_TRUE(err.ok()) << err.what();
+		Upsert(default_namespace, item);
+	}
+
+	// Items, deleted between the selection and the namespace copying, must not be updated
+	std::thread deleter([&] {
+		for (int i = kItemsCount - kDeletedCount; i < kItemsCount; ++i) {
+			QueryResults qr;
+			auto err = rt.reindexer->Delete(Query(default_namespace).Where("id", CondEq, i), qr);
+			ASSERT_TRUE(err.ok()) << err.what();
+		}
+	});
+	for (int value = 1; value <= 5; ++value) {
+		QueryResults qr;
+		auto err = rt.reindexer->Update(Query(default_namespace).Set("value", value), qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		for (auto &it : qr) {
+			Item item = it.GetItem(false);
+			ASSERT_EQ(item["value"].As<int>(), value);
+		}
+	}
+	deleter.join();
+
+	QueryResults qr;
+	auto err = rt.reindexer->Select(Query(default_namespace).Where("value", CondEq, 5), qr);
+	ASSERT_TRUE(err.ok()) << err.what();
+	EXPECT_LE(qr.Count(), kItemsCount);
+	EXPECT_GE(qr.Count(), kItemsCount - kDeletedCount);
+	qr.Clear();
+	err = rt.reindexer->Select(Query(default_namespace).Where("id", CondGe, kItemsCount - kDeletedCount), qr);
+	ASSERT_TRUE(err.ok()) << err.what();
+	EXPECT_EQ(qr.Count(), 0);
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include "core/cjson/jsonbuilder.h"
+#include "core/defnsconfigs.h"
+#include "gason/gason.h"
+#include "reindexer_api.h"
+
+class QueryMemoryLimitApi : public ReindexerApi {
+protected:
+	void SetUp() override {
+		ReindexerApi::SetUp();
+		DefineNamespaceDataset(default_namespace, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+												   IndexDeclaration{"value", "tree", "int", IndexOpts(), 0}});
+		for (int i = 0; i < kItemsCount; ++i) {
+			Item item = NewItem(default_namespace);
+			auto err = item.FromJSON("{\"id\":" + std::to_string(i) + ",\"value\":" + std::to_string(i % 100) + "}");
+			ASSERT_TRUE(err.ok()) << err.what();
+			Upsert(default_namespace, item);
+		}
+	}
+
+	void SetMemoryLimits(size_t queryLimit, size_t totalLimit) {
+		reindexer::WrSerializer ser;
+		{
+			reindexer::JsonBuilder jb(ser);
+			jb.Put("type", "profiling");
+			auto profiling = jb.Object("profiling");
+			profiling.Put("queriesperfstats", true);
+			profiling.Put("queries_threshold_us", 0);
+			profiling.Put("query_memory_limit", queryLimit);
+			profiling.Put("total_queries_memory_limit", totalLimit);
+		}
+		Item item = NewItem(reindexer::kConfigNamespace);
+		ASSERT_TRUE(item.Status().ok()) << item.Status().what();
+		auto err = item.FromJSON(ser.Slice());
+		ASSERT_TRUE(err.ok()) << err.what();
+		Upsert(reindexer::kConfigNamespace, item);
+	}
+
+	static constexpr int kItemsCount = 10000;
+};
+
+TEST_F(QueryMemoryLimitApi, SelectsAreLimited) {
+	constexpr size_t kLimit = 32 * 1024;
+	SetMemoryLimits(kLimit, 0);
+
+	// Results of this size have to fit into the limit
+	QueryResults qrSmall;
+	auto err = rt.reindexer->Select(Query(default_namespace).Where("value", CondEq, 5).Limit(20).Explain(), qrSmall);
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_EQ(qrSmall.Count(), 20);
+	{
+		gason::JsonParser parser;
+		const std::string explain = qrSmall.GetExplainResults();
+		auto root = parser.Parse(std::string_view(explain));
+		const auto peak = root["peak_memory_bytes"].As<int64_t>();
+		EXPECT_GT(peak, 0) << explain;
+		EXPECT_LE(peak, int64_t(kLimit)) << explain;
+	}
+
+	// Item refs of the whole namespace
+	QueryResults qrAll;
+	err = rt.reindexer->Select(Query(default_namespace), qrAll);
+	ASSERT_EQ(err.code(), errQueryMemoryLimit) << err.what();
+
+	// Facet over the unique field
+	QueryResults qrFacet;
+	err = rt.reindexer->Select(Query(default_namespace).Aggregate(AggFacet, {"id"}).Limit(0), qrFacet);
+	ASSERT_EQ(err.code(), errQueryMemoryLimit) << err.what();
+
+	// Global limit is checked for each query too
+	SetMemoryLimits(0, kLimit);
+	QueryResults qrGlobal;
+	err = rt.reindexer->Select(Query(default_namespace).Where("value", CondLt, 50), qrGlobal);
+	ASSERT_EQ(err.code(), errQueryMemoryLimit) << err.what();
+
+	SetMemoryLimits(0, 0);
+	const Query q = Query(default_namespace).Where("value", CondLt, 50);
+	for (int i = 0; i < 3; ++i) {
+		QueryResults qr;
+		err = rt.reindexer->Select(q, qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		ASSERT_EQ(qr.Count(), kItemsCount / 2);
+	}
+
+	QueryResults qrStat;
+	err = rt.reindexer->Select(Query("#queriesperfstats").Where("query", CondEq, q.GetSQL(true)), qrStat);
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_EQ(qrStat.Count(), 1);
+	Item stat = qrStat.begin().GetItem(false);
+	const auto maxPeak = stat["max_peak_memory_bytes"].As<int64_t>();
+	EXPECT_GT(maxPeak, int64_t(kItemsCount / 2 * sizeof(reindexer::ItemRef))) << stat.GetJSON();
+	EXPECT_GT(stat["avg_peak_memory_bytes"].As<int64_t>(), 0) << stat.GetJSON();
+	EXPECT_LE(stat["avg_peak_memory_bytes"].As<int64_t>(), maxPeak) << stat.GetJSON();
+}
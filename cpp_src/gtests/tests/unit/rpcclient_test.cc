@@ -1047,6 +1047,135 @@ TEST_F(RPCClientTestApi, AggregationsFetching) {
 	loop.run();
 }
 
+TEST_F(RPCClientTestApi, FetchingWithPrefetch) {
+	// Check, that results pages prefetching does not change iteration results and query results may be destroyed at any moment
+	using namespace reindexer::client;
+	using namespace reindexer::net::ev;
+
+	StartDefaultRealServer();
+	dynamic_loop loop;
+	constexpr unsigned kItemsCount = 1000;
+	constexpr unsigned kFetchLimit = 30;
+
+	loop.spawn([&loop, this, kItemsCount]() noexcept {
+		const std::string nsName = "ns1";
+		const std::string dsn = "cproto://" + kDefaultRPCServerAddr + "/db1";
+		client::ConnectOpts opts;
+		opts.CreateDBIfMissing();
+		client::ReindexerConfig cfg;
+		cfg.FetchAmount = kFetchLimit;
+		cfg.PrefetchBufferSize = 4096;
+		CoroReindexer rx(cfg);
+		auto err = rx.Connect(dsn, loop, opts);
+		ASSERT_TRUE(err.ok()) << err.what();
+
+		CreateNamespace(rx, nsName);
+		FillData(rx, nsName, 0, kItemsCount);
+
+		for (unsigned i = 0; i < 3; ++i) {
+			CoroQueryResults qr;
+			err = rx.Select(Query(nsName).Sort("id", false).ReqTotal(), qr);
+			ASSERT_TRUE(err.ok()) << err.what();
+			ASSERT_EQ(qr.Count(), kItemsCount);
+			int expectedId = 0;
+			WrSerializer wser;
+			for (auto& it : qr) {
+				ASSERT_TRUE(it.Status().ok()) << it.Status().what();
+				wser.Reset();
+				err = it.GetJSON(wser, false);
+				ASSERT_TRUE(err.ok()) << err.what();
+				ASSERT_EQ(wser.Slice(), fmt::sprintf(R"json({"id":%d})json", expectedId++));
+				EXPECT_EQ(qr.TotalCount(), kItemsCount);
+				if (i == 1 && expectedId % kFetchLimit == 0) {
+					// Let background requests complete while the page is iterated
+					loop.sleep(std::chrono::milliseconds(1));
+				}
+			}
+			ASSERT_EQ(expectedId, kItemsCount);
+		}
+
+		{
+			// Results are destroyed, while there are pending background requests
+			CoroQueryResults qr;
+			err = rx.Select(Query(nsName), qr);
+			ASSERT_TRUE(err.ok()) << err.what();
+			auto it = qr.begin();
+			for (unsigned i = 0; i < kFetchLimit + 1; ++i) {
+				++it;
+				ASSERT_TRUE(it.Status().ok()) << it.Status().what();
+			}
+		}
+		CoroQueryResults qr;
+		err = rx.Select(Query(nsName).Limit(1), qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		ASSERT_EQ(qr.Count(), 1);
+
+		rx.Stop();
+	});
+
+	loop.run();
+}
+
+TEST_F(RPCClientTestApi, FetchWithReleasedItems) {
+	// Check, that items, which were released by the server after fetching (kResultsReleaseFetched), do not affect the rest of the results
+	using namespace reindexer::client;
+	using namespace reindexer::net::ev;
+
+	StartDefaultRealServer();
+	dynamic_loop loop;
+	constexpr unsigned kItemsCount = 200;
+	constexpr unsigned kFetchLimit = 15;
+
+	loop.spawn([&loop, this, kItemsCount]() noexcept {
+		const std::string nsName = "ns1";
+		const std::string dsn = "cproto://" + kDefaultRPCServerAddr + "/db1";
+		client::ConnectOpts opts;
+		opts.CreateDBIfMissing();
+		client::ReindexerConfig cfg;
+		cfg.FetchAmount = kFetchLimit;
+		CoroReindexer rx(cfg);
+		auto err = rx.Connect(dsn, loop, opts);
+		ASSERT_TRUE(err.ok()) << err.what();
+
+		CreateNamespace(rx, nsName);
+		FillData(rx, nsName, 0, kItemsCount);
+
+		{
+			// Flag has to be requested explicitly
+			CoroQueryResults qr;
+			err = rx.Select(Query(nsName), qr);
+			ASSERT_TRUE(err.ok()) << err.what();
+			ASSERT_FALSE(qr.Flags() & kResultsReleaseFetched);
+		}
+
+		CoroQueryResults qr(kResultsWithPayloadTypes | kResultsCJson | kResultsReleaseFetched);
+		err = rx.Select(Query(nsName).Sort("id", false), qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		ASSERT_EQ(qr.Count(), kItemsCount);
+		ASSERT_TRUE(qr.Flags() & kResultsReleaseFetched);
+		unsigned expectedId = 0;
+		WrSerializer wser;
+		for (auto& it : qr) {
+			ASSERT_TRUE(it.Status().ok()) << it.Status().what();
+			wser.Reset();
+			err = it.GetJSON(wser, false);
+			ASSERT_TRUE(err.ok()) << err.what();
+			ASSERT_EQ(wser.Slice(), fmt::sprintf(R"json({"id":%d})json", expectedId));
+			if (expectedId == kFetchLimit) {
+				// Remaining items have to be kept by the server
+				CoroQueryResults delQr;
+				err = rx.Delete(Query(nsName), delQr);
+				ASSERT_TRUE(err.ok()) << err.what();
+			}
+			++expectedId;
+		}
+		ASSERT_EQ(expectedId, kItemsCount);
+		rx.Stop();
+	});
+
+	loop.run();
+}
+
 TEST_F(RPCClientTestApi, SubQuery) {
 	using namespace reindexer::client;
 	using namespace reindexer::net::ev;
@@ -1115,3 +1244,86 @@ TEST_F(RPCClientTestApi, SubQuery) {
 
 	loop.run();
 }
+
+TEST_F(RPCClientTestApi, PreparedQueries) {
+	// Prepared queries parameters are bound by the server for both RPC and HTTP requests
+	StartDefaultRealServer();
+	const std::string kNsName = "prepared_queries";
+	reindexer::client::Reindexer rx;
+	reindexer::client::ConnectOpts opts;
+	opts.CreateDBIfMissing();
+	auto err = rx.Connect("cproto://" + kDefaultRPCServerAddr + "/db1", opts);
+	ASSERT_TRUE(err.ok()) << err.what();
+	CreateNamespace(rx, kNsName);
+	FillData(rx, kNsName, 0, 100);
+
+	auto getIds = [](std::string_view json, std::string_view arrayName) {
+		gason::JsonParser parser;
+		std::vector<int> ids;
+		for (const auto& item : parser.Parse(json)[arrayName]) ids.emplace_back(item["id"].As<int>());
+		return ids;
+	};
+	const std::string sql = "SELECT * FROM " + kNsName + " WHERE id >= ? AND id < ? ORDER BY id";
+	for (int i = 0; i < 10; ++i) {
+		client::QueryResults qr;
+		err = rx.Select(sql, {Variant{i * 10}, Variant{i * 10 + 5}}, qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		ASSERT_EQ(qr.Count(), 5);
+		int expectedId = i * 10;
+		for (auto& it : qr) {
+			reindexer::WrSerializer ser;
+			err = it.GetJSON(ser, false);
+			ASSERT_TRUE(err.ok()) << err.what();
+			gason::JsonParser parser;
+			ASSERT_EQ(parser.Parse(ser.Slice())["id"].As<int>(), expectedId++);
+		}
+	}
+	{
+		client::QueryResults qr;
+		err = rx.Select(sql, {Variant{1}}, qr);
+		EXPECT_EQ(err.code(), errParams) << err.what();
+	}
+
+	auto httpGet = [](const std::string& target) {
+		reindexer::net::socket sock;
+		EXPECT_EQ(sock.connect("127.0.0.1:" + std::to_string(kDefaultHttpPort), reindexer::net::socket_domain::tcp), 0);
+		std::string request = "GET " + target + " HTTP/1.1\r\nHost: 127.0.0.1\r\nConnection: close\r\n\r\n";
+		EXPECT_EQ(sock.send(reindexer::span<char>(request.data(), request.size())), ssize_t(request.size()));
+		std::string response;
+		char buf[4096];
+		for (ssize_t n; (n = sock.recv(reindexer::span<char>(buf, sizeof(buf)))) > 0;) response.append(buf, n);
+		return response;
+	};
+	auto urlEncode = [](std::string_view str) {
+		std::string res;
+		for (char c : str) {
+			if (std::isalnum(static_cast<unsigned char>(c))) {
+				res += c;
+			} else {
+				res += fmt::sprintf("%%%02X", static_cast<unsigned char>(c));
+			}
+		}
+		return res;
+	};
+	// Query results are sent with chunked transfer encoding
+	auto httpBody = [](const std::string& response) {
+		auto pos = response.find("\r\n\r\n");
+		EXPECT_NE(pos, std::string::npos) << response;
+		if (response.find("Transfer-Encoding: chunked") > pos) return response.substr(pos + 4);
+		std::string body;
+		for (pos += 4; pos < response.size();) {
+			const auto sizeEnd = response.find("\r\n", pos);
+			const size_t size = std::stoul(response.substr(pos, sizeEnd - pos), nullptr, 16);
+			if (!size) break;
+			body.append(response, sizeEnd + 2, size);
+			pos = sizeEnd + 2 + size + 2;
+		}
+		return body;
+	};
+	const std::string response = httpGet("/api/v1/db/db1/query?q=" + urlEncode(sql) + "&params=" + urlEncode("[20,23]"));
+	ASSERT_EQ(response.rfind("HTTP/1.1 200", 0), 0) << response;
+	EXPECT_EQ(getIds(httpBody(response), "items"), (std::vector<int>{20, 21, 22}));
+
+	const std::string badResponse = httpGet("/api/v1/db/db1/query?q=" + urlEncode(sql) + "&params=" + urlEncode("[20]"));
+	EXPECT_EQ(badResponse.rfind("HTTP/1.1 400", 0), 0) << badResponse;
+}
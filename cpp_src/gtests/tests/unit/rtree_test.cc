@@ -274,6 +274,111 @@ TEST(RTree, LinearMap) { TestMap<reindexer::LinearSplitter>(); }
 TEST(RTree, GreeneMap) { TestMap<reindexer::GreeneSplitter>(); }
 TEST(RTree, RStarMap) { TestMap<reindexer::RStarSplitter>(); }
 
+static double distance(reindexer::Point lhs, reindexer::Point rhs) noexcept {
+	return std::sqrt((lhs.X() - rhs.X()) * (lhs.X() - rhs.X()) + (lhs.Y() - rhs.Y()) * (lhs.Y() - rhs.Y()));
+}
+
+// Verifies of the best-first search of the nearest points in RectangleTree
+template <template <typename, typename, typename, typename, size_t, size_t> class Splitter>
+static void TestNearest() {
+	using RTree = reindexer::RectangleTree<reindexer::Point, Splitter, 16, 8>;
+	using reindexer::randPoint;
+	constexpr size_t kCount = 10000;
+	constexpr size_t kNearestCount = 100;
+
+	RTree tree;
+	std::vector<reindexer::Point> data;
+	for (size_t i = 0; i < kCount; ++i) {
+		const auto res = tree.insert(randPoint(kRange));
+		if (res.second) data.push_back(*res.first);
+	}
+	ASSERT_TRUE(tree.Check());
+
+	for (size_t i = 0; i < 100; ++i) {
+		const reindexer::Point point{randPoint(kRange)};
+		std::vector<double> expected;
+		expected.reserve(data.size());
+		for (const auto& p : data) expected.push_back(distance(point, p));
+		std::sort(expected.begin(), expected.end());
+
+		std::vector<double> found;
+		tree.VisitNearest(point, [&](reindexer::Point p, double d) {
+			EXPECT_DOUBLE_EQ(d, distance(point, p));
+			found.push_back(d);
+			return found.size() == kNearestCount;
+		});
+		ASSERT_EQ(found.size(), kNearestCount);
+		for (size_t j = 0; j < kNearestCount; ++j) {
+			ASSERT_DOUBLE_EQ(found[j], expected[j]) << j;
+		}
+	}
+}
+
+TEST(RTree, QuadraticNearest) { TestNearest<reindexer::QuadraticSplitter>(); }
+TEST(RTree, LinearNearest) { TestNearest<reindexer::LinearSplitter>(); }
+TEST(RTree, GreeneNearest) { TestNearest<reindexer::GreeneSplitter>(); }
+TEST(RTree, RStarNearest) { TestNearest<reindexer::RStarSplitter>(); }
+
+// Query sorted by the distance with limit selects only the nearest items from the RTree index
+TEST_F(ReindexerApi, NearestItemsByRTree) {
+	constexpr int kItemsCount = 2000;
+	constexpr unsigned kOffset = 5;
+	constexpr unsigned kLimit = 10;
+	Error err = rt.reindexer->OpenNamespace(default_namespace);
+	ASSERT_TRUE(err.ok()) << err.what();
+	err = rt.reindexer->AddIndex(default_namespace, {"id", "hash", "int", IndexOpts().PK()});
+	ASSERT_TRUE(err.ok()) << err.what();
+	err = rt.reindexer->AddIndex(default_namespace, {"point", "rtree", "point", IndexOpts().RTreeType(IndexOpts::RStar)});
+	ASSERT_TRUE(err.ok()) << err.what();
+
+	std::vector<reindexer::Point> points;
+	reindexer::WrSerializer wrser;
+	for (int i = 0; i < kItemsCount; ++i) {
+		// Some of the items share the same point
+		points.push_back(i % 4 == 3 ? points[i - 1] : reindexer::randPoint(kRange));
+		wrser.Reset();
+		reindexer::JsonBuilder jsonBuilder(wrser, reindexer::ObjType::TypeObject);
+		jsonBuilder.Put("id", i);
+		jsonBuilder.Array("point", {points.back().X(), points.back().Y()});
+		jsonBuilder.End();
+		Item item = rt.reindexer->NewItem(default_namespace);
+		ASSERT_TRUE(item.Status().ok()) << item.Status().what();
+		err = item.FromJSON(wrser.Slice());
+		ASSERT_TRUE(err.ok()) << err.what();
+		Upsert(default_namespace, item);
+	}
+
+	for (int i = 0; i < 50; ++i) {
+		const reindexer::Point point{reindexer::randPoint(kRange)};
+		std::vector<double> expected;
+		expected.reserve(points.size());
+		for (const auto& p : points) expected.push_back(distance(point, p));
+		std::sort(expected.begin(), expected.end());
+
+		const std::string sortExpr = fmt::sprintf("ST_Distance(point, ST_GeomFromText('point(%.12f %.12f)'))", point.X(), point.Y());
+		QueryResults qr;
+		err = rt.reindexer->Select(Query(default_namespace).Sort(sortExpr, false).Offset(kOffset).Limit(kLimit).Explain(), qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		ASSERT_EQ(qr.Count(), kLimit);
+		for (size_t j = 0; j < qr.Count(); ++j) {
+			Item item = qr[j].GetItem(false);
+			const auto p = static_cast<reindexer::Point>(static_cast<reindexer::VariantArray>(item["point"]));
+			EXPECT_NEAR(distance(point, p), expected[kOffset + j], 1e-9) << j;
+		}
+		// Index is used instead of the full scan
+		EXPECT_NE(qr.GetExplainResults().find("\"field\":\"point\""), std::string::npos) << qr.GetExplainResults();
+	}
+
+	// Nearest items are not searched for the large part of the namespace
+	const reindexer::Point point{reindexer::randPoint(kRange)};
+	const std::string sortExpr = fmt::sprintf("ST_Distance(point, ST_GeomFromText('point(%.12f %.12f)'))", point.X(), point.Y());
+	QueryResults qr;
+	err = rt.reindexer->Select(Query(default_namespace).Sort(sortExpr, false).Limit(kItemsCount / 2).Explain(), qr);
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_EQ(qr.Count(), kItemsCount / 2);
+	EXPECT_EQ(qr.GetExplainResults().find("\"field\":\"point\""), std::string::npos) << qr.GetExplainResults();
+}
+
 // Make sure RTree indexes work with null values correctly
 TEST_F(ReindexerApi, EmptyRTreeSparseValues) {
 	// Create namespace and add 2 RTree indexes (of type Sparse)
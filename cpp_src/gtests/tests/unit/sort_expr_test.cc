@@ -1,6 +1,8 @@
+#include "core/cjson/jsonbuilder.h"
 #include "core/nsselecter/joinedselectormock.h"
 #include "core/nsselecter/sortexpression.h"
 #include "gtest/gtest.h"
+#include "reindexer_api.h"
 
 namespace {
 
@@ -286,3 +288,89 @@ TEST(StringFunctions, SortExpressionParse) {
 		}
 	}
 }
+
+TEST_F(ReindexerApi, SortByCompiledExpressions) {
+	// Not a multiple of the block size
+	constexpr int kItemsCount = 1000;
+	Error err = rt.reindexer->OpenNamespace(default_namespace);
+	ASSERT_TRUE(err.ok()) << err.what();
+	DefineNamespaceDataset(default_namespace, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+											   IndexDeclaration{"popularity", "tree", "int64", IndexOpts(), 0},
+											   IndexDeclaration{"rating", "-", "double", IndexOpts(), 0}});
+	err = rt.reindexer->AddIndex(default_namespace, {"point", "rtree", "point", IndexOpts().RTreeType(IndexOpts::Linear)});
+	ASSERT_TRUE(err.ok()) << err.what();
+
+	struct Row {
+		int id;
+		int extra;
+		double value;
+	};
+	const Point target{0.5, 0.5};
+	std::vector<Row> rows;
+	reindexer::WrSerializer ser;
+	for (int i = 0; i < kItemsCount; ++i) {
+		const int64_t popularity = (i * 7919) % 1000;
+		const double rating = (i % 97) * 1.25;
+		const int extra = i % 13;
+		const Point point{(i % 31) * 0.1, (i % 17) * 0.2};
+		const double dx = point.X() - target.X(), dy = point.Y() - target.Y();
+		const double dist = std::sqrt(dx * dx + dy * dy);
+		rows.push_back({i, extra, std::abs(rating - 50.0) * 2.0 + popularity / 3.0 - extra + dist + -i * 0.001 + rating});
+
+		ser.Reset();
+		{
+			reindexer::JsonBuilder jb(ser);
+			jb.Put("id", i);
+			jb.Put("popularity", popularity);
+			jb.Put("rating", rating);
+			jb.Put("extra", extra);
+			jb.Array("point", {point.X(), point.Y()});
+		}
+		Item item = NewItem(default_namespace);
+		ASSERT_TRUE(item.Status().ok()) << item.Status().what();
+		err = item.FromJSON(ser.Slice());
+		ASSERT_TRUE(err.ok()) << err.what();
+		Upsert(default_namespace, item);
+	}
+
+	{
+		QueryResults qr;
+		err = rt.reindexer->Select(
+			Query(default_namespace)
+				.Sort("abs(rating - 50) * 2 + popularity / 3 - extra + ST_Distance(point, ST_GeomFromText('point(0.5 0.5)')) + "
+					  "-id * 0.001 + rating",
+					  false),
+			qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		ASSERT_EQ(qr.Count(), kItemsCount);
+		std::sort(rows.begin(), rows.end(), [](const Row& lhs, const Row& rhs) { return lhs.value < rhs.value; });
+		for (size_t i = 0; i < qr.Count(); ++i) {
+			Item item = qr[i].GetItem(false);
+			const int id = item["id"].As<int>();
+			ASSERT_GE(id, 0);
+			ASSERT_LT(id, kItemsCount);
+			const auto it = std::find_if(rows.begin(), rows.end(), [id](const Row& r) { return r.id == id; });
+			ASSERT_NE(it, rows.end());
+			EXPECT_NEAR(it->value, rows[i].value, 1e-9) << i;
+		}
+	}
+	{
+		// Several expressions with the non-indexed field
+		QueryResults qr;
+		err = rt.reindexer->Select(Query(default_namespace).Sort("extra + 0", true).Sort("id * 2", true), qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		ASSERT_EQ(qr.Count(), kItemsCount);
+		std::sort(rows.begin(), rows.end(), [](const Row& lhs, const Row& rhs) {
+			return lhs.extra == rhs.extra ? lhs.id > rhs.id : lhs.extra > rhs.extra;
+		});
+		for (size_t i = 0; i < qr.Count(); ++i) {
+			Item item = qr[i].GetItem(false);
+			EXPECT_EQ(item["id"].As<int>(), rows[i].id) << i;
+		}
+	}
+	{
+		QueryResults qr;
+		err = rt.reindexer->Select(Query(default_namespace).Sort("id / (extra - extra)", false), qr);
+		EXPECT_EQ(err.code(), errQueryExec) << err.what();
+	}
+}
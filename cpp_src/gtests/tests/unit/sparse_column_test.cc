@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include "gason/gason.h"
+#include "reindexer_api.h"
+
+TEST_F(ReindexerApi, SparseColumnIndexSelect) {
+	constexpr int kItemsCount = 3000;
+	DefineNamespaceDataset(default_namespace, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+											   IndexDeclaration{"price", "-", "double", IndexOpts().Sparse().Column(), 0},
+											   IndexDeclaration{"rank", "-", "int64", IndexOpts().Sparse().Column(), 0},
+											   IndexDeclaration{"price_plain", "-", "double", IndexOpts().Sparse(), 0},
+											   IndexDeclaration{"rank_plain", "-", "int64", IndexOpts().Sparse(), 0}});
+	auto upsertJson = [&](int id, const std::string &value, const std::string &rank) {
+		Item item = NewItem(default_namespace);
+		std::string json = "{\"id\":" + std::to_string(id);
+		if (!value.empty()) json += ",\"price\":" + value + ",\"price_plain\":" + value;
+		if (!rank.empty()) json += ",\"rank\":" + rank + ",\"rank_plain\":" + rank;
+		json += "}";
+		auto err = item.FromJSON(json);
+		ASSERT_TRUE(err.ok()) << err.what();
+		Upsert(default_namespace, item);
+	};
+	for (int i = 0; i < kItemsCount; ++i) {
+		// Some of the items do not have the field or contain null, which has to be read from the tuple
+		std::string price;
+		if (i % 11 == 3) {
+			price = "null";
+		} else if (i % 5 != 0) {
+			price = std::to_string(rand() % 100) + ".5";
+		}
+		upsertJson(i, price, i % 3 ? std::to_string(rand() % 50) : std::string());
+	}
+	// Update and delete some of the items to check column's consistency
+	for (int i = 0; i < kItemsCount; i += 13) {
+		upsertJson(i, i % 2 ? std::string() : "777.5", "10");
+	}
+	QueryResults qrDel;
+	auto err = rt.reindexer->Delete(Query(default_namespace).Where("id", CondLt, 100), qrDel);
+	ASSERT_TRUE(err.ok()) << err.what();
+	QueryResults qrUpd;
+	err = rt.reindexer->Update(
+		Query(default_namespace).Where("id", CondRange, {Variant{1000}, Variant{1100}}).Set("price", 5.5).Set("price_plain", 5.5), qrUpd);
+	ASSERT_TRUE(err.ok()) << err.what();
+
+	auto checkFilter = [&](const std::string &field, CondType cond, const VariantArray &values) {
+		QueryResults expected, qr;
+		err = rt.reindexer->Select(Query(default_namespace).Where(field + "_plain", cond, values).Sort("id", false), expected);
+		ASSERT_TRUE(err.ok()) << err.what();
+		err = rt.reindexer->Select(Query(default_namespace).Where(field, cond, values).Sort("id", false), qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		ASSERT_EQ(qr.Count(), expected.Count()) << field << ' ' << cond;
+		for (auto it1 = qr.begin(), it2 = expected.begin(); it1 != qr.end(); ++it1, ++it2) {
+			ASSERT_EQ(it1.GetItem(false)["id"].As<int>(), it2.GetItem(false)["id"].As<int>()) << field << ' ' << cond;
+		}
+	};
+	for (const std::string field : {"price", "rank"}) {
+		checkFilter(field, CondEq, {Variant{10}});
+		checkFilter(field, CondEq, {Variant{777.5}});
+		checkFilter(field, CondSet, {Variant{5.5}, Variant{10}, Variant{42.5}});
+		checkFilter(field, CondLt, {Variant{30}});
+		checkFilter(field, CondGe, {Variant{50}});
+		checkFilter(field, CondRange, {Variant{20}, Variant{60}});
+		checkFilter(field, CondEmpty, {});
+		checkFilter(field, CondAny, {});
+	}
+
+	// Sorting and aggregations have to give the same results as for the values from the tuple
+	for (const std::string field : {"price", "rank"}) {
+		for (bool desc : {false, true}) {
+			QueryResults expected, qr;
+			const std::string plainField = field + "_plain";
+			err = rt.reindexer->Select(Query(default_namespace)
+										   .Sort(plainField, desc)
+										   .Sort("id", false)
+										   .Aggregate(AggSum, {plainField})
+										   .Aggregate(AggMin, {plainField})
+										   .Aggregate(AggMax, {plainField})
+										   .Aggregate(AggAvg, {plainField}),
+									   expected);
+			ASSERT_TRUE(err.ok()) << err.what();
+			err = rt.reindexer->Select(Query(default_namespace)
+										   .Sort(field, desc)
+										   .Sort("id", false)
+										   .Aggregate(AggSum, {field})
+										   .Aggregate(AggMin, {field})
+										   .Aggregate(AggMax, {field})
+										   .Aggregate(AggAvg, {field}),
+									   qr);
+			ASSERT_TRUE(err.ok()) << err.what();
+			ASSERT_EQ(qr.Count(), expected.Count());
+			for (auto it1 = qr.begin(), it2 = expected.begin(); it1 != qr.end(); ++it1, ++it2) {
+				ASSERT_EQ(it1.GetItem(false)["id"].As<int>(), it2.GetItem(false)["id"].As<int>()) << field << ' ' << desc;
+			}
+			const auto &aggs = qr.GetAggregationResults();
+			const auto &expectedAggs = expected.GetAggregationResults();
+			ASSERT_EQ(aggs.size(), 4);
+			ASSERT_EQ(expectedAggs.size(), 4);
+			for (size_t i = 0; i < aggs.size(); ++i) {
+				EXPECT_DOUBLE_EQ(aggs[i].GetValueOrZero(), expectedAggs[i].GetValueOrZero()) << field << ' ' << i;
+			}
+		}
+	}
+
+	Item memstat = getMemStat(*rt.reindexer, default_namespace);
+	ASSERT_TRUE(memstat.Status().ok()) << memstat.Status().what();
+	gason::JsonParser parser;
+	auto root = parser.Parse(memstat.GetJSON());
+	bool found = false;
+	for (auto &idx : root["indexes"]) {
+		if (idx["name"].As<std::string>() == "price") {
+			EXPECT_GT(idx["column_size"].As<int64_t>(), 0);
+			found = true;
+		}
+	}
+	ASSERT_TRUE(found);
+}
+
+TEST_F(ReindexerApi, SparseColumnIndexRestrictions) {
+	auto err = rt.reindexer->OpenNamespace(default_namespace);
+	ASSERT_TRUE(err.ok()) << err.what();
+	err = rt.reindexer->AddIndex(default_namespace, {"id", "hash", "int", IndexOpts().PK()});
+	ASSERT_TRUE(err.ok()) << err.what();
+	// Column option requires scalar numeric index, sparse one has to be a store index
+	err = rt.reindexer->AddIndex(default_namespace, {"name", "hash", "string", IndexOpts().Column()});
+	ASSERT_FALSE(err.ok());
+	err = rt.reindexer->AddIndex(default_namespace, {"num", "hash", "int", IndexOpts().Sparse().Column()});
+	ASSERT_FALSE(err.ok());
+	err = rt.reindexer->AddIndex(default_namespace, {"num", "-", "int", IndexOpts().Sparse().Array().Column()});
+	ASSERT_FALSE(err.ok());
+	err = rt.reindexer->AddIndex(default_namespace, {"name", "-", "string", IndexOpts().Sparse().Column()});
+	ASSERT_FALSE(err.ok());
+	err = rt.reindexer->AddIndex(default_namespace, {"num", "-", "int", IndexOpts().Sparse().Column()});
+	ASSERT_TRUE(err.ok()) << err.what();
+}
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include "core/index/string_dictionary.h"
+#include "core/keyvalue/variant.h"
+#include "gason/gason.h"
+#include "reindexer_api.h"
+
+using reindexer::StringDictionary;
+
+using reindexer::make_key_string;
+
+TEST(StringDictionary, SetResetFind) {
+	StringDictionary dict{CollateOpts()};
+	dict.Set(0, make_key_string("abc"));
+	dict.Set(1, make_key_string("def"));
+	dict.Set(2, make_key_string("abc"));
+	ASSERT_EQ(dict.UniqCount(), 2);
+	ASSERT_EQ(dict.RowsCount(), 3);
+	ASSERT_EQ(dict.Codes()[0], dict.Codes()[2]);
+	ASSERT_NE(dict.Codes()[0], dict.Codes()[1]);
+	ASSERT_EQ(dict.Get(dict.Codes()[1]), "def");
+	ASSERT_EQ(dict.Find("abc"), dict.Codes()[0]);
+	ASSERT_EQ(dict.Find("xyz"), StringDictionary::kEmptyCode);
+
+	// Value without rows must not be found
+	dict.Reset(1);
+	ASSERT_EQ(dict.Codes()[1], StringDictionary::kEmptyCode);
+	ASSERT_EQ(dict.Find("def"), StringDictionary::kEmptyCode);
+	ASSERT_EQ(dict.UniqCount(), 1);
+
+	// Set of the same value must not change the code
+	const auto code = dict.Codes()[0];
+	dict.Set(0, make_key_string("abc"));
+	ASSERT_EQ(dict.Codes()[0], code);
+	ASSERT_EQ(dict.UniqCount(), 1);
+
+	const auto codes = dict.Encode({Variant{"def"}, Variant{"abc"}, Variant{"abc"}, Variant{"xyz"}});
+	ASSERT_EQ(codes.size(), 1);
+	ASSERT_EQ(codes[0], code);
+}
+
+TEST(StringDictionary, Collation) {
+	StringDictionary dict{CollateOpts(CollateASCII)};
+	dict.Set(0, make_key_string("Value"));
+	dict.Set(1, make_key_string("VALUE"));
+	ASSERT_EQ(dict.UniqCount(), 1);
+	ASSERT_EQ(dict.Codes()[0], dict.Codes()[1]);
+	ASSERT_EQ(dict.Find("value"), dict.Codes()[0]);
+}
+
+TEST(StringDictionary, SharedStrings) {
+	StringDictionary dict{CollateOpts()};
+	const auto str = make_key_string("value");
+	dict.Set(0, str);
+	dict.Set(1, str);
+	// Dictionary refers the same string instead of the copy
+	ASSERT_FALSE(str.unique());
+	ASSERT_EQ(dict.Get(dict.Codes()[0]).data(), str->data());
+	// String is released with the last row
+	dict.Reset(0);
+	ASSERT_FALSE(str.unique());
+	dict.Reset(1);
+	ASSERT_TRUE(str.unique());
+	ASSERT_EQ(dict.UniqCount(), 0);
+
+	// Code of the released value is reused
+	const auto other = make_key_string("value");
+	dict.Set(2, other);
+	ASSERT_EQ(dict.UniqCount(), 1);
+	ASSERT_EQ(dict.Find("value"), dict.Codes()[2]);
+	ASSERT_EQ(dict.Get(dict.Codes()[2]).data(), other->data());
+}
+
+TEST(StringDictionary, Compaction) {
+	constexpr int kRowsCount = 5000;
+	StringDictionary dict{CollateOpts()};
+	for (int i = 0; i < kRowsCount; ++i) {
+		dict.Set(i, make_key_string("value_" + std::to_string(i)));
+	}
+	ASSERT_EQ(dict.UniqCount(), kRowsCount);
+	const size_t heapSize = dict.HeapSize();
+	// Overwrite most of the rows to produce a lot of unreferenced values
+	for (int i = 0; i < kRowsCount; ++i) {
+		dict.Set(i, make_key_string("other_" + std::to_string(i % 10)));
+	}
+	ASSERT_EQ(dict.UniqCount(), 10);
+	for (int i = 0; i < kRowsCount; ++i) {
+		ASSERT_EQ(dict.Get(dict.Codes()[i]), "other_" + std::to_string(i % 10));
+	}
+	for (int i = 0; i < 10; ++i) {
+		ASSERT_EQ(dict.Find("value_" + std::to_string(i)), StringDictionary::kEmptyCode);
+		ASSERT_EQ(dict.Find("other_" + std::to_string(i)), dict.Codes()[i]);
+	}
+	// Unreferenced entries have to be dropped
+	ASSERT_LT(dict.HeapSize(), heapSize);
+}
+
+TEST_F(ReindexerApi, DictionaryIndexSelect) {
+	constexpr int kItemsCount = 2000;
+	const std::vector<std::string> kCategories{"books", "cars", "food", "games", "music", "sport", "tools", "toys"};
+	DefineNamespaceDataset(default_namespace, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+											   IndexDeclaration{"category", "-", "string", IndexOpts().Dictionary(), 0},
+											   IndexDeclaration{"category_hash", "hash", "string", IndexOpts().Dictionary(), 0},
+											   IndexDeclaration{"category_plain", "-", "string", IndexOpts(), 0}});
+	for (int i = 0; i < kItemsCount; ++i) {
+		Item item = NewItem(default_namespace);
+		const auto &category = kCategories[rand() % kCategories.size()];
+		item["id"] = i;
+		item["category"] = category;
+		item["category_hash"] = category;
+		item["category_plain"] = category;
+		Upsert(default_namespace, item);
+	}
+	// Change some of the values to check codes update
+	for (int i = 0; i < kItemsCount; i += 7) {
+		Item item = NewItem(default_namespace);
+		item["id"] = i;
+		item["category"] = "other";
+		item["category_hash"] = "other";
+		item["category_plain"] = "other";
+		Upsert(default_namespace, item);
+	}
+
+	auto checkSame = [&](CondType cond, const VariantArray &values) {
+		QueryResults expected;
+		auto err = rt.reindexer->Select(Query(default_namespace).Where("category_plain", cond, values).Sort("id", false), expected);
+		ASSERT_TRUE(err.ok()) << err.what();
+		for (const auto &idx : {"category", "category_hash"}) {
+			QueryResults qr;
+			err = rt.reindexer->Select(Query(default_namespace).Where(idx, cond, values).Sort("id", false), qr);
+			ASSERT_TRUE(err.ok()) << err.what();
+			ASSERT_EQ(qr.Count(), expected.Count()) << idx;
+			for (auto it1 = qr.begin(), it2 = expected.begin(); it1 != qr.end(); ++it1, ++it2) {
+				ASSERT_EQ(it1.GetItem(false)["id"].As<int>(), it2.GetItem(false)["id"].As<int>()) << idx;
+			}
+		}
+	};
+	checkSame(CondEq, {Variant{"books"}});
+	checkSame(CondEq, {Variant{"other"}});
+	checkSame(CondEq, {Variant{"unknown"}});
+	checkSame(CondSet, {Variant{"cars"}, Variant{"toys"}, Variant{"unknown"}});
+	checkSame(CondLt, {Variant{"games"}});
+
+	Item memstat = getMemStat(*rt.reindexer, default_namespace);
+	ASSERT_TRUE(memstat.Status().ok()) << memstat.Status().what();
+	gason::JsonParser parser;
+	auto root = parser.Parse(memstat.GetJSON());
+	bool found = false;
+	for (auto &idx : root["indexes"]) {
+		if (idx["name"].As<std::string>() == "category") {
+			EXPECT_GT(idx["dictionary_size"].As<int64_t>(), 0);
+			found = true;
+		}
+	}
+	ASSERT_TRUE(found);
+}
+
+TEST_F(ReindexerApi, DictionaryIndexRestrictions) {
+	auto err = rt.reindexer->OpenNamespace(default_namespace);
+	ASSERT_TRUE(err.ok()) << err.what();
+	err = rt.reindexer->AddIndex(default_namespace, {"id", "hash", "int", IndexOpts().PK()});
+	ASSERT_TRUE(err.ok()) << err.what();
+	err = rt.reindexer->AddIndex(default_namespace, {"num", "hash", "int", IndexOpts().Dictionary()});
+	ASSERT_FALSE(err.ok());
+	err = rt.reindexer->AddIndex(default_namespace, {"tags", "hash", "string", IndexOpts().Array().Dictionary()});
+	ASSERT_FALSE(err.ok());
+	err = rt.reindexer->AddIndex(default_namespace, {"tag", "hash", "string", IndexOpts().Dictionary()});
+	ASSERT_TRUE(err.ok()) << err.what();
+}
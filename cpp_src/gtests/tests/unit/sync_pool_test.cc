@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <condition_variable>
+#include <thread>
+#include "estl/syncpool.h"
+
+namespace {
+
+struct PooledObject {
+	explicit PooledObject(int v = 0) noexcept : value(v) { liveCount.fetch_add(1, std::memory_order_relaxed); }
+	~PooledObject() { liveCount.fetch_sub(1, std::memory_order_relaxed); }
+	int value;
+	std::atomic<bool> inUse{false};
+	static std::atomic<int> liveCount;
+};
+std::atomic<int> PooledObject::liveCount{0};
+
+}  // namespace
+
+TEST(SyncPoolTest, ObjectsAreReused) {
+	reindexer::sync_pool<PooledObject, 4, 8> pool;
+	auto obj = pool.get(0, 1);
+	ASSERT_TRUE(obj);
+	PooledObject *ptr = obj.get();
+	ASSERT_EQ(pool.Alloced(), 1);
+	pool.put(std::move(obj));
+	ASSERT_EQ(pool.Alloced(), 0);
+	// Object is taken from the thread's cache
+	obj = pool.get(0, 2);
+	ASSERT_EQ(obj.get(), ptr);
+	EXPECT_EQ(obj->value, 1);
+	pool.put(std::move(obj));
+
+	// Cleared pool does not return the old objects
+	pool.clear();
+	obj = pool.get(0, 3);
+	EXPECT_EQ(obj->value, 3);
+	pool.put(std::move(obj));
+
+	// Allocation limit
+	std::vector<std::unique_ptr<PooledObject>> objs;
+	for (int i = 0; i < 9; ++i) {
+		objs.emplace_back(pool.get(0));
+		ASSERT_TRUE(objs.back());
+	}
+	EXPECT_FALSE(pool.get(0));
+	EXPECT_TRUE(pool.get(1));
+	objs.clear();
+}
+
+TEST(SyncPoolTest, ObjectsAreSharedBetweenThreads) {
+	reindexer::sync_pool<PooledObject, 64> pool;
+	constexpr size_t kObjects = 2 * decltype(pool)::kThreadCacheSize;
+	std::vector<std::unique_ptr<PooledObject>> objs;
+	for (size_t i = 0; i < kObjects; ++i) objs.emplace_back(pool.get(0, 1));
+	// Objects, which do not fit into the thread's cache, are available for the other threads
+	std::thread releaser([&] {
+		for (auto &obj : objs) pool.put(std::move(obj));
+	});
+	releaser.join();
+	for (size_t i = 0; i < kObjects - decltype(pool)::kThreadCacheSize; ++i) {
+		auto obj = pool.get(0, 2);
+		EXPECT_EQ(obj->value, 1);
+		objs.emplace_back(std::move(obj));
+	}
+	EXPECT_EQ(pool.get(0, 2)->value, 2);
+}
+
+TEST(SyncPoolTest, ConcurrentGetAndPut) {
+	reindexer::sync_pool<PooledObject, 32> pool;
+	constexpr int kThreads = 8;
+	constexpr int kIterations = 20000;
+	std::atomic<int> errors{0};
+	std::vector<std::thread> threads;
+	for (int t = 0; t < kThreads; ++t) {
+		threads.emplace_back([&, t] {
+			std::vector<std::unique_ptr<PooledObject>> objs;
+			for (int i = 0; i < kIterations; ++i) {
+				if (objs.size() < size_t(t % 4 + 1) * 8 && (i % 3 != 0 || objs.empty())) {
+					auto obj = pool.get(0);
+					if (obj->inUse.exchange(true)) ++errors;
+					objs.emplace_back(std::move(obj));
+				} else {
+					objs.back()->inUse = false;
+					pool.put(std::move(objs.back()));
+					objs.pop_back();
+				}
+			}
+			for (auto &obj : objs) {
+				obj->inUse = false;
+				pool.put(std::move(obj));
+			}
+		});
+	}
+	for (auto &th : threads) th.join();
+	EXPECT_EQ(errors.load(), 0);
+	EXPECT_EQ(pool.Alloced(), 0);
+}
+
+TEST(SyncPoolTest, PooledObjectsAreBounded) {
+	constexpr size_t kPoolSize = 16;
+	constexpr int kThreads = 16;
+	constexpr int kObjectsPerThread = 32;
+	const int initialLiveCount = PooledObject::liveCount.load();
+	{
+		reindexer::sync_pool<PooledObject, kPoolSize> pool;
+		std::mutex mtx;
+		std::condition_variable cv;
+		int putThreads = 0;
+		bool done = false;
+		std::vector<std::thread> threads;
+		for (int t = 0; t < kThreads; ++t) {
+			threads.emplace_back([&] {
+				std::vector<std::unique_ptr<PooledObject>> objs;
+				for (int i = 0; i < kObjectsPerThread; ++i) objs.emplace_back(pool.get(0));
+				for (auto &obj : objs) pool.put(std::move(obj));
+				// Threads are kept alive, so their caches are not destroyed until the pool is cleared
+				std::unique_lock lck(mtx);
+				++putThreads;
+				cv.notify_all();
+				cv.wait(lck, [&] { return done; });
+			});
+		}
+		{
+			std::unique_lock lck(mtx);
+			cv.wait(lck, [&] { return putThreads == kThreads; });
+		}
+		// Objects in the threads' caches are counted against the pool size
+		EXPECT_LE(pool.Pooled(), kPoolSize);
+		EXPECT_LE(PooledObject::liveCount.load() - initialLiveCount, int(kPoolSize));
+		EXPECT_EQ(pool.Alloced(), 0);
+
+		// Cleared pool drains the caches of the other threads
+		pool.clear();
+		EXPECT_EQ(pool.Pooled(), 0);
+		EXPECT_EQ(PooledObject::liveCount.load(), initialLiveCount);
+
+		// Caches are refilled after the clear and drained on the pool destruction
+		auto obj = pool.get(0);
+		pool.put(std::move(obj));
+		EXPECT_EQ(pool.Pooled(), 1);
+		{
+			std::lock_guard lck(mtx);
+			done = true;
+		}
+		cv.notify_all();
+		for (auto &th : threads) th.join();
+		EXPECT_EQ(PooledObject::liveCount.load(), initialLiveCount + 1);
+	}
+	EXPECT_EQ(PooledObject::liveCount.load(), initialLiveCount);
+}
@@ -69,6 +69,65 @@ TEST(SyncCoroRx, BaseTest) {
 	}
 }
 
+TEST(SyncCoroRx, FetchWithPrefetch) {
+	// Check results fetching with background pages prefetch
+	const std::string kTestDbPath = fs::JoinPath(fs::GetTempDir(), "SyncCoroRx/FetchWithPrefetch");
+	reindexer::fs::RmDirAll(kTestDbPath);
+	ServerControl server;
+	const std::string_view nsName = "ns";
+	server.InitServer(0, 8999, 9888, kTestDbPath, "db", true);
+	ReplicationConfigTest config("master");
+	server.Get()->MakeMaster(config);
+	reindexer::client::ReindexerConfig clientConfig;
+	clientConfig.FetchAmount = 20;
+	clientConfig.PrefetchBufferSize = 1024;
+	reindexer::client::SyncCoroReindexer client(clientConfig);
+	Error err = client.Connect("cproto://127.0.0.1:8999/db");
+	ASSERT_TRUE(err.ok()) << err.what();
+	err = client.OpenNamespace(nsName);
+	ASSERT_TRUE(err.ok()) << err.what();
+	err = client.AddIndex(nsName, reindexer::IndexDef("id", "hash", "int", IndexOpts().PK()));
+	ASSERT_TRUE(err.ok()) << err.what();
+
+	constexpr int kRowsCount = 500;
+	for (int i = 0; i < kRowsCount; i++) {
+		reindexer::client::Item item = client.NewItem(nsName);
+		ASSERT_TRUE(item.Status().ok()) << item.Status().what();
+		err = item.FromJSON(R"#({"id":)#" + std::to_string(i) + "}");
+		ASSERT_TRUE(err.ok()) << err.what();
+		err = client.Upsert(nsName, item);
+		ASSERT_TRUE(err.ok()) << err.what();
+	}
+	{
+		reindexer::client::SyncCoroQueryResults qr(&client);
+		err = client.Select(std::string("select * from ") + std::string(nsName) + " order by id", qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		ASSERT_EQ(qr.Count(), kRowsCount);
+		int indx = 0;
+		for (auto it = qr.begin(); it != qr.end(); ++it, indx++) {
+			ASSERT_TRUE(it.Status().ok()) << it.Status().what();
+			reindexer::WrSerializer wrser;
+			err = it.GetJSON(wrser, false);
+			ASSERT_TRUE(err.ok()) << err.what();
+			ASSERT_EQ(wrser.Slice(), R"#({"id":)#" + std::to_string(indx) + "}");
+		}
+		ASSERT_EQ(indx, kRowsCount);
+	}
+	{
+		// Results are destroyed before the end of iteration
+		reindexer::client::SyncCoroQueryResults qr(&client);
+		err = client.Select(std::string("select * from ") + std::string(nsName), qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		auto it = qr.begin();
+		for (int i = 0; i < 30; ++i) {
+			++it;
+			ASSERT_TRUE(it.Status().ok()) << it.Status().what();
+		}
+	}
+	err = client.Stop();
+	ASSERT_TRUE(err.ok()) << err.what();
+}
+
 TEST(SyncCoroRx, TestSyncCoroRx) {
 	// test for inserting data in one thread
 	const std::string kTestDbPath = fs::JoinPath(fs::GetTempDir(), "SyncCoroRx/TestSyncCoroRx");
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "core/cjson/jsonbuilder.h"
+#include "core/defnsconfigs.h"
+#include "core/taskscheduler.h"
+#include "gason/gason.h"
+#include "reindexer_api.h"
+#include "tools/errors.h"
+
+using reindexer::TaskScheduler;
+
+TEST(TaskScheduler, PrioritiesOrder) {
+	TaskScheduler scheduler(1);
+	TaskScheduler::Group group;
+	std::mutex mtx;
+	std::vector<int> order;
+	std::atomic<bool> release = {false};
+	// Occupy the single worker, so the other tasks have to be queued
+	scheduler.Schedule(
+		TaskScheduler::Priority::Foreground,
+		[&release] {
+			while (!release.load()) std::this_thread::yield();
+		},
+		&group);
+	auto push = [&](int v) {
+		return [&mtx, &order, v] {
+			std::lock_guard lck(mtx);
+			order.emplace_back(v);
+		};
+	};
+	scheduler.Schedule(TaskScheduler::Priority::GC, push(3), &group);
+	scheduler.Schedule(TaskScheduler::Priority::FtRebuild, push(2), &group);
+	scheduler.Schedule(TaskScheduler::Priority::IndexOptimization, push(1), &group);
+	scheduler.Schedule(TaskScheduler::Priority::GC, push(4), &group);
+	scheduler.Schedule(TaskScheduler::Priority::Foreground, push(0), &group);
+
+	auto stats = scheduler.GetStats();
+	ASSERT_EQ(stats.threadsCount, 1);
+	size_t queued = 0;
+	for (auto &st : stats.priorities) queued += st.queued;
+	ASSERT_GE(queued, 5);
+
+	release = true;
+	group.Wait();
+	ASSERT_EQ(group.Pending(), 0);
+	ASSERT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4}));
+	stats = scheduler.GetStats();
+	ASSERT_EQ(stats.priorities[unsigned(TaskScheduler::Priority::GC)].totalTasks, 2);
+}
+
+TEST(TaskScheduler, NestedParallelFor) {
+	// Nested calls must not deadlock even if all the workers are busy
+	TaskScheduler scheduler(2);
+	constexpr size_t kOuter = 8, kInner = 16;
+	std::atomic<size_t> counter = {0};
+	scheduler.ParallelFor(TaskScheduler::Priority::IndexOptimization, kOuter, [&](size_t) {
+		scheduler.ParallelFor(TaskScheduler::Priority::FtRebuild, kInner, [&](size_t) { counter.fetch_add(1); });
+	});
+	ASSERT_EQ(counter.load(), kOuter * kInner);
+
+	// Threads count may be changed at runtime
+	scheduler.SetThreadsCount(5);
+	ASSERT_EQ(scheduler.ThreadsCount(), 5);
+	counter = 0;
+	scheduler.ParallelFor(TaskScheduler::Priority::Foreground, 100, [&](size_t) { counter.fetch_add(1); });
+	ASSERT_EQ(counter.load(), 100);
+}
+
+TEST(TaskScheduler, ParallelForException) {
+	TaskScheduler scheduler(3);
+	std::atomic<size_t> counter = {0};
+	EXPECT_THROW(scheduler.ParallelFor(TaskScheduler::Priority::Foreground, 10,
+									   [&](size_t i) {
+										   counter.fetch_add(1);
+										   if (i == 0) throw reindexer::Error(errLogic, "Test error");
+									   }),
+				 reindexer::Error);
+	ASSERT_LE(counter.load(), 10);
+}
+
+TEST(TaskScheduler, ConfigureRunningInstance) {
+	auto &scheduler = TaskScheduler::Instance();
+	// Make sure, that the process-wide instance is running
+	scheduler.ParallelFor(TaskScheduler::Priority::Foreground, 4, [](size_t) {});
+	const size_t threadsCount = scheduler.ThreadsCount();
+	// Running instance is never restarted
+	ASSERT_FALSE(TaskScheduler::Configure(threadsCount + 1));
+	ASSERT_EQ(scheduler.ThreadsCount(), threadsCount);
+}
+
+TEST_F(ReindexerApi, BackgroundTasksPerfStats) {
+	DefineNamespaceDataset(default_namespace, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0}});
+	{
+		reindexer::WrSerializer ser;
+		{
+			reindexer::JsonBuilder jb(ser);
+			jb.Put("type", "profiling");
+			auto profiling = jb.Object("profiling");
+			profiling.Put("perfstats", true);
+		}
+		Item item = NewItem(reindexer::kConfigNamespace);
+		ASSERT_TRUE(item.Status().ok()) << item.Status().what();
+		auto err = item.FromJSON(ser.Slice());
+		ASSERT_TRUE(err.ok()) << err.what();
+		Upsert(reindexer::kConfigNamespace, item);
+	}
+
+	// Background routines are executed periodically
+	std::string json;
+	gason::JsonParser parser;
+	gason::JsonNode root;
+	for (int i = 0; i < 200; ++i) {
+		QueryResults qr;
+		auto err = rt.reindexer->Select(Query(reindexer::kPerfStatsNamespace).Where("name", CondEq, default_namespace), qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		ASSERT_EQ(qr.Count(), 1);
+		json = std::string(qr.begin().GetItem(false).GetJSON());
+		root = parser.Parse(std::string_view(json));
+		if (root["background_tasks"]["total_count"].As<int64_t>() > 0) break;
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	}
+	const auto bgTasks = root["background_tasks"];
+	ASSERT_GT(bgTasks["total_count"].As<int64_t>(), 0) << json;
+	ASSERT_LE(bgTasks["min_queue_wait_us"].As<int64_t>(), bgTasks["max_queue_wait_us"].As<int64_t>()) << json;
+	ASSERT_LE(bgTasks["min_exec_time_us"].As<int64_t>(), bgTasks["max_exec_time_us"].As<int64_t>()) << json;
+
+
+	// Scheduler's stats are reported once per database, not per namespace
+	ASSERT_TRUE(root["task_scheduler"].empty()) << json;
+	QueryResults qr;
+	auto err = rt.reindexer->Select(Query(reindexer::kSchedulerStatsNamespace), qr);
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_EQ(qr.Count(), 1);
+	json = std::string(qr.begin().GetItem(false).GetJSON());
+	const auto scheduler = parser.Parse(std::string_view(json));
+	ASSERT_EQ(scheduler["threads_count"].As<size_t>(), TaskScheduler::Instance().ThreadsCount()) << json;
+	size_t prioritiesCount = 0, totalTasks = 0;
+	for (const auto &prio : scheduler["priorities"]) {
+		++prioritiesCount;
+		totalTasks += prio["total_tasks"].As<size_t>();
+	}
+	ASSERT_EQ(prioritiesCount, TaskScheduler::kPrioritiesCount) << json;
+	ASSERT_GT(totalTasks, 0) << json;
+}
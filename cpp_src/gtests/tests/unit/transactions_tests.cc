@@ -164,3 +164,146 @@ TEST_F(TransactionApi, IndexesOptimizeTest) {
 	bool optimization_completed = qr[0].GetItem(false)["optimization_completed"].Get<bool>();
 	ASSERT_EQ(true, optimization_completed);
 }
+
+TEST_F(TransactionApi, ParallelIndexesInsertion) {
+	// Transaction is large enough to insert new items into the indexes in parallel
+	constexpr int kNewItems = 12000;
+	constexpr int kExistingItems = 100;
+	constexpr int kValues = 50;
+	const std::string kNs = "tx_parallel_insertion";
+	Error err = rt.reindexer->OpenNamespace(kNs);
+	ASSERT_TRUE(err.ok()) << err.what();
+	DefineNamespaceDataset(kNs, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+								 IndexDeclaration{"value", "tree", "int", IndexOpts(), 0},
+								 IndexDeclaration{"name", "hash", "string", IndexOpts(), 0},
+								 IndexDeclaration{"tags", "hash", "string", IndexOpts().Array(), 0},
+								 IndexDeclaration{"value+name", "tree", "composite", IndexOpts(), 0}});
+	const auto makeItem = [&](int id, int value) {
+		Item item = rt.reindexer->NewItem(kNs);
+		EXPECT_TRUE(item.Status().ok()) << item.Status().what();
+		err = item.FromJSON(fmt::sprintf(R"json({"id":%d,"value":%d,"name":"name_%d","tags":["tag_%d","tag_%d"],"extra":%d})json", id,
+										 value, value, value, value + 1, id));
+		EXPECT_TRUE(err.ok()) << err.what();
+		return item;
+	};
+	for (int i = 0; i < kExistingItems; ++i) {
+		Item item = makeItem(i, 0);
+		Upsert(kNs, item);
+	}
+
+	auto tx = rt.reindexer->NewTransaction(kNs);
+	size_t modifySteps = 0;
+	for (int i = 0; i < kNewItems; ++i) {
+		tx.Upsert(makeItem(i, i % kValues));
+		++modifySteps;
+		// Items, which were inserted by the current batch, have to be found by PK
+		if (i % 1000 == 999) {
+			tx.Upsert(makeItem(i - 500, kValues));
+			++modifySteps;
+		}
+		if (i == kNewItems / 2) {
+			tx.Delete(makeItem(10, 0));
+			++modifySteps;
+		}
+	}
+	QueryResults result;
+	err = rt.reindexer->CommitTransaction(tx, result);
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_EQ(result.Count(), modifySteps);
+
+	const auto check = [&](const Query& q, size_t expected) {
+		QueryResults qr;
+		err = rt.reindexer->Select(q, qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		EXPECT_EQ(qr.Count(), expected) << q.GetSQL();
+	};
+	constexpr int kUpdated = kNewItems / 1000;
+	check(Query(kNs), kNewItems - 1);
+	check(Query(kNs).Where("id", CondEq, 10), 0);
+	check(Query(kNs).Where("value", CondEq, kValues), kUpdated);
+	check(Query(kNs).Where("name", CondEq, fmt::sprintf("name_%d", kValues)), kUpdated);
+	check(Query(kNs).Where("tags", CondEq, fmt::sprintf("tag_%d", kValues + 1)), kUpdated);
+	check(Query(kNs).WhereComposite("value+name", CondEq, {{Variant{kValues}, Variant{fmt::sprintf("name_%d", kValues)}}}), kUpdated);
+	check(Query(kNs).Where("value", CondEq, 7), kNewItems / kValues);
+	check(Query(kNs).Where("value", CondEq, 10), kNewItems / kValues - 1);
+	check(Query(kNs).Where("extra", CondEq, kNewItems - 1), 1);
+	check(Query(kNs).Where("id", CondEq, 499).Where("value", CondEq, kValues), 1);
+
+	// Sorted results are consistent with the data
+	QueryResults qr;
+	err = rt.reindexer->Select(Query(kNs).Sort("value", true).Limit(kUpdated), qr);
+	ASSERT_TRUE(err.ok()) << err.what();
+	ASSERT_EQ(qr.Count(), kUpdated);
+	for (auto& it : qr) {
+		EXPECT_EQ(it.GetItem(false)["value"].As<int>(), kValues);
+	}
+}
+
+TEST_F(TransactionApi, SpilledItems) {
+	// Every item of the transaction is written into the temporary file
+	constexpr int kItems = 3000;
+	const std::string kNs = "tx_spilled_items";
+	Error err = rt.reindexer->OpenNamespace(kNs);
+	ASSERT_TRUE(err.ok()) << err.what();
+	DefineNamespaceDataset(kNs, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+								 IndexDeclaration{"value", "tree", "int", IndexOpts(), 0},
+								 IndexDeclaration{"name", "hash", "string", IndexOpts(), 0},
+								 IndexDeclaration{"tags", "hash", "string", IndexOpts().Array(), 0},
+								 IndexDeclaration{"serial", "", "int64", IndexOpts(), 0}});
+	SetNamespaceConfig(kNs, [](reindexer::JsonBuilder &cfg) { cfg.Put("tx_items_spill_threshold", 1); });
+
+	auto tx = rt.reindexer->NewTransaction(kNs);
+	ASSERT_TRUE(tx.Status().ok()) << tx.Status().what();
+	for (int i = 0; i < kItems; ++i) {
+		Item item = tx.NewItem();
+		ASSERT_TRUE(item.Status().ok()) << item.Status().what();
+		if (i % 2) {
+			err = item.FromJSON(
+				fmt::sprintf(R"json({"id":%d,"value":%d,"name":"name_%d","tags":["tag_%d","tag_%d"],"extra":"extra_%d"})json", i, i % 10, i,
+							 i, i + 1, i));
+			ASSERT_TRUE(err.ok()) << err.what();
+		} else {
+			// Values of the indexed fields, which are not present in the tuple
+			item["id"] = i;
+			item["value"] = i % 10;
+			item["name"] = fmt::sprintf("name_%d", i);
+			item["tags"] = VariantArray::Create(fmt::sprintf("tag_%d", i), fmt::sprintf("tag_%d", i + 1));
+		}
+		if (i % 100 == 0) item.SetPrecepts({"serial=SERIAL()"});
+		tx.Upsert(std::move(item));
+	}
+	for (int i = 0; i < kItems; i += 3) {
+		Item item = tx.NewItem();
+		item["id"] = i;
+		tx.Delete(std::move(item));
+	}
+
+	QueryResults result;
+	err = rt.reindexer->CommitTransaction(tx, result);
+	ASSERT_TRUE(err.ok()) << err.what();
+
+	const auto check = [&](const Query& q, size_t expected) {
+		QueryResults qr;
+		err = rt.reindexer->Select(q, qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		EXPECT_EQ(qr.Count(), expected) << q.GetSQL();
+	};
+	check(Query(kNs), kItems - kItems / 3);
+	check(Query(kNs).Where("id", CondEq, 3), 0);
+	check(Query(kNs).Where("serial", CondGt, 0), kItems / 100 - kItems / 300);
+	for (int id : {1, 2, 4, 5, kItems - 1}) {
+		QueryResults qr;
+		err = rt.reindexer->Select(Query(kNs).Where("id", CondEq, id), qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		ASSERT_EQ(qr.Count(), 1);
+		Item item = qr.begin().GetItem(false);
+		EXPECT_EQ(item["value"].As<int>(), id % 10);
+		EXPECT_EQ(item["name"].As<std::string>(), fmt::sprintf("name_%d", id));
+		const VariantArray tags = item["tags"];
+		ASSERT_EQ(tags.size(), 2);
+		EXPECT_EQ(tags[1].As<std::string>(), fmt::sprintf("tag_%d", id + 1));
+		if (id % 2) {
+			EXPECT_EQ(item["extra"].As<std::string>(), fmt::sprintf("extra_%d", id));
+		}
+	}
+}
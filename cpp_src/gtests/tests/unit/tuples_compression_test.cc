@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include "gason/gason.h"
+#include "reindexer_api.h"
+
+class TuplesCompressionApi : public ReindexerApi {
+protected:
+	void SetUp() override {
+		ReindexerApi::SetUp();
+		for (const auto &ns : {compressedNs, plainNs}) {
+			DefineNamespaceDataset(ns, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+										IndexDeclaration{"name", "-", "string", IndexOpts().Sparse(), 0}});
+		}
+	}
+
+	void SetTuplesCompression(std::string_view mode) {
+		SetNamespaceConfig(compressedNs, [&](reindexer::JsonBuilder &cfg) {
+			cfg.Put("tuples_compression", mode);
+			cfg.Put("tuples_compression_min_size", 64);
+		});
+	}
+
+	void UpsertItems(int from, int to) {
+		for (int i = from; i < to; ++i) {
+			std::string json = "{\"id\":" + std::to_string(i) + ",\"nested\":{\"value\":" + std::to_string(i % 10) + ",\"descr\":\"";
+			// Long repeated description is compressed well
+			for (int j = 0; j < 20; ++j) json += "description " + std::to_string(i % 7) + ' ';
+			json += "\"},\"arr\":[" + std::to_string(i) + ",1,2,3]";
+			if (i % 3) json += ",\"name\":\"name_" + std::to_string(i % 5) + "\"";
+			json += '}';
+			for (const auto &ns : {compressedNs, plainNs}) {
+				Item item = NewItem(ns);
+				ASSERT_TRUE(item.Status().ok()) << item.Status().what();
+				auto err = item.FromJSON(json);
+				ASSERT_TRUE(err.ok()) << err.what();
+				Upsert(ns, item);
+			}
+		}
+	}
+
+	// Results for the namespace with compressed tuples have to be exactly the same as for the plain one
+	void CheckSelect(const Query &q) {
+		QueryResults qr, expected;
+		Query plainQ = q;
+		plainQ.SetNsName(plainNs);
+		auto err = rt.reindexer->Select(q, qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		err = rt.reindexer->Select(plainQ, expected);
+		ASSERT_TRUE(err.ok()) << err.what();
+		ASSERT_EQ(qr.Count(), expected.Count()) << q.GetSQL();
+		for (auto it1 = qr.begin(), it2 = expected.begin(); it1 != qr.end(); ++it1, ++it2) {
+			reindexer::WrSerializer ser1, ser2;
+			err = it1.GetJSON(ser1, false);
+			ASSERT_TRUE(err.ok()) << err.what();
+			err = it2.GetJSON(ser2, false);
+			ASSERT_TRUE(err.ok()) << err.what();
+			ASSERT_EQ(ser1.Slice(), ser2.Slice()) << q.GetSQL();
+		}
+	}
+
+	void CheckAll() {
+		CheckSelect(Query(compressedNs).Sort("id", false));
+		CheckSelect(Query(compressedNs).Where("nested.value", CondEq, 3).Sort("id", false));
+		CheckSelect(Query(compressedNs).Where("name", CondEq, "name_2").Sort("id", true));
+		CheckSelect(Query(compressedNs).Where("arr", CondSet, {Variant{7}, Variant{77}, Variant{777}}).Sort("id", false));
+		CheckSelect(Query(compressedNs).Sort("nested.value", true).Sort("id", false).Limit(100));
+		CheckSelect(Query(compressedNs).Where("nested.descr", CondLike, "description 4%").Sort("id", false));
+	}
+
+	void Update(const std::string &sql) {
+		for (const auto &ns : {compressedNs, plainNs}) {
+			QueryResults qr;
+			auto err = rt.reindexer->Update(Query::FromSQL("UPDATE " + ns + ' ' + sql), qr);
+			ASSERT_TRUE(err.ok()) << err.what();
+		}
+	}
+
+	gason::JsonNode GetMemStat(gason::JsonParser &parser, std::string &json, const std::string &ns) {
+		Item memstat = getMemStat(*rt.reindexer, ns);
+		EXPECT_TRUE(memstat.Status().ok()) << memstat.Status().what();
+		json = std::string(memstat.GetJSON());
+		return parser.Parse(std::string_view(json));
+	}
+	static gason::JsonNode GetTuplesIndexStat(const gason::JsonNode &root) {
+		for (auto &idx : root["indexes"]) {
+			if (idx["name"].As<std::string>() == "-tuple") return idx;
+		}
+		return {};
+	}
+
+	const std::string compressedNs = "compressed_tuples_ns";
+	const std::string plainNs = "plain_tuples_ns";
+};
+
+TEST_F(TuplesCompressionApi, SelectAndModify) {
+	SetTuplesCompression("snappy");
+	UpsertItems(0, 1000);
+	CheckAll();
+
+	// Modification of the non-indexed fields, sparse index and arrays
+	Update("SET nested.value = 100 WHERE id < 50");
+	Update("SET name = 'updated_name' WHERE id >= 950");
+	Update("SET arr[1] = 500 WHERE nested.value = 5");
+	Update("DROP nested.descr WHERE id > 100 AND id < 150");
+	for (const auto &ns : {compressedNs, plainNs}) {
+		QueryResults qr;
+		auto err = rt.reindexer->Delete(Query(ns).Where("id", CondRange, {Variant{200}, Variant{300}}), qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+	}
+	UpsertItems(900, 1100);
+	CheckAll();
+
+	gason::JsonParser parser;
+	std::string json;
+	auto root = GetMemStat(parser, json, compressedNs);
+	auto stat = GetTuplesIndexStat(root);
+	ASSERT_FALSE(stat.empty()) << json;
+	const auto compressedCount = stat["compressed_tuples_count"].As<int64_t>();
+	EXPECT_GT(compressedCount, 0) << json;
+	EXPECT_GT(stat["uncompressed_tuples_size"].As<int64_t>(), stat["compressed_tuples_size"].As<int64_t>()) << json;
+	EXPECT_GT(root["tuples_compression"]["decompressions_count"].As<int64_t>(), 0) << json;
+
+	stat = GetTuplesIndexStat(GetMemStat(parser, json, plainNs));
+	ASSERT_FALSE(stat.empty()) << json;
+	EXPECT_EQ(stat["compressed_tuples_count"].As<int64_t>(), 0) << json;
+
+	// Already compressed tuples have to be readable after the compression is disabled
+	SetTuplesCompression("none");
+	UpsertItems(1050, 1200);
+	Update("SET nested.value = 42 WHERE id > 500 AND id < 600");
+	CheckAll();
+	stat = GetTuplesIndexStat(GetMemStat(parser, json, compressedNs));
+	EXPECT_GT(stat["compressed_tuples_count"].As<int64_t>(), 0) << json;
+	EXPECT_LT(stat["compressed_tuples_count"].As<int64_t>(), compressedCount) << json;
+}
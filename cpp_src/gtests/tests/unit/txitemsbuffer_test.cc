@@ -0,0 +1,26 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "core/txitemsbuffer.h"
+
+using reindexer::TxItemsBuffer;
+
+TEST(TxItemsBufferTest, ChunksGrowGeometrically) {
+	TxItemsBuffer buf(0);
+	const std::string item(100, 'a');
+	auto rec = buf.Append(item);
+	// Single small item does not allocate the large chunk
+	ASSERT_LE(buf.MemSize(), 16 << 10);
+	ASSERT_EQ(buf.Read(rec), item);
+
+	std::vector<TxItemsBuffer::Record> records;
+	for (int i = 0; i < 50000; ++i) records.emplace_back(buf.Append(std::to_string(i) + item));
+	ASSERT_EQ(buf.DiskSize(), 0);
+	// Overhead of the chunks is bounded by the largest chunk's size
+	ASSERT_LE(buf.MemSize(), 50000 * (item.size() + 5) + (1 << 20));
+	for (int i = 0; i < 50000; ++i) ASSERT_EQ(buf.Read(records[i]), std::to_string(i) + item);
+
+	// Large item takes its own chunk
+	const std::string large(3 << 20, 'b');
+	rec = buf.Append(large);
+	ASSERT_EQ(buf.Read(rec), large);
+}
@@ -250,3 +250,64 @@ TEST_F(ReindexerApi, NumericSearchForNonIndexedField) {
 		ASSERT_TRUE(value.Type().Is<reindexer::KeyValueType::Int64>());
 	}
 }
+
+TEST_F(ReindexerApi, GetValueByJsonPathSkipsSubtrees) {
+	Error err = rt.reindexer->OpenNamespace(default_namespace, StorageOpts().Enabled(false));
+	ASSERT_TRUE(err.ok()) << err.what();
+	err = rt.reindexer->AddIndex(default_namespace, {"id", "hash", "int", IndexOpts().PK()});
+	ASSERT_TRUE(err.ok()) << err.what();
+	err = rt.reindexer->AddIndex(default_namespace, {"indexed_arr", "tree", "int", IndexOpts().Array()});
+	ASSERT_TRUE(err.ok()) << err.what();
+
+	// Target fields are placed after the values of all the types, which have to be skipped
+	constexpr int kItems = 50;
+	for (int i = 0; i < kItems; ++i) {
+		Item item = rt.reindexer->NewItem(default_namespace);
+		ASSERT_TRUE(item.Status().ok()) << item.Status().what();
+		err = item.FromJSON(fmt::sprintf(
+			R"json({"id":%d,"indexed_arr":[1,2,3],"ints":[%d,300000,-5,70000000000],"doubles":[1.5,2.5],"bools":[true,false],)json"
+			R"json("strings":["a","bb"],"null_field":null,"objs":[{"x":1,"y":[1,2]},{"x":2}],"nested":{"skip":{"a":[1,2,3],"b":"str"},)json"
+			R"json("target":%d,"target_arr":[%d,%d],"target_str":"str_%d"},"top_target":%d})json",
+			i, i, i, i, i + 1, i, i % 10));
+		ASSERT_TRUE(err.ok()) << err.what();
+		Upsert(default_namespace, item);
+
+		VariantArray values = item["nested.target"];
+		ASSERT_EQ(values.size(), 1);
+		EXPECT_EQ(values[0].As<int>(), i);
+		EXPECT_FALSE(values.IsArrayValue());
+		values = item["nested.target_arr"];
+		ASSERT_EQ(values.size(), 2);
+		EXPECT_EQ(values[1].As<int>(), i + 1);
+		EXPECT_TRUE(values.IsArrayValue());
+		values = item["nested.target_str"];
+		ASSERT_EQ(values.size(), 1);
+		EXPECT_EQ(values[0].As<std::string>(), fmt::sprintf("str_%d", i));
+		values = item["top_target"];
+		ASSERT_EQ(values.size(), 1);
+		EXPECT_EQ(values[0].As<int>(), i % 10);
+		values = item["nested.missing"];
+		EXPECT_EQ(values.size(), 0);
+		// Paths through the arrays of objects and the indexed fields are handled by the encoder
+		values = item["objs.x"];
+		ASSERT_EQ(values.size(), 2);
+		EXPECT_EQ(values[1].As<int>(), 2);
+		values = item["indexed_arr"];
+		ASSERT_EQ(values.size(), 3);
+		values = item["ints"];
+		ASSERT_EQ(values.size(), 4);
+		EXPECT_EQ(values[3].As<int64_t>(), 70000000000);
+	}
+
+	const auto check = [&](const Query& q, size_t expected) {
+		QueryResults qr;
+		err = rt.reindexer->Select(q, qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+		EXPECT_EQ(qr.Count(), expected) << q.GetSQL();
+	};
+	check(Query(default_namespace).Where("nested.target", CondLt, 10), 10);
+	check(Query(default_namespace).Where("nested.target_arr", CondEq, 5), 2);
+	check(Query(default_namespace).Where("nested.target_str", CondEq, "str_7"), 1);
+	check(Query(default_namespace).Where("top_target", CondEq, 3), kItems / 10);
+	check(Query(default_namespace).Where("nested.skip.b", CondEq, "str"), kItems);
+}
@@ -107,9 +107,22 @@ void CoroClientConnection::Stop() {
 		terminate_ = false;
 		isRunning_ = false;
 		handleFatalError(Error(errNetwork, "Connection closed"));
+		bgWg_.wait();
 	}
 }
 
+bool CoroClientConnection::SpawnBackground(std::function<void()> func) {
+	if (terminate_ || !isRunning_) {
+		return false;
+	}
+	bgWg_.add(1);
+	loop_->spawn_now([this, func = std::move(func)] {
+		coroutine::wait_group_guard wgg(bgWg_);
+		func();
+	});
+	return true;
+}
+
 Error CoroClientConnection::Status(std::chrono::seconds netTimeout, std::chrono::milliseconds execTimeout, const IRdxCancelContext *ctx) {
 	if (loggedIn_) {
 		return errOK;
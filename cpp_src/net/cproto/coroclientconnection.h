@@ -124,6 +124,10 @@ public:
 		args.reserve(sizeof...(argss));
 		return call(opts, args, argss...);
 	}
+	// Spawns coroutine for the background requests, which are not bound to the caller's lifetime (i.e. results prefetch).
+	// Coroutine starts immediately, so the request is sent before the control returns to the caller.
+	// Stop() awaits all of those coroutines. Returns false, if connection is not running
+	bool SpawnBackground(std::function<void()> func);
 
 private:
 	struct RPCData {
@@ -194,6 +198,7 @@ private:
 	coroutine::channel<CoroRPCAnswer> updatesCh_;
 	coroutine::wait_group wg_;
 	coroutine::wait_group readWg_;
+	coroutine::wait_group bgWg_;
 	bool loggedIn_ = false;
 	Error lastError_ = errOK;
 	coroutine::channel<bool> errSyncCh_;
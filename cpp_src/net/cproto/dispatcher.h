@@ -42,6 +42,10 @@ class Writer {
 public:
 	virtual ~Writer() = default;
 	virtual void WriteRPCReturn(Context &ctx, const Args &args, const Error &status) = 0;
+	// Returns pooled buffer for the first (string) argument of the successful response. Argument's data has to be appended to the
+	// buffer and then the buffer has to be passed to WriteRPCReturn as is. It allows to serialize large responses without extra copying
+	virtual chunk GetRPCReturnChunk() = 0;
+	virtual void WriteRPCReturn(Context &ctx, chunk &&firstArg, const Args &args) = 0;
 	virtual void CallRPC(const IRPCCall &call) = 0;
 	virtual void SetClientData(std::unique_ptr<ClientData> &&data) noexcept = 0;
 	virtual ClientData *GetClientData() noexcept = 0;
@@ -50,6 +54,8 @@ public:
 
 struct Context {
 	void Return(const Args &args, const Error &status = errOK) { writer->WriteRPCReturn(*this, args, status); }
+	chunk GetReturnChunk() { return writer->GetRPCReturnChunk(); }
+	void Return(chunk &&firstArg, const Args &args) { writer->WriteRPCReturn(*this, std::move(firstArg), args); }
 	void SetClientData(std::unique_ptr<ClientData> &&data) noexcept { writer->SetClientData(std::move(data)); }
 	ClientData *GetClientData() noexcept { return writer->GetClientData(); }
 
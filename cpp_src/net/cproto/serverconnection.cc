@@ -11,6 +11,9 @@ namespace cproto {
 const auto kCProtoTimeoutSec = 300;
 const auto kUpdatesResendTimeout = 0.1;
 const auto kMaxUpdatesBufSize = 1024 * 1024 * 8;
+// Space, reserved in front of the first argument of the response: header, status code, status message, args count, argument's type and
+// argument's length (up to 5 bytes for each varint)
+constexpr size_t kRPCReturnPrefixReserve = sizeof(CProtoHeader) + 5 * 5;
 
 ServerConnection::ServerConnection(socket &&s, ev::dynamic_loop &loop, Dispatcher &dispatcher, bool enableStat, size_t maxUpdatesSize,
 								   bool enableCustomBalancing)
@@ -35,6 +38,7 @@ ServerConnection::~ServerConnection() { BaseConnT::closeConn(); }
 
 bool ServerConnection::Restart(socket &&s) {
 	BaseConnT::restart(std::move(s));
+	lastReturnSize_ = 0;
 	updates_async_.start();
 	BaseConnT::callback(BaseConnT::io_, ev::READ);
 	return true;
@@ -195,7 +199,7 @@ ServerConnection::BaseConnT::ReadResT ServerConnection::onRead() {
 	return BaseConnT::ReadResT::Default;
 }
 
-static void packRPC(WrSerializer &ser, Context &ctx, const Error &status, const Args &args, bool enableSnappy) {
+static CProtoHeader makeRPCHeader(const Context &ctx, bool enableSnappy) noexcept {
 	CProtoHeader hdr;
 	hdr.len = 0;
 	hdr.magic = kCprotoMagic;
@@ -209,6 +213,11 @@ static void packRPC(WrSerializer &ser, Context &ctx, const Error &status, const
 		hdr.cmd = 0;
 		hdr.seq = 0;
 	}
+	return hdr;
+}
+
+static void packRPC(WrSerializer &ser, Context &ctx, const Error &status, const Args &args, bool enableSnappy) {
+	CProtoHeader hdr = makeRPCHeader(ctx, enableSnappy);
 
 	size_t savePos = ser.Len();
 	ser.Write(std::string_view(reinterpret_cast<char *>(&hdr), sizeof(hdr)));
@@ -242,9 +251,70 @@ void ServerConnection::responceRPC(Context &ctx, const Error &status, const Args
 		return;
 	}
 
-	auto &&chunk = packRPC(BaseConnT::wrBuf_.get_chunk(), ctx, status, args, enableSnappy_);
-	auto len = chunk.len();
-	BaseConnT::wrBuf_.write(std::move(chunk));
+	writeResponce(ctx, packRPC(BaseConnT::wrBuf_.get_chunk(), ctx, status, args, enableSnappy_), status, args);
+}
+
+chunk ServerConnection::GetRPCReturnChunk() {
+	constexpr char kEmptyPrefix[kRPCReturnPrefixReserve] = {};
+	// Sequential fetches usually have similar sizes, so the spare chunk is used only after the large response
+	chunk ch = BaseConnT::wrBuf_.get_chunk(lastReturnSize_);
+	ch.append(std::string_view(kEmptyPrefix, sizeof(kEmptyPrefix)));
+	return ch;
+}
+
+void ServerConnection::responceRPC(Context &ctx, chunk &&firstArg, const Args &args) {
+	if rx_unlikely (ctx.respSent) {
+		fprintf(stderr, "Warning - RPC responce already sent\n");
+		return;
+	}
+	assertrx(firstArg.size() >= kRPCReturnPrefixReserve);
+
+	CProtoHeader hdr = makeRPCHeader(ctx, enableSnappy_);
+	const size_t argLen = firstArg.size() - kRPCReturnPrefixReserve;
+	if (argLen >= size_t(std::numeric_limits<int32_t>::max())) {
+		throw Error(errNetwork, "Too large RPC message(%d), size: %d bytes", hdr.cmd, argLen);
+	}
+	lastReturnSize_ = argLen;
+	// Response prefix is placed right before the argument's data, so the data itself is never moved
+	uint8_t prefixBuf[kRPCReturnPrefixReserve];
+	WrSerializer prefix(prefixBuf);
+	prefix.Write(std::string_view(reinterpret_cast<char *>(&hdr), sizeof(hdr)));
+	prefix.PutVarUint(errOK);
+	prefix.PutVString(std::string_view());
+	prefix.PutVarUint(args.size() + 1);
+	prefix.PutKeyValueType(KeyValueType::String{});
+	prefix.PutVarUint(argLen);
+	assertrx(prefix.Len() <= kRPCReturnPrefixReserve);
+	firstArg.shift(kRPCReturnPrefixReserve - prefix.Len());
+	memcpy(firstArg.data(), prefix.Buf(), prefix.Len());
+	if (!args.empty()) {
+		WrSerializer ser;
+		for (auto &arg : args) {
+			ser.PutVariant(arg);
+		}
+		firstArg.append(ser.Slice());
+	}
+
+	if (hdr.compressed) {
+		const std::string_view data(reinterpret_cast<const char *>(firstArg.data()) + sizeof(hdr), firstArg.size() - sizeof(hdr));
+		WrSerializer ser(BaseConnT::wrBuf_.get_chunk());
+		ser.Reserve(sizeof(hdr) + snappy::MaxCompressedLength(data.size()));
+		ser.Reset(sizeof(hdr));
+		size_t compressedLen = 0;
+		snappy::RawCompress(data.data(), data.size(), reinterpret_cast<char *>(ser.Buf() + ser.Len()), &compressedLen);
+		ser.Reset(ser.Len() + compressedLen);
+		BaseConnT::wrBuf_.recycle(std::move(firstArg));
+		firstArg = ser.DetachChunk();
+	}
+	hdr.len = firstArg.size() - sizeof(hdr);
+	memcpy(firstArg.data(), &hdr, sizeof(hdr));
+	// The first argument is not passed to the logger to avoid large results dumping
+	writeResponce(ctx, std::move(firstArg), Error(), args);
+}
+
+void ServerConnection::writeResponce(Context &ctx, chunk &&ch, const Error &status, const Args &args) {
+	const auto len = ch.size();
+	BaseConnT::wrBuf_.write(std::move(ch));
 	if (BaseConnT::stats_) {
 		BaseConnT::stats_->update_send_buf_size(BaseConnT::wrBuf_.data_size());
 	}
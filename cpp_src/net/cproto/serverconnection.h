@@ -49,6 +49,8 @@ public:
 
 	// Writer iterface implementation
 	void WriteRPCReturn(Context &ctx, const Args &args, const Error &status) override final { responceRPC(ctx, status, args); }
+	chunk GetRPCReturnChunk() override final;
+	void WriteRPCReturn(Context &ctx, chunk &&firstArg, const Args &args) override final { responceRPC(ctx, std::move(firstArg), args); }
 	void CallRPC(const IRPCCall &call) override final;
 	void SetClientData(std::unique_ptr<ClientData> &&data) noexcept override final { clientData_ = std::move(data); }
 	ClientData *GetClientData() noexcept override final { return clientData_.get(); }
@@ -61,6 +63,8 @@ protected:
 	void onClose() override;
 	void handleRPC(Context &ctx);
 	void responceRPC(Context &ctx, const Error &error, const Args &args);
+	void responceRPC(Context &ctx, chunk &&firstArg, const Args &args);
+	void writeResponce(Context &ctx, chunk &&ch, const Error &status, const Args &args);
 	void async_cb(ev::async &) { sendUpdates(); }
 	void timeout_cb(ev::periodic &, int) { sendUpdates(); }
 	void sendUpdates();
@@ -81,6 +85,8 @@ protected:
 	ev::async updates_async_;
 	bool enableSnappy_;
 	bool hasPendingData_ = false;
+	// Size of the last response, which was written via GetRPCReturnChunk()
+	size_t lastReturnSize_ = 0;
 	BalancingType balancingType_ = BalancingType::NotSet;
 	std::function<void(IServerConnection *, BalancingType)> rebalance_;
 };
@@ -166,6 +166,16 @@ public:
 		auto id = coroutine::create(std::move(func), stack_size);
 		new_tasks_.emplace_back(id);
 	}
+	// Same as spawn(), but switches to the new coroutine immediately instead of the next loop iteration.
+	// Has to be called from the coroutine, which is running in this loop
+	void spawn_now(std::function<void()> func, size_t stack_size = coroutine::k_default_stack_limit) {
+		assertrx(coroutine::current());
+		assertrx(coroTid_ == std::this_thread::get_id());
+		auto id = coroutine::create(std::move(func), stack_size);
+		running_tasks_.emplace_back(id);
+		[[maybe_unused]] int res = coroutine::resume(id);
+		assertrx(res == 0);
+	}
 	template <typename Rep, typename Period>
 	void sleep(std::chrono::duration<Rep, Period> dur);
 	template <typename Rep1, typename Period1, typename Rep2, typename Period2, typename Terminater>
@@ -200,6 +200,7 @@ static bool errorIsFatal(const Error &err) {
 		case errQrUIDMissmatch:
 		case errSystem:
 		case errAssert:
+		case errQueryMemoryLimit:
 		default:
 			return true;
 	}
@@ -520,6 +521,7 @@ Error Replicator::syncNamespaceByWAL(const NamespaceDef &nsDef) {
 		case errQrUIDMissmatch:
 		case errSystem:
 		case errAssert:
+		case errQueryMemoryLimit:
 			break;
 	}
 	return err;
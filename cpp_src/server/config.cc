@@ -52,6 +52,7 @@ void ServerConfig::Reset() {
 	MaxHttpReqSize = 2 * 1024 * 1024;
 	AllocatorCacheLimit = -1;
 	AllocatorCachePart = -1;
+	SchedulerThreads = 0;
 }
 
 const std::string ServerConfig::kDedicatedThreading = "dedicated";
@@ -107,6 +108,8 @@ Error ServerConfig::ParseCmd(int argc, char *argv[]) {
 	args::Flag autorepairF(dbGroup, "", "Enable autorepair for storages after unexpected shutdowns", {"autorepair"});
 	args::Flag disableNamespaceLeakF(dbGroup, "", "Disable namespaces leak on database destruction (may slow down server's termination)",
 									 {"disable-ns-leak"});
+	args::ValueFlag<size_t> schedulerThreadsF(dbGroup, "", "Background tasks scheduler threads count (shared by all the databases)",
+											  {"scheduler-threads"}, SchedulerThreads, args::Options::Single);
 
 	args::Group netGroup(parser, "Network options");
 	args::ValueFlag<std::string> httpAddrF(netGroup, "PORT", "http listen host:port", {'p', "httpaddr"}, HTTPAddr, args::Options::Single);
@@ -211,6 +214,7 @@ Error ServerConfig::ParseCmd(int argc, char *argv[]) {
 	if (startWithErrorsF) StartWithErrors = args::get(startWithErrorsF);
 	if (autorepairF) Autorepair = args::get(autorepairF);
 	if (disableNamespaceLeakF) AllowNamespaceLeak = !args::get(disableNamespaceLeakF);
+	if (schedulerThreadsF) SchedulerThreads = args::get(schedulerThreadsF);
 	if (logLevelF) LogLevel = args::get(logLevelF);
 	if (httpAddrF) HTTPAddr = args::get(httpAddrF);
 	if (rpcAddrF) RPCAddr = args::get(rpcAddrF);
@@ -263,6 +267,7 @@ Error ServerConfig::ParseCmd(int argc, char *argv[]) {
 reindexer::Error ServerConfig::fromYaml(YAML::Node &root) {
 	try {
 		AllowNamespaceLeak = root["db"]["ns_leak"].as<bool>(AllowNamespaceLeak);
+		SchedulerThreads = root["db"]["scheduler_threads"].as<size_t>(SchedulerThreads);
 		StoragePath = root["storage"]["path"].as<std::string>(StoragePath);
 		StorageEngine = root["storage"]["engine"].as<std::string>(StorageEngine);
 		StartWithErrors = root["storage"]["startwitherrors"].as<bool>(StartWithErrors);
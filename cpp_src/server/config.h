@@ -74,6 +74,7 @@ struct ServerConfig {
 	std::chrono::seconds RPCQrIdleTimeout;
 	int64_t AllocatorCacheLimit;
 	float AllocatorCachePart;
+	size_t SchedulerThreads;
 
 	static const std::string kDedicatedThreading;
 	static const std::string kSharedThreading;
@@ -9,6 +9,7 @@
 #include "core/cjson/msgpackdecoder.h"
 #include "core/cjson/protobufbuilder.h"
 #include "core/cjson/protobufschemabuilder.h"
+#include "core/query/preparedquery.h"
 #include "core/queryresults/tableviewbuilder.h"
 #include "core/schema.h"
 #include "core/type_consts.h"
@@ -28,6 +29,7 @@
 #include "tools/alloc_ext/tc_malloc_extension.h"
 #include "tools/flagguard.h"
 #include "tools/fsops.h"
+#include "tools/json2kv.h"
 #include "tools/serializer.h"
 #include "tools/stringstools.h"
 #include "vendor/sort/pdqsort.hpp"
@@ -50,7 +52,27 @@ HTTPServer::HTTPServer(DBManager &dbMgr, LoggerWrapper &logger, const ServerConf
 	  startTs_(system_clock_w::now()) {}
 
 Error HTTPServer::execSqlQueryByType(std::string_view sqlQuery, reindexer::QueryResults &res, http::Context &ctx) {
-	const auto q = reindexer::Query::FromSQL(sqlQuery);
+	// Query with '?' placeholders is executed as prepared query, if the parameters are passed as json array
+	std::string paramsJson = urldecode2(ctx.request->params.Get("params"));
+	reindexer::Query q;
+	if (paramsJson.empty()) {
+		q = reindexer::Query::FromSQL(sqlQuery);
+	} else {
+		VariantArray params;
+		try {
+			gason::JsonParser parser;
+			auto root = parser.Parse(giftStr(paramsJson));
+			if (root.value.getTag() != gason::JSON_ARRAY) {
+				return Error(errParams, "`params` parameter has to be json array");
+			}
+			for (const auto &elem : root) {
+				params.emplace_back(jsonValue2Variant(elem.value, KeyValueType::Undefined{}).EnsureHold());
+			}
+		} catch (const gason::Exception &ex) {
+			return Error(errParseJson, "Prepared query params: %s", ex.what());
+		}
+		q = reindexer::PreparedQueriesCache::Instance().Prepare(sqlQuery)->Bind(params);
+	}
 	switch (q.Type()) {
 		case QuerySelect:
 			return getDB<kRoleDataRead>(ctx).Select(q, res);
@@ -3,6 +3,7 @@
 #include <sstream>
 #include "core/cjson/jsonbuilder.h"
 #include "core/iclientsstats.h"
+#include "core/query/preparedquery.h"
 #include "core/transactionimpl.h"
 #include "debug/crashqueryreporter.h"
 #include "net/cproto/cproto.h"
@@ -200,9 +201,10 @@ void RPCServer::OnResponse(cproto::Context &ctx) {
 	}
 }
 
-Error RPCServer::execSqlQueryByType(std::string_view sqlQuery, QueryResults &res, cproto::Context &ctx) noexcept {
+Error RPCServer::execSqlQueryByType(std::string_view sqlQuery, const VariantArray *params, QueryResults &res,
+									 cproto::Context &ctx) noexcept {
 	try {
-		const auto q = Query::FromSQL(sqlQuery);
+		const auto q = params ? PreparedQueriesCache::Instance().Prepare(sqlQuery)->Bind(*params) : Query::FromSQL(sqlQuery);
 		switch (q.Type()) {
 			case QuerySelect:
 				return getDB(ctx, kRoleDataRead).Select(q, res);
@@ -645,17 +647,19 @@ Reindexer RPCServer::getDB(cproto::Context &ctx, UserRole role) {
 }
 
 Error RPCServer::sendResults(cproto::Context &ctx, QueryResults &qres, RPCQrId id, const ResultFetchOpts &opts) {
-	uint8_t serBuf[0x2000];
-	WrResultSerializer rser(serBuf, opts);
+	// Results are serialized directly into the connection's write buffer
+	WrResultSerializer rser(ctx.GetReturnChunk(), opts);
 	try {
 		bool doClose = rser.PutResults(&qres);
 		if (doClose && id.main >= 0) {
 			freeQueryResults(ctx, id);
 			id.main = -1;
 			id.uid = RPCQrWatcher::kUninitialized;
+		} else if (opts.flags & kResultsReleaseFetched) {
+			// Client will never request those items again, so there is no need to keep them pinned until the end of the fetching
+			qres.ReleaseItems(size_t(opts.fetchOffset) + opts.fetchLimit);
 		}
-		std::string_view resSlice = rser.Slice();
-		ctx.Return({cproto::Arg(p_string(&resSlice)), cproto::Arg(int(id.main)), cproto::Arg(int64_t(id.uid))});
+		ctx.Return(rser.DetachChunk(), {cproto::Arg(int(id.main)), cproto::Arg(int64_t(id.uid))});
 	} catch (Error &err) {
 		if (id.main >= 0) {
 			try {
@@ -841,7 +845,8 @@ Error RPCServer::Select(cproto::Context &ctx, p_string queryBin, int flags, int
 	return sendResults(ctx, *qres, id, opts);
 }
 
-Error RPCServer::SelectSQL(cproto::Context &ctx, p_string querySql, int flags, int limit, p_string ptVersionsPck) {
+Error RPCServer::SelectSQL(cproto::Context &ctx, p_string querySql, int flags, int limit, p_string ptVersionsPck,
+						   std::optional<p_string> paramsPck) {
 	RPCQrId id{-1, (flags & kResultsSupportIdleTimeout) ? RPCQrWatcher::kUninitialized : RPCQrWatcher::kDisabled};
 	RPCQrWatcher::Ref qres;
 	try {
@@ -855,7 +860,21 @@ Error RPCServer::SelectSQL(cproto::Context &ctx, p_string querySql, int flags, i
 
 	ActiveQueryScope scope(querySql);
 
-	auto ret = execSqlQueryByType(querySql, *qres, ctx);
+	// Query with '?' placeholders is executed as prepared query, if the parameters are passed
+	std::optional<VariantArray> params;
+	if (paramsPck) {
+		try {
+			Serializer ser(*paramsPck);
+			params.emplace();
+			for (unsigned i = 0, cnt = ser.GetVarUint(); i < cnt; ++i) {
+				params->emplace_back(ser.GetVariant().EnsureHold());
+			}
+		} catch (Error &e) {
+			freeQueryResults(ctx, id);
+			return e;
+		}
+	}
+	auto ret = execSqlQueryByType(querySql, params ? &*params : nullptr, *qres, ctx);
 	if (!ret.ok()) {
 		freeQueryResults(ctx, id);
 		return ret;
@@ -880,6 +899,11 @@ Error RPCServer::FetchResults(cproto::Context &ctx, int reqId, int flags, int of
 		throw;
 	}
 
+	if (size_t(offset) < (*qres).ReleasedItemsCount()) {
+		return Error(errParams, "Unable to fetch results from offset %d: first %d items were already released by the streaming fetch",
+					 offset, (*qres).ReleasedItemsCount());
+	}
+
 	ResultFetchOpts opts{
 		.flags = flags, .ptVersions = {}, .fetchOffset = unsigned(offset), .fetchLimit = unsigned(limit), .withAggregations = false};
 	return sendResults(ctx, *qres, id, opts);
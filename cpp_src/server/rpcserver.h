@@ -96,7 +96,7 @@ public:
 	Error UpdateQuery(cproto::Context &ctx, p_string query, std::optional<int> flags) noexcept;
 
 	Error Select(cproto::Context &ctx, p_string query, int flags, int limit, p_string ptVersions);
-	Error SelectSQL(cproto::Context &ctx, p_string query, int flags, int limit, p_string ptVersions);
+	Error SelectSQL(cproto::Context &ctx, p_string query, int flags, int limit, p_string ptVersions, std::optional<p_string> params);
 	Error FetchResults(cproto::Context &ctx, int reqId, int flags, int offset, int limit, std::optional<int64_t> qrUID);
 	Error CloseResults(cproto::Context &ctx, int reqId, std::optional<int64_t> qrUID, std::optional<bool> doNotReply);
 	Error GetSQLSuggestions(cproto::Context &ctx, p_string query, int pos);
@@ -113,7 +113,8 @@ public:
 	void OnResponse(cproto::Context &ctx);
 
 protected:
-	Error execSqlQueryByType(std::string_view sqlQuery, reindexer::QueryResults &res, cproto::Context &ctx) noexcept;
+	Error execSqlQueryByType(std::string_view sqlQuery, const VariantArray *params, reindexer::QueryResults &res,
+							 cproto::Context &ctx) noexcept;
 	Error sendResults(cproto::Context &ctx, QueryResults &qr, RPCQrId id, const ResultFetchOpts &opts);
 	Error processTxItem(DataFormat format, std::string_view itemData, Item &item, ItemModifyMode mode, int stateToken) const noexcept;
 
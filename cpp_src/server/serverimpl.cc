@@ -8,6 +8,7 @@
 
 #include "args/args.hpp"
 #include "clientsstats.h"
+#include "core/taskscheduler.h"
 #include "dbmanager.h"
 #include "debug/allocdebug.h"
 #include "debug/backtrace.h"
@@ -287,6 +288,10 @@ int ServerImpl::run() {
 #endif
 
 	initCoreLogger();
+	// Scheduler is shared by all the databases, so it is configured once before their initialization
+	if (config_.SchedulerThreads && !reindexer::TaskScheduler::Configure(config_.SchedulerThreads)) {
+		logger_.warn("Unable to set background tasks scheduler threads count: scheduler is already running");
+	}
 	logger_.info("Initializing databases...");
 	const auto clientsStats = config_.EnableConnectionsStats ? std::make_unique<ClientsStats>() : std::unique_ptr<ClientsStats>();
 	try {
@@ -5,6 +5,10 @@
 #include "tools/errors.h"
 #include "vendor/itoa/itoa.h"
 
+#if REINDEXER_WITH_SSE
+#include <emmintrin.h>
+#endif	// REINDEXER_WITH_SSE
+
 namespace reindexer {
 
 p_string Serializer::GetPVString() { return p_string(getPVStringPtr()); }
@@ -17,6 +21,36 @@ p_string Serializer::GetPSlice() {
 	return p_string(ret);
 }
 
+void Serializer::SkipVarints(size_t count) {
+	size_t pos = pos_;
+#if REINDEXER_WITH_SSE
+	// Varint ends with the byte without the continuation bit, so the ends of the varints are counted for 16 bytes at once
+	while (count && pos + sizeof(__m128i) <= len_) {
+		const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf_ + pos));
+		uint32_t ends = ~uint32_t(_mm_movemask_epi8(bytes)) & 0xFFFF;
+		const size_t endsCount = __builtin_popcount(ends);
+		if (endsCount < count) {
+			count -= endsCount;
+			pos += sizeof(__m128i);
+			continue;
+		}
+		for (; count > 1; --count) ends &= ends - 1;
+		pos += __builtin_ctz(ends) + 1;
+		count = 0;
+	}
+#endif	// REINDEXER_WITH_SSE
+	for (; count; --count) {
+		const auto l = scan_varint(len_ - pos, buf_ + pos);
+		if (l == 0) {
+			using namespace std::string_view_literals;
+			pos_ = pos;
+			throwScanIntError("skip_varint"sv);
+		}
+		pos += l;
+	}
+	pos_ = pos;
+}
+
 [[noreturn]] void Serializer::throwUnderflowError(uint64_t pos, uint64_t need, uint64_t len) {
 	throw Error(errParseBin, "Binary buffer underflow. Need more %d bytes, pos=%d,len=%d", (pos + need) - len, pos, len);
 }
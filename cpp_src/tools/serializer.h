@@ -126,6 +126,12 @@ public:
 	p_string GetPSlice();
 	[[nodiscard]] Uuid GetStrUuid() { return Uuid{GetVString()}; }
 	bool GetBool() { return bool(GetVarUint()); }
+	void Skip(size_t bytes) {
+		checkbound(pos_, bytes, len_);
+		pos_ += bytes;
+	}
+	// Skips count of varints/varuints without decoding them
+	void SkipVarints(size_t count);
 	size_t Pos() const noexcept { return pos_; }
 	void SetPos(size_t p) noexcept { pos_ = p; }
 	const uint8_t *Buf() const noexcept { return buf_; }
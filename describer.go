@@ -12,6 +12,7 @@ const (
 	PerfstatsNamespaceName        = "#perfstats"
 	QueriesperfstatsNamespaceName = "#queriesperfstats"
 	ClientsStatsNamespaceName     = "#clientsstats"
+	SchedulerStatsNamespaceName   = "#schedulerstats"
 )
 
 // Map from cond name to index type
@@ -79,6 +80,18 @@ type CacheMemStat struct {
 	EmptyCount int64 `json:"empty_count"`
 	// Number of hits of queries, to store results in cache
 	HitCountLimit int64 `json:"hit_count_limit"`
+	// Count of lookups, which have found the stored value
+	HitsCount int64 `json:"hits_count"`
+	// Total size of the values, found in this cache
+	HitBytes int64 `json:"hit_bytes"`
+	// Count of lookups, which have not found the stored value
+	MissesCount int64 `json:"misses_count"`
+	// Count of the stored values, evicted from this cache
+	EvictedCount int64 `json:"evicted_count"`
+	// Total size of the values, evicted from this cache
+	EvictedBytes int64 `json:"evicted_bytes"`
+	// Count of the values, which were not stored, because they are less valuable than the cached ones
+	RejectedCount int64 `json:"rejected_count"`
 }
 
 // Operation counter and server id
@@ -232,7 +245,7 @@ type PerfStat struct {
 type TxPerfStat struct {
 	// Total transactions count for namespace
 	TotalCount int64 `json:"total_count"`
-	// Total namespace copy operations
+	// Total namespace copy operations, made by transactions and by UPDATE/DELETE queries with copy_policy_for_queries
 	TotalCopyCount int64 `json:"total_copy_count"`
 	// Average steps count in transactions for this namespace
 	AvgStepsCount int64 `json:"avg_steps_count"`
@@ -271,6 +284,51 @@ type NamespacePerfStat struct {
 	Selects PerfStat `json:"selects"`
 	// Performance statistics for transactions
 	Transactions TxPerfStat `json:"transactions"`
+	// Performance statistics for background routines (optimization, GC)
+	BackgroundTasks BgTasksPerfStat `json:"background_tasks"`
+}
+
+// BgTasksPerfStat is information about namespace's background routines performance statistics
+type BgTasksPerfStat struct {
+	// Total count of executed background tasks
+	TotalCount int64 `json:"total_count"`
+	// Count of tasks, skipped because the same task was already queued
+	SkippedCount int64 `json:"skipped_count"`
+	// Average time usec, spent by task in the task scheduler's queue
+	AvgQueueWaitUs int64 `json:"avg_queue_wait_us"`
+	// Minimum time usec, spent by task in the task scheduler's queue
+	MinQueueWaitUs int64 `json:"min_queue_wait_us"`
+	// Maximum time usec, spent by task in the task scheduler's queue
+	MaxQueueWaitUs int64 `json:"max_queue_wait_us"`
+	// Average task execution time usec
+	AvgExecTimeUs int64 `json:"avg_exec_time_us"`
+	// Minimum task execution time usec
+	MinExecTimeUs int64 `json:"min_exec_time_us"`
+	// Maximum task execution time usec
+	MaxExecTimeUs int64 `json:"max_exec_time_us"`
+}
+
+// TaskSchedulerStat is information about the process-wide background task scheduler. It is stored in #schedulerstats namespace
+type TaskSchedulerStat struct {
+	// Name of the scheduler: 'task_scheduler'
+	Name string `json:"name"`
+	// Count of the scheduler's worker threads
+	ThreadsCount int64 `json:"threads_count"`
+	// Count of the worker threads, which are executing tasks right now
+	BusyThreads int64 `json:"busy_threads"`
+	// Per-priority queues statistics
+	Priorities []struct {
+		// Priority name: foreground, index_optimization, ft_rebuild or gc
+		Priority string `json:"priority"`
+		// Count of tasks, waiting in the queue
+		Queued int64 `json:"queued"`
+		// Total count of executed tasks
+		TotalTasks int64 `json:"total_tasks"`
+		// Average time usec, spent by task in the queue
+		AvgQueueWaitUs int64 `json:"avg_queue_wait_us"`
+		// Maximum time usec, spent by task in the queue
+		MaxQueueWaitUs int64 `json:"max_queue_wait_us"`
+	} `json:"priorities"`
 }
 
 // ClientConnectionStat is information about client connection
@@ -331,6 +389,10 @@ type ClientConnectionStat struct {
 type QueryPerfStat struct {
 	Query string `json:"query"`
 	PerfStat
+	// Maximum peak memory usage of the query in bytes
+	MaxPeakMemoryBytes int64 `json:"max_peak_memory_bytes"`
+	// Average peak memory usage of the query in bytes
+	AvgPeakMemoryBytes int64 `json:"avg_peak_memory_bytes"`
 }
 
 // DBConfigItem is structure stored in system '#config` namespace
@@ -379,6 +441,10 @@ type DBProfilingConfig struct {
 	QueriesPerfStats bool `json:"queriesperfstats"`
 	// Enables recording of activity statistics into #activitystats namespace
 	ActivityStats bool `json:"activitystats"`
+	// Memory limit for the single select query's results and intermediate structures in bytes (0 - unlimited)
+	QueryMemoryLimit int64 `json:"query_memory_limit"`
+	// Memory limit for all the concurrently executing select queries in bytes (0 - unlimited)
+	TotalQueriesMemoryLimit int64 `json:"total_queries_memory_limit"`
 
 	// Configured console logging of long queries
 	LongQueryLogging *LongQueryLoggingConfig `json:"long_queries_logging,omitempty"`
@@ -426,6 +492,10 @@ type NamespaceCacheConfig struct {
 	// For example with value of 2: first request will be executed without caching, second request will generate cache entry and put results into the cache and third request will get cached results. This value may be automatically increased if cache is invalidation too fast
 	// Default value is 2. Min value is 0
 	QueryCountHitsToCache uint32 `json:"query_count_hit_to_cache"`
+	// Max size of the decompressed tuples cache in bytes for each namespace
+	// This cache is used only if tuples compression is enabled
+	// Default value is 8388608 (8 MB). Min value is 0
+	TuplesCacheSize uint64 `json:"tuples_cache_size"`
 }
 
 // DBNamespacesConfig is part of reindexer configuration contains namespaces options
@@ -446,10 +516,25 @@ type DBNamespacesConfig struct {
 	CopyPolicyMultiplier int `json:"copy_policy_multiplier"`
 	// Force namespace copying for transaction with steps count greater than this value
 	TxSizeToAlwaysCopy int `json:"tx_size_to_always_copy"`
+	// Enable namespace copying for UPDATE and DELETE queries, which modify enough items to pass the transactions copy policy.
+	// Selects are not blocked by such queries
+	CopyPolicyForQueries bool `json:"copy_policy_for_queries,omitempty"`
+	// Execute UPDATE and DELETE queries, which match more items than this value, in chunks of this size.
+	// Namespace lock is released between the chunks. 0 - disables chunked execution
+	UpdDelChunkSize int64 `json:"upd_del_chunk_size,omitempty"`
+	// Number of threads, which insert new items of the large transaction into the indexes in parallel on commit.
+	// 0 - disables parallel insertion
+	TxIndexInsertionThreads int `json:"tx_index_insertion_threads"`
+	// Size of the transaction's serialized items in bytes, after which the following items are written into the temporary file
+	// until the commit. 0 - items are always kept in memory
+	TxItemsSpillThreshold int64 `json:"tx_items_spill_threshold"`
 	// Timeout before background indexes optimization start after last update. 0 - disable optimizations
 	OptimizationTimeout int `json:"optimization_timeout_ms"`
 	// Maximum number of background threads of sort indexes optimization. 0 - disable sort optimizations
 	OptimizationSortWorkers int `json:"optimization_sort_workers"`
+	// Timeout after the last update, after which the modified fulltext indexes are rebuilt in background instead of the first query.
+	// 0 - fulltext indexes are rebuilt by the first query only
+	FtCommitDebounce int `json:"ft_commit_debounce_ms,omitempty"`
 	// Maximum WAL size for this namespace (maximum count of WAL records)
 	WALSize int64 `json:"wal_size"`
 	// Minimum preselect size for optimization of inner join by injection of filters. It is using if (MaxPreselectPart * ns.size) is less than this value
@@ -464,6 +549,16 @@ type DBNamespacesConfig struct {
 	// 0 - disables synchronous storage flush. In this case storage will be flushed in background thread only
 	// Default value is 20000
 	SyncStorageFlushLimit int `json:"sync_storage_flush_limit"`
+	// Compression mode of the items' tuples (non-indexed fields) in memory. One of none, snappy
+	// Default value is none
+	TuplesCompression string `json:"tuples_compression,omitempty"`
+	// Minimal size of the tuple in bytes to be compressed
+	// Default value is 256
+	TuplesCompressionMinSize int64 `json:"tuples_compression_min_size,omitempty"`
+	// Allocate the items' payloads in the namespace's slab arena. Sparse slabs are compacted by the background optimization,
+	// unless the namespace has composite indexes
+	// Default value is false
+	PayloadArena bool `json:"payload_arena,omitempty"`
 	// Namespaces' cache configs
 	CacheConfig *NamespaceCacheConfig `json:"cache,omitempty"`
 }
@@ -60,6 +60,7 @@ type DSL struct {
 	Explain      bool          `json:"explain,omitempty"`
 	ReqTotal     bool          `json:"req_total,omitempty"`
 	WithRank     bool          `json:"select_with_rank,omitempty"`
+	IndexOnly    bool          `json:"select_index_only,omitempty"`
 	Aggregations []Aggregation `json:"aggregations,omitempty"`
 }
 
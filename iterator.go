@@ -36,6 +36,14 @@ type ExplainSelector struct {
 	ExplainPreselect *ExplainResults `json:"explain_preselect,omitempty"`
 	// One of selects in joined namespace execution explainings
 	ExplainSelect *ExplainResults   `json:"explain_select,omitempty"`
+	// Count of the batched selects, used to process left join for the blocks of the rows
+	BatchSelectsCount int `json:"batch_selects_count,omitempty"`
+	// Preselected joined values were looked up via hash table
+	HashJoin bool `json:"hash_join,omitempty"`
+	// Hash table build time (zero, if table was taken from the join cache)
+	HashBuildUs int `json:"hash_build_us,omitempty"`
+	// Total time of the hash table lookups
+	HashProbeUs int `json:"hash_probe_us,omitempty"`
 	Selectors     []ExplainSelector `json:"selectors,omitempty"`
 }
 
@@ -64,8 +72,12 @@ type ExplainResults struct {
 	SortIndex string `json:"sort_index"`
 	// General sort time
 	GeneralSortUs int `json:"general_sort_us"`
+	// Peak memory usage of the query results and intermediate structures
+	PeakMemoryBytes int64 `json:"peak_memory_bytes"`
 	// Optimization of sort by uncompleted index has been performed
 	SortByUncommittedIndex bool `json:"sort_by_uncommitted_index"`
+	// Results have been built from the indexes' columns without access to the documents (index-only scan)
+	IndexOnly bool `json:"index_only"`
 	// Filter selectors, used to proccess query conditions
 	Selectors []ExplainSelector `json:"selectors"`
 	// Explaining attempts to inject Join queries ON-conditions into the Main Query WHERE clause
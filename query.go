@@ -52,6 +52,7 @@ const (
 	queryDropField              = bindings.QueryDropField
 	queryUpdateObject           = bindings.QueryUpdateObject
 	queryWithRank               = bindings.QueryWithRank
+	queryIndexOnly              = bindings.QueryIndexOnly
 	queryStrictMode             = bindings.QueryStrictMode
 	queryUpdateFieldV2          = bindings.QueryUpdateFieldV2
 	queryBetweenFieldsCondition = bindings.QueryBetweenFieldsCondition
@@ -750,6 +751,13 @@ func (q *Query) WithRank() *Query {
 	return q
 }
 
+// IndexOnly - Allow to build the results from the columns of the selected 'is_column' indexes without access to the documents.
+// Results contain the index value even for the documents without this field
+func (q *Query) IndexOnly() *Query {
+	q.ser.PutVarCUInt(queryIndexOnly)
+	return q
+}
+
 // SetContext set interface, which will be passed to Joined interface
 func (q *Query) SetContext(ctx interface{}) *Query {
 	q.context = ctx
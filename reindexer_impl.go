@@ -738,6 +738,8 @@ func (db *reindexerImpl) setDefaultQueryDebug(ctx context.Context, namespace str
 		TxSizeToAlwaysCopy:      100000,
 		OptimizationTimeout:     800,
 		OptimizationSortWorkers: 4,
+		TxIndexInsertionThreads: 4,
+		TxItemsSpillThreshold:   0,
 		WALSize:                 4000000,
 	}
 	found := false
@@ -1177,6 +1179,9 @@ func (db *reindexerImpl) queryFrom(d *dsl.DSL) (*Query, error) {
 	if d.WithRank {
 		q.WithRank()
 	}
+	if d.IndexOnly {
+		q.IndexOnly()
+	}
 
 	joinIDs := make(map[string]int)
 	return db.handleFiltersDSL(d.Filters, &joinIDs, q)